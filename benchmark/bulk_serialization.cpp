@@ -0,0 +1,170 @@
+// Copyright 2021 Peter Dimov.
+// Copyright 2024 Joaquin M Lopez Munoz.
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Saving and loading a large boost::unordered_flat_map through a
+// Boost.Serialization binary archive: element-wise (key type not marked as
+// bitwise serializable) vs. bulk. Link with Boost.Serialization.
+
+#define _SILENCE_CXX17_OLD_ALLOCATOR_MEMBERS_DEPRECATION_WARNING
+#define _SILENCE_CXX20_CISO646_REMOVED_WARNING
+
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/serialization/is_bitwise_serializable.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+static void print_time( std::chrono::steady_clock::time_point & t1, char const* label, std::uint64_t s, std::size_t size )
+{
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << label << ": " << ( t2 - t1 ) / 1ms << " ms (s=" << s << ", size=" << size << ")\n";
+
+    t1 = t2;
+}
+
+#ifndef BENCHMARK_SIZE
+# define BENCHMARK_SIZE 5'000'000
+#endif
+
+constexpr unsigned N = BENCHMARK_SIZE;
+constexpr unsigned M = 100'000; // lookups after loading
+
+static std::vector< std::uint64_t > indices;
+
+template<bool Bitwise> struct key
+{
+    std::uint64_t v;
+
+    friend bool operator==( key const& x, key const& y )
+    {
+        return x.v == y.v;
+    }
+
+    friend std::size_t hash_value( key const& x )
+    {
+        return boost::hash<std::uint64_t>()( x.v );
+    }
+
+    template<class Archive> void serialize( Archive& ar, unsigned )
+    {
+        ar & v;
+    }
+};
+
+namespace boost
+{
+namespace serialization
+{
+
+template<> struct is_bitwise_serializable< key<true> >: std::true_type
+{
+};
+
+} // namespace serialization
+} // namespace boost
+
+template<bool Bitwise> using map_type = boost::unordered_flat_map<key<Bitwise>, std::uint64_t>;
+
+static map_type<false> map1;
+static map_type<true> map2;
+
+static void init()
+{
+    boost::detail::splitmix64 rng;
+
+    indices.reserve( N );
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        indices.push_back( rng() );
+        map1.emplace( key<false>{ indices[ i ] }, i );
+        map2.emplace( key<true>{ indices[ i ] }, i );
+    }
+}
+
+template<class Map> BOOST_NOINLINE void test_lookup( Map const& m, std::chrono::steady_clock::time_point & t1 )
+{
+    std::uint64_t s = 0;
+
+    for( unsigned i = 0; i < M; ++i )
+    {
+        auto it = m.find( { indices[ i * ( N / M ) ] } );
+        if( it != m.end() ) s += it->second;
+    }
+
+    print_time( t1, "Lookup", s, m.size() );
+}
+
+template<class Map> BOOST_NOINLINE void test_archive( Map const& map, std::chrono::steady_clock::time_point & t1 )
+{
+    std::stringstream ss;
+
+    {
+        boost::archive::binary_oarchive oa( ss );
+        oa << map;
+    }
+
+    print_time( t1, "Save", 0, map.size() );
+
+    Map m2;
+
+    {
+        boost::archive::binary_iarchive ia( ss );
+        ia >> m2;
+    }
+
+    print_time( t1, "Load", 0, m2.size() );
+
+    test_lookup( m2, t1 );
+}
+
+struct record
+{
+    std::string label_;
+    long long time_;
+};
+
+static std::vector<record> times;
+
+template<class F> BOOST_NOINLINE void test( char const* label, F f )
+{
+    std::cout << label << ":\n\n";
+
+    auto t0 = std::chrono::steady_clock::now();
+    auto t1 = t0;
+
+    f( t1 );
+
+    times.push_back( { label, ( t1 - t0 ) / 1ms } );
+
+    std::cout << std::endl;
+}
+
+int main()
+{
+    init();
+
+    test( "Element-wise", []( std::chrono::steady_clock::time_point & t1 ){ test_archive( map1, t1 ); } );
+    test( "Bulk", []( std::chrono::steady_clock::time_point & t1 ){ test_archive( map2, t1 ); } );
+
+    std::cout << "---\n\n";
+
+    for( auto const& x: times )
+    {
+        std::cout << std::setw( 20 ) << ( x.label_ + ": " ) << std::setw( 5 ) << x.time_ << " ms\n";
+    }
+}
@@ -0,0 +1,198 @@
+// Copyright 2021 Peter Dimov.
+// Copyright 2024 Joaquin M Lopez Munoz.
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Measures steady insert/erase churn at constant size on a
+// boost::unordered_flat_map filled up to 95% of its maximum load. Erasures lower the
+// maximum load to keep probe lengths in check, which makes the table "full"
+// again at the same size; this used to trigger a rehash into arrays of the
+// same capacity, and now compacts the overflow bits in place instead.
+
+#define _SILENCE_CXX17_OLD_ALLOCATOR_MEMBERS_DEPRECATION_WARNING
+#define _SILENCE_CXX20_CISO646_REMOVED_WARNING
+
+#define BOOST_UNORDERED_ENABLE_STATS
+
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+static void print_time( std::chrono::steady_clock::time_point & t1, char const* label, std::uint64_t s, std::size_t size )
+{
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << label << ": " << ( t2 - t1 ) / 1ms << " ms (s=" << s << ", size=" << size << ")\n";
+
+    t1 = t2;
+}
+
+static std::size_t num_allocations = 0;
+
+template<class T> struct counting_allocator
+{
+    using value_type = T;
+
+    counting_allocator() = default;
+    template<class U> counting_allocator( counting_allocator<U> const& ) noexcept {}
+
+    T* allocate( std::size_t n )
+    {
+        ++num_allocations;
+        return std::allocator<T>().allocate( n );
+    }
+
+    void deallocate( T* p, std::size_t n ) noexcept
+    {
+        std::allocator<T>().deallocate( p, n );
+    }
+
+    bool operator==( counting_allocator const& ) const noexcept { return true; }
+    bool operator!=( counting_allocator const& ) const noexcept { return false; }
+};
+
+constexpr unsigned N = 2'000'000;
+constexpr int K = 10;
+
+static std::vector<std::uint64_t> indices1, indices2;
+
+static void init_indices()
+{
+    indices1.reserve( N );
+    indices2.reserve( N );
+
+    boost::detail::splitmix64 rng;
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        indices1.push_back( rng() );
+        indices2.push_back( rng() ); // almost certainly not in indices1
+    }
+}
+
+using map_type = boost::unordered_flat_map<std::uint64_t, std::uint32_t,
+    boost::hash<std::uint64_t>, std::equal_to<std::uint64_t>,
+    counting_allocator<std::pair<std::uint64_t const, std::uint32_t>>>;
+
+template<class Map> BOOST_NOINLINE void test_insert( Map& map, std::chrono::steady_clock::time_point & t1 )
+{
+    map.rehash( N / 2 );
+
+    std::size_t const size = map.max_load() / 20 * 19;
+
+    for( unsigned i = 0; i < N && map.size() < size; ++i )
+    {
+        map.insert( { indices1[ i ], i } );
+    }
+
+    print_time( t1, "Insert", 0, map.size() );
+}
+
+template<class Map> BOOST_NOINLINE void test_churn( Map& map, std::chrono::steady_clock::time_point & t1 )
+{
+    // erase a random element and insert a new one, K times the size
+
+    boost::detail::splitmix64 rng;
+
+    std::size_t const size = map.size();
+    std::uint64_t key = 0;
+
+    for( int j = 0; j < K; ++j )
+    {
+        for( unsigned i = 0; i < size; ++i )
+        {
+            auto& x = indices1[ rng() % size ];
+
+            map.erase( x );
+            x = rng();
+            map.insert( { x, i } );
+            key += x;
+        }
+    }
+
+    print_time( t1, "Churn", key, map.size() );
+}
+
+template<class Map> BOOST_NOINLINE void test_lookup( Map& map, std::chrono::steady_clock::time_point & t1 )
+{
+    std::uint64_t s;
+
+    s = 0;
+
+    for( unsigned i = 0; i < map.size(); ++i )
+    {
+        auto it = map.find( indices1[ i ] );
+        if( it != map.end() ) s += it->second;
+    }
+
+    print_time( t1, "Successful lookup", s, map.size() );
+
+    s = 0;
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        auto it = map.find( indices2[ i ] );
+        if( it != map.end() ) s += it->second;
+    }
+
+    print_time( t1, "Unsuccessful lookup", s, map.size() );
+}
+
+static void print_stats( map_type const& map )
+{
+    auto stats = map.get_stats();
+
+    std::cout << std::setw( 24 ) << "max load: " << map.max_load()
+                  << ", bucket count " << map.bucket_count() << "\n"
+              << std::setw( 24 ) << "insertion: "
+                  << "probe length " << stats.insertion.probe_length.average << "\n"
+              << std::setw( 24 ) << "successful lookup: "
+                  << "probe length " << stats.successful_lookup.probe_length.average
+                  << ", num comparisons " << stats.successful_lookup.num_comparisons.average << "\n"
+              << std::setw( 24 ) << "unsuccessful lookup: "
+                  << "probe length " << stats.unsuccessful_lookup.probe_length.average
+                  << ", num comparisons " << stats.unsuccessful_lookup.num_comparisons.average << "\n\n";
+}
+
+int main()
+{
+    init_indices();
+
+    map_type map;
+
+    auto t0 = std::chrono::steady_clock::now();
+    auto t1 = t0;
+
+    test_insert( map, t1 );
+
+    std::size_t allocations = num_allocations;
+
+    map.reset_stats();
+    test_churn( map, t1 );
+
+    std::cout << "Allocations during churn: " << num_allocations - allocations << "\n";
+
+    test_lookup( map, t1 );
+
+    auto tN = std::chrono::steady_clock::now();
+    std::cout << "Total: " << ( tN - t0 ) / 1ms << " ms\n\n";
+
+    print_stats( map );
+
+    map.compact();
+    map.reset_stats();
+    test_lookup( map, t1 );
+
+    std::cout << "After compact():\n\n";
+
+    print_stats( map );
+}
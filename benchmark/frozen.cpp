@@ -0,0 +1,147 @@
+// Copyright 2021 Peter Dimov.
+// Copyright 2024 Joaquin M Lopez Munoz.
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Lookup in a boost::unordered_flat_map reserved for its final size vs. a
+// boost::frozen_flat_map built from it, for successful and unsuccessful
+// lookups.
+
+#define _SILENCE_CXX17_OLD_ALLOCATOR_MEMBERS_DEPRECATION_WARNING
+#define _SILENCE_CXX20_CISO646_REMOVED_WARNING
+
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <boost/unordered/frozen_flat_map.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+static void print_time( std::chrono::steady_clock::time_point & t1, char const* label, std::uint64_t s, std::size_t size )
+{
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << label << ": " << ( t2 - t1 ) / 1ms << " ms (s=" << s << ", size=" << size << ")\n";
+
+    t1 = t2;
+}
+
+#ifndef BENCHMARK_SIZE
+# define BENCHMARK_SIZE 5'000'000
+#endif
+
+constexpr unsigned N = BENCHMARK_SIZE;
+constexpr int K = 10;
+
+static std::vector< std::uint64_t > indices1, indices2;
+
+using map_type = boost::unordered_flat_map<std::uint64_t, std::uint64_t>;
+using frozen_type = boost::frozen_flat_map<std::uint64_t, std::uint64_t>;
+
+static map_type map;
+
+static void init()
+{
+    boost::detail::splitmix64 rng;
+
+    indices1.reserve( N );
+    indices2.reserve( N );
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        indices1.push_back( rng() );
+        indices2.push_back( rng() );
+    }
+
+    map.reserve( N );
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        map.emplace( indices1[ i ], i );
+    }
+}
+
+template<class Map> BOOST_NOINLINE void test_lookup( Map const& m, std::chrono::steady_clock::time_point & t1 )
+{
+    std::uint64_t s;
+
+    s = 0;
+
+    for( int j = 0; j < K; ++j )
+    {
+        for( unsigned i = 0; i < N; ++i )
+        {
+            auto it = m.find( indices1[ i ] );
+            if( it != m.end() ) s += it->second;
+        }
+    }
+
+    print_time( t1, "Successful lookup", s, m.size() );
+
+    s = 0;
+
+    for( int j = 0; j < K; ++j )
+    {
+        for( unsigned i = 0; i < N; ++i )
+        {
+            auto it = m.find( indices2[ i ] );
+            if( it != m.end() ) s += it->second;
+        }
+    }
+
+    print_time( t1, "Unsuccessful lookup", s, m.size() );
+
+    std::cout << "Buckets: " << m.bucket_count() << " (load factor " << m.load_factor() << ")\n";
+}
+
+struct record
+{
+    std::string label_;
+    long long time_;
+};
+
+static std::vector<record> times;
+
+template<class F> BOOST_NOINLINE void test( char const* label, F f )
+{
+    std::cout << label << ":\n\n";
+
+    auto t0 = std::chrono::steady_clock::now();
+    auto t1 = t0;
+
+    f( t1 );
+
+    times.push_back( { label, ( t1 - t0 ) / 1ms } );
+
+    std::cout << std::endl;
+}
+
+int main()
+{
+    init();
+
+    test( "unordered_flat_map", []( std::chrono::steady_clock::time_point & t1 ){ test_lookup( map, t1 ); } );
+
+    test( "frozen_flat_map", []( std::chrono::steady_clock::time_point & t1 )
+    {
+        frozen_type frozen( map );
+
+        print_time( t1, "Construction", 0, frozen.size() );
+
+        test_lookup( frozen, t1 );
+    });
+
+    std::cout << "---\n\n";
+
+    for( auto const& x: times )
+    {
+        std::cout << std::setw( 25 ) << ( x.label_ + ": " ) << std::setw( 5 ) << x.time_ << " ms\n";
+    }
+}
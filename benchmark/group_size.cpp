@@ -0,0 +1,191 @@
+// Copyright 2021 Peter Dimov.
+// Copyright 2023-2024 Joaquin M Lopez Munoz.
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Compares probe lengths and throughput of the metadata group selected by
+// BOOST_UNORDERED_GROUP_SIZE. Build once per group size and compare outputs:
+//
+//   g++ -O3 -std=c++17 group_size.cpp                                  (group15)
+//   g++ -O3 -std=c++17 -mavx2 -DBOOST_UNORDERED_GROUP_SIZE=31 group_size.cpp
+//   g++ -O3 -std=c++17 -mavx512bw -DBOOST_UNORDERED_GROUP_SIZE=63 group_size.cpp
+//
+// Probe lengths are measured in groups visited, so for wider groups the
+// same figure means fewer slots checked per probe step.
+
+#define _SILENCE_CXX17_OLD_ALLOCATOR_MEMBERS_DEPRECATION_WARNING
+#define _SILENCE_CXX20_CISO646_REMOVED_WARNING
+
+#define BOOST_UNORDERED_ENABLE_STATS
+
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <vector>
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+static void print_time( std::chrono::steady_clock::time_point & t1, char const* label, std::uint64_t s, std::size_t size )
+{
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << label << ": " << ( t2 - t1 ) / 1ms << " ms (s=" << s << ", size=" << size << ")\n";
+
+    t1 = t2;
+}
+
+constexpr unsigned N = 1'000'000;
+constexpr int K = 5;
+
+static std::vector<std::uint64_t> indices1, indices2;
+
+static void init_indices()
+{
+    indices1.reserve( N );
+    indices2.reserve( N );
+
+    boost::detail::splitmix64 rng;
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        indices1.push_back( rng() );
+        indices2.push_back( rng() ); // almost certainly not in indices1
+    }
+}
+
+template<class Map> BOOST_NOINLINE void test_insert( Map& map, std::chrono::steady_clock::time_point & t1 )
+{
+    for( unsigned i = 0; i < N; ++i )
+    {
+        map.insert( { indices1[ i ], i } );
+    }
+
+    print_time( t1, "Insert", 0, map.size() );
+
+    std::cout << std::endl;
+}
+
+template<class Map> BOOST_NOINLINE void test_lookup( Map& map, std::chrono::steady_clock::time_point & t1 )
+{
+    std::uint64_t s;
+
+    s = 0;
+
+    for( int j = 0; j < K; ++j )
+    {
+        for( unsigned i = 0; i < N; ++i )
+        {
+            auto it = map.find( indices1[ i ] );
+            if( it != map.end() ) s += it->second;
+        }
+    }
+
+    print_time( t1, "Successful lookup", s, map.size() );
+
+    s = 0;
+
+    for( int j = 0; j < K; ++j )
+    {
+        for( unsigned i = 0; i < N; ++i )
+        {
+            auto it = map.find( indices2[ i ] );
+            if( it != map.end() ) s += it->second;
+        }
+    }
+
+    print_time( t1, "Unsuccessful lookup", s, map.size() );
+
+    std::cout << std::endl;
+}
+
+template<class Map> BOOST_NOINLINE void test_erase( Map& map, std::chrono::steady_clock::time_point & t1 )
+{
+    for( unsigned i = 0; i < N; ++i )
+    {
+        map.erase( indices1[ i ] );
+    }
+
+    print_time( t1, "Erase", 0, map.size() );
+
+    std::cout << std::endl;
+}
+
+//
+
+using stats = boost::unordered_flat_map<int, int>::stats;
+
+struct record
+{
+    std::string label_;
+    long long time_;
+    stats stats_;
+};
+
+static std::vector<record> records;
+
+template<class Map> BOOST_NOINLINE void test( char const* label )
+{
+    std::cout << label << ":\n\n";
+
+    Map map;
+
+    auto t0 = std::chrono::steady_clock::now();
+    auto t1 = t0;
+
+    test_insert( map, t1 );
+    test_lookup( map, t1 );
+
+    record rec = { label, 0 };
+    rec.stats_ = map.get_stats();
+
+    test_erase( map, t1 );
+
+    auto tN = std::chrono::steady_clock::now();
+    std::cout << "Total: " << ( tN - t0 ) / 1ms << " ms\n\n";
+
+    rec.time_ = ( tN - t0 ) / 1ms;
+    records.push_back( rec );
+}
+
+// hash concentrating positions on a fraction of the groups,
+// stresses probe sequences
+
+struct weak_hash
+{
+    using is_avalanching = std::true_type;
+
+    std::size_t operator()( std::uint64_t x ) const
+    {
+        return static_cast<std::size_t>( x >> 1 );
+    }
+};
+
+int main()
+{
+    init_indices();
+
+    std::cout << "Group size: " << BOOST_UNORDERED_GROUP_SIZE << "\n\n";
+
+    test< boost::unordered_flat_map<std::uint64_t, std::uint32_t> >( "boost::unordered_flat_map" );
+    test< boost::unordered_flat_map<std::uint64_t, std::uint32_t, weak_hash> >( "boost::unordered_flat_map, weak_hash" );
+
+    std::cout << "---\n\n";
+
+    for( auto const& x: records )
+    {
+        std::cout << std::setw( 46 ) << ( x.label_ + ": " ) << std::setw( 5 ) << x.time_ << " ms\n"
+                  << std::setw( 46 ) << "insertion: "
+                      << "probe length " << x.stats_.insertion.probe_length.average << "\n"
+                  << std::setw( 46 ) << "successful lookup: "
+                      << "probe length " << x.stats_.successful_lookup.probe_length.average
+                      << ", num comparisons " << x.stats_.successful_lookup.num_comparisons.average << "\n"
+                  << std::setw( 46 ) << "unsuccessful lookup: "
+                      << "probe length " << x.stats_.unsuccessful_lookup.probe_length.average
+                      << ", num comparisons " << x.stats_.unsuccessful_lookup.num_comparisons.average << "\n\n";
+    }
+}
@@ -0,0 +1,151 @@
+// Copyright 2021 Peter Dimov.
+// Copyright 2024 Joaquin M Lopez Munoz.
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Random lookups on a 1GB+ boost::unordered_flat_map, with the default
+// allocator and with boost::unordered::huge_page_allocator (huge pages are
+// used on Linux if transparent huge pages are enabled in "madvise" or
+// "always" mode). Insertion after reserve() is measured with and without
+// a prior call to prefault().
+
+#define _SILENCE_CXX17_OLD_ALLOCATOR_MEMBERS_DEPRECATION_WARNING
+#define _SILENCE_CXX20_CISO646_REMOVED_WARNING
+
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <boost/unordered/huge_page_allocator.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+static void print_time( std::chrono::steady_clock::time_point & t1, char const* label, std::uint64_t s, std::size_t size )
+{
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << label << ": " << ( t2 - t1 ) / 1ms << " ms (s=" << s << ", size=" << size << ")\n";
+
+    t1 = t2;
+}
+
+#ifndef BENCHMARK_SIZE
+# define BENCHMARK_SIZE 40'000'000
+#endif
+
+constexpr unsigned N = BENCHMARK_SIZE; // ~1GB of bucket array for the default size
+constexpr int K = 3;
+
+static std::vector< std::uint64_t > indices;
+
+static void init_indices()
+{
+    boost::detail::splitmix64 rng;
+
+    indices.reserve( N );
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        indices.push_back( rng() );
+    }
+}
+
+template<class Map> BOOST_NOINLINE void test_reserve( Map& map, bool prefault, std::chrono::steady_clock::time_point & t1 )
+{
+    map.reserve( N );
+
+    print_time( t1, "Reserve", 0, map.size() );
+
+    if( prefault )
+    {
+        map.prefault();
+
+        print_time( t1, "Prefault", 0, map.size() );
+    }
+}
+
+template<class Map> BOOST_NOINLINE void test_insert( Map& map, std::chrono::steady_clock::time_point & t1 )
+{
+    for( unsigned i = 0; i < N; ++i )
+    {
+        map.emplace( indices[ i ], i );
+    }
+
+    print_time( t1, "Insert", 0, map.size() );
+}
+
+template<class Map> BOOST_NOINLINE void test_lookup( Map& map, std::chrono::steady_clock::time_point & t1 )
+{
+    std::uint64_t s = 0;
+
+    for( int j = 0; j < K; ++j )
+    {
+        for( unsigned i = 0; i < N; ++i )
+        {
+            auto it = map.find( indices[ i ] );
+            if( it != map.end() ) s += it->second;
+        }
+    }
+
+    print_time( t1, "Random lookup", s, map.size() );
+}
+
+struct record
+{
+    std::string label_;
+    long long time_;
+};
+
+static std::vector<record> times;
+
+template<class Map> BOOST_NOINLINE void test( char const* label, bool prefault )
+{
+    std::cout << label << ":\n\n";
+
+    auto t0 = std::chrono::steady_clock::now();
+    auto t1 = t0;
+
+    {
+        Map map;
+
+        test_reserve( map, prefault, t1 );
+        test_insert( map, t1 );
+
+        auto t2 = t1;
+        test_lookup( map, t1 );
+
+        times.push_back( { label, ( t1 - t2 ) / 1ms } );
+    }
+
+    print_time( t1, "Destruction", 0, 0 );
+
+    std::cout << std::endl;
+}
+
+template<class T> using huge_page_allocator = boost::unordered::huge_page_allocator<T>;
+
+int main()
+{
+    init_indices();
+
+    using map_type = boost::unordered_flat_map<std::uint64_t, std::uint64_t>;
+    using huge_map_type = boost::unordered_flat_map<std::uint64_t, std::uint64_t, boost::hash<std::uint64_t>, std::equal_to<std::uint64_t>, huge_page_allocator<std::pair<const std::uint64_t, std::uint64_t>>>;
+
+    test<map_type>( "boost::unordered_flat_map", false );
+    test<map_type>( "boost::unordered_flat_map, prefault", true );
+    test<huge_map_type>( "huge_page_allocator", false );
+    test<huge_map_type>( "huge_page_allocator, prefault", true );
+
+    std::cout << "---\n\n";
+
+    for( auto const& x: times )
+    {
+        std::cout << std::setw( 40 ) << ( x.label_ + ": " ) << std::setw( 5 ) << x.time_ << " ms\n";
+    }
+}
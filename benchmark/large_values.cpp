@@ -0,0 +1,160 @@
+// Copyright 2021 Peter Dimov.
+// Copyright 2024 Joaquin M Lopez Munoz.
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Lookup throughput of maps with 8-byte keys and 200-byte mapped values.
+
+#define _SILENCE_CXX17_OLD_ALLOCATOR_MEMBERS_DEPRECATION_WARNING
+#define _SILENCE_CXX20_CISO646_REMOVED_WARNING
+
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <boost/unordered/unordered_node_map.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <unordered_map>
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+static void print_time( std::chrono::steady_clock::time_point & t1, char const* label, std::uint64_t s, std::size_t size )
+{
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << label << ": " << ( t2 - t1 ) / 1ms << " ms (s=" << s << ", size=" << size << ")\n";
+
+    t1 = t2;
+}
+
+constexpr unsigned N = 1'000'000;
+constexpr int K = 10;
+
+struct payload
+{
+    std::uint64_t x;
+    std::array<char, 192> data;
+};
+
+static std::vector< std::uint64_t > indices1, indices2;
+
+static void init_indices()
+{
+    boost::detail::splitmix64 rng;
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        indices1.push_back( rng() );
+    }
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        indices2.push_back( rng() );
+    }
+}
+
+template<class Map> BOOST_NOINLINE void test_insert( Map& map, std::chrono::steady_clock::time_point & t1 )
+{
+    for( unsigned i = 0; i < N; ++i )
+    {
+        map.emplace( indices1[ i ], payload{ i, {} } );
+    }
+
+    print_time( t1, "Insert", 0, map.size() );
+
+    std::cout << std::endl;
+}
+
+template<class Map> BOOST_NOINLINE void test_lookup( Map& map, std::chrono::steady_clock::time_point & t1 )
+{
+    std::uint64_t s;
+
+    s = 0;
+
+    for( int j = 0; j < K; ++j )
+    {
+        for( unsigned i = 0; i < N; ++i )
+        {
+            auto it = map.find( indices1[ i ] );
+            if( it != map.end() ) s += it->second.x;
+        }
+    }
+
+    print_time( t1, "Successful lookup", s, map.size() );
+
+    s = 0;
+
+    for( int j = 0; j < K; ++j )
+    {
+        for( unsigned i = 0; i < N; ++i )
+        {
+            s += map.count( indices1[ i ] );
+        }
+    }
+
+    print_time( t1, "Successful count", s, map.size() );
+
+    s = 0;
+
+    for( int j = 0; j < K; ++j )
+    {
+        for( unsigned i = 0; i < N; ++i )
+        {
+            auto it = map.find( indices2[ i ] );
+            if( it != map.end() ) s += it->second.x;
+        }
+    }
+
+    print_time( t1, "Unsuccessful lookup", s, map.size() );
+
+    std::cout << std::endl;
+}
+
+struct record
+{
+    std::string label_;
+    long long time_;
+};
+
+static std::vector<record> times;
+
+template<class Map> BOOST_NOINLINE void test( char const* label )
+{
+    std::cout << label << ":\n\n";
+
+    Map map;
+
+    auto t0 = std::chrono::steady_clock::now();
+    auto t1 = t0;
+
+    test_insert( map, t1 );
+
+    record rec = { label, 0 };
+
+    t0 = t1;
+    test_lookup( map, t1 );
+    rec.time_ = ( t1 - t0 ) / 1ms;
+
+    times.push_back( rec );
+}
+
+int main()
+{
+    init_indices();
+
+    test<boost::unordered_flat_map<std::uint64_t, payload>>( "boost::unordered_flat_map" );
+    test<boost::unordered_node_map<std::uint64_t, payload>>( "boost::unordered_node_map" );
+    test<std::unordered_map<std::uint64_t, payload>>( "std::unordered_map" );
+
+    std::cout << "---\n\n";
+
+    for( auto const& x: times )
+    {
+        std::cout << std::setw( 30 ) << ( x.label_ + ": " ) << std::setw( 5 ) << x.time_ << " ms\n";
+    }
+}
@@ -0,0 +1,155 @@
+// Copyright 2021 Peter Dimov.
+// Copyright 2023-2024 Joaquin M Lopez Munoz.
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Measures the effect of max_load_factor on probe lengths and throughput of
+// boost::unordered_flat_map for successful and (miss-heavy) unsuccessful
+// lookups. All maps have the same bucket count and are filled up to their
+// maximum load, so that lower max load factors mean fewer elements.
+
+#define _SILENCE_CXX17_OLD_ALLOCATOR_MEMBERS_DEPRECATION_WARNING
+#define _SILENCE_CXX20_CISO646_REMOVED_WARNING
+
+#define BOOST_UNORDERED_ENABLE_STATS
+
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <vector>
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+static void print_time( std::chrono::steady_clock::time_point & t1, char const* label, std::uint64_t s, std::size_t size )
+{
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << label << ": " << ( t2 - t1 ) / 1ms << " ms (s=" << s << ", size=" << size << ")\n";
+
+    t1 = t2;
+}
+
+constexpr unsigned N = 2'000'000;
+constexpr int K = 10;
+
+static std::vector<std::uint64_t> indices1, indices2;
+
+static void init_indices()
+{
+    indices1.reserve( N );
+    indices2.reserve( N );
+
+    boost::detail::splitmix64 rng;
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        indices1.push_back( rng() );
+        indices2.push_back( rng() ); // almost certainly not in indices1
+    }
+}
+
+using map_type = boost::unordered_flat_map<std::uint64_t, std::uint32_t>;
+
+template<class Map> BOOST_NOINLINE void test_insert( Map& map, std::chrono::steady_clock::time_point & t1 )
+{
+    map.rehash( N / 2 );
+
+    for( unsigned i = 0; i < N && map.size() < map.max_load(); ++i )
+    {
+        map.insert( { indices1[ i ], i } );
+    }
+
+    print_time( t1, "Insert", 0, map.size() );
+}
+
+template<class Map> BOOST_NOINLINE void test_lookup( Map& map, std::chrono::steady_clock::time_point & t1 )
+{
+    std::uint64_t s;
+
+    s = 0;
+
+    for( int j = 0; j < K; ++j )
+    {
+        for( unsigned i = 0; i < map.size(); ++i )
+        {
+            auto it = map.find( indices1[ i ] );
+            if( it != map.end() ) s += it->second;
+        }
+    }
+
+    print_time( t1, "Successful lookup", s, map.size() );
+
+    s = 0;
+
+    for( int j = 0; j < K; ++j )
+    {
+        for( unsigned i = 0; i < N; ++i )
+        {
+            auto it = map.find( indices2[ i ] );
+            if( it != map.end() ) s += it->second;
+        }
+    }
+
+    print_time( t1, "Unsuccessful lookup", s, map.size() );
+}
+
+struct record
+{
+    float mlf_;
+    long long time_;
+    float load_factor_;
+    std::size_t bucket_count_;
+    map_type::stats stats_;
+};
+
+static std::vector<record> records;
+
+static void test( float mlf )
+{
+    std::cout << "max_load_factor " << mlf << ":\n\n";
+
+    map_type map;
+    map.max_load_factor( mlf );
+
+    auto t0 = std::chrono::steady_clock::now();
+    auto t1 = t0;
+
+    test_insert( map, t1 );
+    map.reset_stats();
+    test_lookup( map, t1 );
+
+    auto tN = std::chrono::steady_clock::now();
+    std::cout << "Total: " << ( tN - t0 ) / 1ms << " ms\n\n";
+
+    records.push_back( { mlf, ( tN - t0 ) / 1ms, map.load_factor(), map.bucket_count(), map.get_stats() } );
+}
+
+int main()
+{
+    init_indices();
+
+    for( float mlf: { 0.5f, 0.625f, 0.75f, 0.875f, 0.95f } )
+    {
+        test( mlf );
+    }
+
+    std::cout << "---\n\n";
+
+    for( auto const& x: records )
+    {
+        std::cout << std::setw( 32 ) << "max_load_factor " << x.mlf_ << ": " << std::setw( 5 ) << x.time_ << " ms\n"
+                  << std::setw( 32 ) << "load factor: " << x.load_factor_
+                      << ", bucket count " << x.bucket_count_ << "\n"
+                  << std::setw( 32 ) << "successful lookup: "
+                      << "probe length " << x.stats_.successful_lookup.probe_length.average
+                      << ", num comparisons " << x.stats_.successful_lookup.num_comparisons.average << "\n"
+                  << std::setw( 32 ) << "unsuccessful lookup: "
+                      << "probe length " << x.stats_.unsuccessful_lookup.probe_length.average
+                      << ", num comparisons " << x.stats_.unsuccessful_lookup.num_comparisons.average << "\n\n";
+    }
+}
@@ -0,0 +1,166 @@
+// Copyright 2021 Peter Dimov.
+// Copyright 2024 Joaquin M Lopez Munoz.
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Copy construction and copy assignment of a large container, sequential
+// and with the overloads taking std::execution::par.
+
+#define _SILENCE_CXX17_OLD_ALLOCATOR_MEMBERS_DEPRECATION_WARNING
+#define _SILENCE_CXX20_CISO646_REMOVED_WARNING
+
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <boost/unordered/unordered_node_map.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <execution>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+static void print_time( std::chrono::steady_clock::time_point & t1, char const* label, std::uint64_t s, std::size_t size )
+{
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << label << ": " << ( t2 - t1 ) / 1ms << " ms (s=" << s << ", size=" << size << ")\n";
+
+    t1 = t2;
+}
+
+#ifndef BENCHMARK_SIZE
+# define BENCHMARK_SIZE 10'000'000
+#endif
+
+constexpr unsigned N = BENCHMARK_SIZE;
+constexpr int K = 3;
+
+static std::vector< std::uint64_t > indices;
+
+static void init_indices()
+{
+    boost::detail::splitmix64 rng;
+
+    indices.reserve( N );
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        indices.push_back( rng() );
+    }
+}
+
+template<class Map> BOOST_NOINLINE void test_insert( Map& map, std::chrono::steady_clock::time_point & t1 )
+{
+    for( unsigned i = 0; i < N; ++i )
+    {
+        map.emplace( indices[ i ], i );
+    }
+
+    print_time( t1, "Insert", 0, map.size() );
+}
+
+struct sequential {};
+
+template<class Map> Map do_copy( Map const& map, sequential )
+{
+    return Map( map );
+}
+
+template<class Map, class Policy> Map do_copy( Map const& map, Policy const& policy )
+{
+    return Map( policy, map );
+}
+
+template<class Map> void do_assign( Map& map, Map const& src, sequential )
+{
+    map = src;
+}
+
+template<class Map, class Policy> void do_assign( Map& map, Map const& src, Policy const& policy )
+{
+    map.assign( policy, src );
+}
+
+template<class Map, class Policy> BOOST_NOINLINE void test_copy( Map const& map, Policy const& policy, std::chrono::steady_clock::time_point & t1 )
+{
+    std::size_t s = 0;
+
+    for( int j = 0; j < K; ++j )
+    {
+        Map map2 = do_copy( map, policy );
+        s += map2.size();
+    }
+
+    print_time( t1, "Copy construction", s, map.size() );
+}
+
+template<class Map, class Policy> BOOST_NOINLINE void test_assign( Map const& map, Policy const& policy, std::chrono::steady_clock::time_point & t1 )
+{
+    std::size_t s = 0;
+    Map map2;
+
+    for( int j = 0; j < K; ++j )
+    {
+        do_assign( map2, map, policy );
+        s += map2.size();
+    }
+
+    print_time( t1, "Copy assignment", s, map.size() );
+}
+
+struct record
+{
+    std::string label_;
+    long long time_;
+};
+
+static std::vector<record> times;
+
+template<class Map, class Policy> BOOST_NOINLINE void test( char const* label, Policy const& policy )
+{
+    std::cout << label << ":\n\n";
+
+    auto t0 = std::chrono::steady_clock::now();
+    auto t1 = t0;
+
+    {
+        Map map;
+
+        test_insert( map, t1 );
+
+        auto t2 = t1;
+        test_copy( map, policy, t1 );
+        test_assign( map, policy, t1 );
+
+        times.push_back( { label, ( t1 - t2 ) / 1ms } );
+    }
+
+    print_time( t1, "Destruction", 0, 0 );
+
+    std::cout << std::endl;
+}
+
+int main()
+{
+    init_indices();
+
+    using flat_map_type = boost::unordered_flat_map<std::uint64_t, std::uint64_t>;
+    using node_map_type = boost::unordered_node_map<std::uint64_t, std::uint64_t>;
+
+    test<flat_map_type>( "boost::unordered_flat_map", sequential() );
+    test<flat_map_type>( "boost::unordered_flat_map, par", std::execution::par );
+    test<node_map_type>( "boost::unordered_node_map", sequential() );
+    test<node_map_type>( "boost::unordered_node_map, par", std::execution::par );
+
+    std::cout << "---\n\n";
+
+    for( auto const& x: times )
+    {
+        std::cout << std::setw( 40 ) << ( x.label_ + ": " ) << std::setw( 5 ) << x.time_ << " ms\n";
+    }
+}
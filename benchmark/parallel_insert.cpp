@@ -0,0 +1,129 @@
+// Copyright 2021 Peter Dimov.
+// Copyright 2024 Joaquin M Lopez Munoz.
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Construction of a large container from a vector of pairs, with the
+// sequential range constructor and with the range constructor taking
+// std::execution::par.
+
+#define _SILENCE_CXX17_OLD_ALLOCATOR_MEMBERS_DEPRECATION_WARNING
+#define _SILENCE_CXX20_CISO646_REMOVED_WARNING
+
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <boost/unordered/unordered_node_map.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <execution>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+static void print_time( std::chrono::steady_clock::time_point & t1, char const* label, std::uint64_t s, std::size_t size )
+{
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << label << ": " << ( t2 - t1 ) / 1ms << " ms (s=" << s << ", size=" << size << ")\n";
+
+    t1 = t2;
+}
+
+#ifndef BENCHMARK_SIZE
+# define BENCHMARK_SIZE 10'000'000
+#endif
+
+constexpr unsigned N = BENCHMARK_SIZE;
+
+static std::vector< std::pair< std::uint64_t, std::uint64_t > > values;
+
+static void init_values()
+{
+    boost::detail::splitmix64 rng;
+
+    values.reserve( N );
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        values.push_back( { rng(), i } );
+    }
+}
+
+struct sequential {};
+
+template<class Map> Map construct( sequential )
+{
+    return Map( values.begin(), values.end() );
+}
+
+template<class Map, class Policy> Map construct( Policy const& policy )
+{
+    return Map( policy, values.begin(), values.end() );
+}
+
+template<class Map> BOOST_NOINLINE void test_lookup( Map& map, std::chrono::steady_clock::time_point & t1 )
+{
+    std::uint64_t s = 0;
+
+    for( auto const& x: values )
+    {
+        s += map.find( x.first )->second;
+    }
+
+    print_time( t1, "Lookup", s, map.size() );
+}
+
+struct record
+{
+    std::string label_;
+    long long time_;
+};
+
+static std::vector<record> times;
+
+template<class Map, class Policy> BOOST_NOINLINE void test( char const* label, Policy const& policy )
+{
+    std::cout << label << ":\n\n";
+
+    auto t0 = std::chrono::steady_clock::now();
+    auto t1 = t0;
+
+    {
+        Map map = construct<Map>( policy );
+
+        print_time( t1, "Construction", 0, map.size() );
+
+        times.push_back( { label, ( t1 - t0 ) / 1ms } );
+
+        test_lookup( map, t1 );
+    }
+
+    print_time( t1, "Destruction", 0, 0 );
+
+    std::cout << std::endl;
+}
+
+int main()
+{
+    init_values();
+
+    using flat_map_type = boost::unordered_flat_map<std::uint64_t, std::uint64_t>;
+    using node_map_type = boost::unordered_node_map<std::uint64_t, std::uint64_t>;
+
+    test<flat_map_type>( "boost::unordered_flat_map", sequential() );
+    test<flat_map_type>( "boost::unordered_flat_map, par", std::execution::par );
+    test<node_map_type>( "boost::unordered_node_map", sequential() );
+    test<node_map_type>( "boost::unordered_node_map, par", std::execution::par );
+
+    std::cout << "---\n\n";
+
+    for( auto const& x: times )
+    {
+        std::cout << std::setw( 40 ) << ( x.label_ + ": " ) << std::setw( 5 ) << x.time_ << " ms\n";
+    }
+}
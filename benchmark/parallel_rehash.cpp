@@ -0,0 +1,138 @@
+// Copyright 2021 Peter Dimov.
+// Copyright 2024 Joaquin M Lopez Munoz.
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Growth of a large container by successive doublings of its bucket array,
+// with sequential rehash(n) and with rehash(std::execution::par, n).
+
+#define _SILENCE_CXX17_OLD_ALLOCATOR_MEMBERS_DEPRECATION_WARNING
+#define _SILENCE_CXX20_CISO646_REMOVED_WARNING
+
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <boost/unordered/unordered_node_map.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <execution>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+static void print_time( std::chrono::steady_clock::time_point & t1, char const* label, std::uint64_t s, std::size_t size )
+{
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << label << ": " << ( t2 - t1 ) / 1ms << " ms (s=" << s << ", size=" << size << ")\n";
+
+    t1 = t2;
+}
+
+#ifndef BENCHMARK_SIZE
+# define BENCHMARK_SIZE 10'000'000
+#endif
+
+constexpr unsigned N = BENCHMARK_SIZE;
+constexpr int K = 3; // number of doublings
+
+static std::vector< std::uint64_t > indices;
+
+static void init_indices()
+{
+    boost::detail::splitmix64 rng;
+
+    indices.reserve( N );
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        indices.push_back( rng() );
+    }
+}
+
+template<class Map> BOOST_NOINLINE void test_insert( Map& map, std::chrono::steady_clock::time_point & t1 )
+{
+    for( unsigned i = 0; i < N; ++i )
+    {
+        map.emplace( indices[ i ], i );
+    }
+
+    print_time( t1, "Insert", 0, map.size() );
+}
+
+struct sequential {};
+
+template<class Map> void do_rehash( Map& map, std::size_t n, sequential )
+{
+    map.rehash( n );
+}
+
+template<class Map, class Policy> void do_rehash( Map& map, std::size_t n, Policy const& policy )
+{
+    map.rehash( policy, n );
+}
+
+template<class Map, class Policy> BOOST_NOINLINE void test_rehash( Map& map, Policy const& policy, std::chrono::steady_clock::time_point & t1 )
+{
+    for( int j = 0; j < K; ++j )
+    {
+        do_rehash( map, map.bucket_count() * 2, policy );
+    }
+
+    print_time( t1, "Rehash", map.bucket_count(), map.size() );
+}
+
+struct record
+{
+    std::string label_;
+    long long time_;
+};
+
+static std::vector<record> times;
+
+template<class Map, class Policy> BOOST_NOINLINE void test( char const* label, Policy const& policy )
+{
+    std::cout << label << ":\n\n";
+
+    auto t0 = std::chrono::steady_clock::now();
+    auto t1 = t0;
+
+    {
+        Map map;
+
+        test_insert( map, t1 );
+
+        auto t2 = t1;
+        test_rehash( map, policy, t1 );
+
+        times.push_back( { label, ( t1 - t2 ) / 1ms } );
+    }
+
+    print_time( t1, "Destruction", 0, 0 );
+
+    std::cout << std::endl;
+}
+
+int main()
+{
+    init_indices();
+
+    using flat_map_type = boost::unordered_flat_map<std::uint64_t, std::uint64_t>;
+    using node_map_type = boost::unordered_node_map<std::uint64_t, std::uint64_t>;
+
+    test<flat_map_type>( "boost::unordered_flat_map", sequential() );
+    test<flat_map_type>( "boost::unordered_flat_map, par", std::execution::par );
+    test<node_map_type>( "boost::unordered_node_map", sequential() );
+    test<node_map_type>( "boost::unordered_node_map, par", std::execution::par );
+
+    std::cout << "---\n\n";
+
+    for( auto const& x: times )
+    {
+        std::cout << std::setw( 40 ) << ( x.label_ + ": " ) << std::setw( 5 ) << x.time_ << " ms\n";
+    }
+}
@@ -0,0 +1,218 @@
+// Copyright 2021 Peter Dimov.
+// Copyright 2024 Joaquin M Lopez Munoz.
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Loading a large boost::unordered_flat_map from disk: element by element
+// into a new container vs. mapping a snapshot image written with
+// write_snapshot and querying it in place through unordered_flat_map_view.
+
+#define _SILENCE_CXX17_OLD_ALLOCATOR_MEMBERS_DEPRECATION_WARNING
+#define _SILENCE_CXX20_CISO646_REMOVED_WARNING
+
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <boost/unordered/unordered_flat_map_view.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+
+#if defined(__unix__) || defined(__APPLE__)
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+# define BENCHMARK_HAS_MMAP
+#endif
+
+using namespace std::chrono_literals;
+
+static void print_time( std::chrono::steady_clock::time_point & t1, char const* label, std::uint64_t s, std::size_t size )
+{
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << label << ": " << ( t2 - t1 ) / 1ms << " ms (s=" << s << ", size=" << size << ")\n";
+
+    t1 = t2;
+}
+
+#ifndef BENCHMARK_SIZE
+# define BENCHMARK_SIZE 10'000'000
+#endif
+
+constexpr unsigned N = BENCHMARK_SIZE;
+constexpr unsigned M = 100'000; // lookups after loading
+
+static std::vector< std::uint64_t > indices;
+
+static char const* elements_file = "snapshot_benchmark_elements.bin";
+static char const* snapshot_file = "snapshot_benchmark_image.bin";
+
+using map_type = boost::unordered_flat_map<std::uint64_t, std::uint64_t>;
+using view_type = boost::unordered_flat_map_view<std::uint64_t, std::uint64_t>;
+
+static void init_indices()
+{
+    boost::detail::splitmix64 rng;
+
+    indices.reserve( N );
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        indices.push_back( rng() );
+    }
+}
+
+static void write_files()
+{
+    map_type map;
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        map.emplace( indices[ i ], i );
+    }
+
+    {
+        // insertion order; reinserting in iteration order would cluster
+        // the elements of the loading container
+
+        std::ofstream os( elements_file, std::ios::binary );
+
+        for( unsigned i = 0; i < N; ++i )
+        {
+            std::uint64_t kv[] = { indices[ i ], i };
+            os.write( reinterpret_cast<char const*>( kv ), sizeof( kv ) );
+        }
+    }
+
+    {
+        std::ofstream os( snapshot_file, std::ios::binary );
+        boost::unordered::write_snapshot( os, map );
+    }
+}
+
+template<class Map> BOOST_NOINLINE void test_lookup( Map const& map, std::chrono::steady_clock::time_point & t1 )
+{
+    std::uint64_t s = 0;
+
+    for( unsigned i = 0; i < M; ++i )
+    {
+        auto it = map.find( indices[ i * ( N / M ) ] );
+        if( it != map.end() ) s += it->second;
+    }
+
+    print_time( t1, "Lookup", s, map.size() );
+}
+
+BOOST_NOINLINE void test_element_wise( std::chrono::steady_clock::time_point & t1 )
+{
+    map_type map;
+
+    {
+        std::ifstream is( elements_file, std::ios::binary );
+        std::uint64_t kv[ 2 ];
+
+        while( is.read( reinterpret_cast<char*>( kv ), sizeof( kv ) ) )
+        {
+            map.emplace( kv[ 0 ], kv[ 1 ] );
+        }
+    }
+
+    print_time( t1, "Load", 0, map.size() );
+
+    test_lookup( map, t1 );
+}
+
+#if defined(BENCHMARK_HAS_MMAP)
+
+BOOST_NOINLINE void test_snapshot( std::chrono::steady_clock::time_point & t1 )
+{
+    int fd = ::open( snapshot_file, O_RDONLY );
+    struct stat st;
+    ::fstat( fd, &st );
+
+    std::size_t size = static_cast<std::size_t>( st.st_size );
+    void* p = ::mmap( nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0 );
+
+    {
+        view_type view( p, size );
+
+        print_time( t1, "Load", 0, view.size() );
+
+        test_lookup( view, t1 );
+    }
+
+    ::munmap( p, size );
+    ::close( fd );
+}
+
+#else
+
+BOOST_NOINLINE void test_snapshot( std::chrono::steady_clock::time_point & t1 )
+{
+    std::ifstream is( snapshot_file, std::ios::binary | std::ios::ate );
+    std::size_t size = static_cast<std::size_t>( is.tellg() );
+    is.seekg( 0 );
+
+    // 64-byte alignment required by unordered_flat_map_view
+
+    std::vector<char> buf( size + 64 );
+    char* p = buf.data() + ( 64 - reinterpret_cast<std::uintptr_t>( buf.data() ) % 64 ) % 64;
+    is.read( p, static_cast<std::streamsize>( size ) );
+
+    view_type view( p, size );
+
+    print_time( t1, "Load", 0, view.size() );
+
+    test_lookup( view, t1 );
+}
+
+#endif
+
+struct record
+{
+    std::string label_;
+    long long time_;
+};
+
+static std::vector<record> times;
+
+template<class F> BOOST_NOINLINE void test( char const* label, F f )
+{
+    std::cout << label << ":\n\n";
+
+    auto t0 = std::chrono::steady_clock::now();
+    auto t1 = t0;
+
+    f( t1 );
+
+    times.push_back( { label, ( t1 - t0 ) / 1ms } );
+
+    std::cout << std::endl;
+}
+
+int main()
+{
+    init_indices();
+    write_files();
+
+    test( "Element-wise load into unordered_flat_map", test_element_wise );
+    test( "unordered_flat_map_view over snapshot", test_snapshot );
+
+    std::remove( elements_file );
+    std::remove( snapshot_file );
+
+    std::cout << "---\n\n";
+
+    for( auto const& x: times )
+    {
+        std::cout << std::setw( 50 ) << ( x.label_ + ": " ) << std::setw( 5 ) << x.time_ << " ms\n";
+    }
+}
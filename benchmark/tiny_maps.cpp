@@ -0,0 +1,132 @@
+// Copyright 2021 Peter Dimov.
+// Copyright 2024 Joaquin M Lopez Munoz.
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Creates, fills, queries and destroys millions of maps with fewer than 8
+// elements each, as done by code keeping short-lived per-request maps.
+// boost::small_flat_map<K, V, 8> holds these elements inline, so it does not
+// allocate and looks keys up without hashing.
+
+#define _SILENCE_CXX17_OLD_ALLOCATOR_MEMBERS_DEPRECATION_WARNING
+#define _SILENCE_CXX20_CISO646_REMOVED_WARNING
+
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <boost/unordered/small_flat_map.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+static void print_time( std::chrono::steady_clock::time_point & t1, char const* label, std::uint64_t s, std::size_t size )
+{
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << label << ": " << ( t2 - t1 ) / 1ms << " ms (s=" << s << ", size=" << size << ")\n";
+
+    t1 = t2;
+}
+
+constexpr unsigned N = 2'000'000;
+constexpr int K = 10;
+
+static std::vector<std::string> keys;
+static std::vector<unsigned> sizes;
+
+static void init_keys()
+{
+    for( int i = 0; i < 64; ++i )
+    {
+        keys.push_back( "header_" + std::to_string( i ) );
+    }
+
+    boost::detail::splitmix64 rng;
+
+    sizes.reserve( N );
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        sizes.push_back( static_cast<unsigned>( rng() % 8 ) );
+    }
+}
+
+template<class Map> BOOST_NOINLINE void test_tiny_maps( std::chrono::steady_clock::time_point & t1 )
+{
+    std::uint64_t s = 0;
+    std::size_t size = 0;
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        Map map;
+
+        unsigned n = sizes[ i ];
+        unsigned j0 = i % 32;
+
+        for( unsigned j = 0; j < n; ++j )
+        {
+            map.emplace( keys[ j0 + j ], j );
+        }
+
+        for( unsigned j = 0; j < 8; ++j )
+        {
+            auto it = map.find( keys[ j0 + j ] );
+            if( it != map.end() ) s += it->second;
+        }
+
+        size += map.size();
+    }
+
+    print_time( t1, "Create, fill, lookup and destroy", s, size );
+
+    std::cout << std::endl;
+}
+
+struct record
+{
+    std::string label_;
+    long long time_;
+};
+
+static std::vector<record> times;
+
+template<class Map> BOOST_NOINLINE void test( char const* label )
+{
+    std::cout << label << ":\n\n";
+
+    auto t0 = std::chrono::steady_clock::now();
+    auto t1 = t0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        test_tiny_maps<Map>( t1 );
+    }
+
+    auto tN = std::chrono::steady_clock::now();
+    std::cout << "Total: " << ( tN - t0 ) / 1ms << " ms\n\n";
+
+    times.push_back( { label, ( tN - t0 ) / 1ms / K } );
+}
+
+int main()
+{
+    init_keys();
+
+    test<std::unordered_map<std::string, unsigned>>( "std::unordered_map" );
+    test<boost::unordered_flat_map<std::string, unsigned>>( "boost::unordered_flat_map" );
+    test<boost::small_flat_map<std::string, unsigned, 8>>( "boost::small_flat_map<8>" );
+
+    std::cout << "---\n\n";
+
+    for( auto const& x: times )
+    {
+        std::cout << std::setw( 30 ) << ( x.label_ + ": " ) << std::setw( 5 ) << x.time_ << " ms\n";
+    }
+}
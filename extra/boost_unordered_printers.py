@@ -201,22 +201,15 @@ class BoostUnorderedFoaPrinter:
     def children(self):
         def generator():
             table = self.val["table_"]
-            groups = self.cpo.to_address(table["arrays"]["groups_"])
-            elements = self.cpo.to_address(table["arrays"]["elements_"])
 
-            pc_ = groups.cast(gdb.lookup_type("unsigned char").pointer())
-            p_ = elements
-            first_time = True
-            mask = 0
-            n0 = 0
-            n = 0
+            # Elements not yet transferred by an incremental rehash are in old_arrays
+            all_arrays = [table["arrays"]]
+            if self.cpo.to_address(table["old_arrays"]["elements_"]) != 0:
+                all_arrays.insert(0, table["old_arrays"])
 
             count = 0
-            while p_ != 0:
-                # This if block mirrors the condition in the begin() call
-                if (not first_time) or (self.match_occupied(groups.dereference()) & 1):
-                    pointer = BoostUnorderedHelpers.maybe_unwrap_foa_element(p_)
-                    value = self.cpo.to_address(pointer).dereference()
+            for arrays in all_arrays:
+                for value in self.elements(arrays):
                     if self.is_map:
                         first = value["first"]
                         second = value["second"]
@@ -226,6 +219,26 @@ class BoostUnorderedFoaPrinter:
                         yield "", count
                         yield "", value
                     count += 1
+
+        return generator()
+
+    def elements(self, arrays):
+        def generator():
+            groups = self.cpo.to_address(arrays["groups_"])
+            elements = self.cpo.to_address(arrays["elements_"])
+
+            pc_ = groups.cast(gdb.lookup_type("unsigned char").pointer())
+            p_ = elements
+            first_time = True
+            mask = 0
+            n0 = 0
+            n = 0
+
+            while p_ != 0:
+                # This if block mirrors the condition in the begin() call
+                if (not first_time) or (self.match_occupied(groups.dereference()) & 1):
+                    pointer = BoostUnorderedHelpers.maybe_unwrap_foa_element(p_)
+                    yield self.cpo.to_address(pointer).dereference()
                 first_time = False
 
                 n0 = pc_.cast(gdb.lookup_type("uintptr_t")) % groups.dereference().type.sizeof
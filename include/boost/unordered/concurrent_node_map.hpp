@@ -283,6 +283,57 @@ namespace boost {
         return table_.visit(std::forward<K>(k), f);
       }
 
+      template <class F>
+      BOOST_FORCEINLINE size_type visit(
+        prehashed ph, key_type const& k, F f)
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_INVOCABLE(F)
+        return table_.visit(ph, k, f);
+      }
+
+      template <class F>
+      BOOST_FORCEINLINE size_type visit(
+        prehashed ph, key_type const& k, F f) const
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_CONST_INVOCABLE(F)
+        return table_.visit(ph, k, f);
+      }
+
+      template <class F>
+      BOOST_FORCEINLINE size_type cvisit(
+        prehashed ph, key_type const& k, F f) const
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_CONST_INVOCABLE(F)
+        return table_.visit(ph, k, f);
+      }
+
+      template <class K, class F>
+      BOOST_FORCEINLINE typename std::enable_if<
+        detail::are_transparent<K, hasher, key_equal>::value, size_type>::type
+      visit(prehashed ph, K const& k, F f)
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_INVOCABLE(F)
+        return table_.visit(ph, k, f);
+      }
+
+      template <class K, class F>
+      BOOST_FORCEINLINE typename std::enable_if<
+        detail::are_transparent<K, hasher, key_equal>::value, size_type>::type
+      visit(prehashed ph, K const& k, F f) const
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_CONST_INVOCABLE(F)
+        return table_.visit(ph, k, f);
+      }
+
+      template <class K, class F>
+      BOOST_FORCEINLINE typename std::enable_if<
+        detail::are_transparent<K, hasher, key_equal>::value, size_type>::type
+      cvisit(prehashed ph, K const& k, F f) const
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_CONST_INVOCABLE(F)
+        return table_.visit(ph, k, f);
+      }
+
       template<class FwdIterator, class F>
       BOOST_FORCEINLINE
       size_t visit(FwdIterator first, FwdIterator last, F f)
@@ -426,16 +477,14 @@ namespace boost {
       }
 
       template <class InputIterator>
-      void insert(InputIterator begin, InputIterator end)
+      size_type insert(InputIterator begin, InputIterator end)
       {
-        for (auto pos = begin; pos != end; ++pos) {
-          table_.emplace(*pos);
-        }
+        return table_.insert(begin, end);
       }
 
-      void insert(std::initializer_list<value_type> ilist)
+      size_type insert(std::initializer_list<value_type> ilist)
       {
-        this->insert(ilist.begin(), ilist.end());
+        return this->insert(ilist.begin(), ilist.end());
       }
 
       insert_return_type insert(node_type&& nh)
@@ -497,19 +546,17 @@ namespace boost {
       }
 
       template <class InputIterator, class F>
-      void insert_or_visit(InputIterator first, InputIterator last, F f)
+      size_type insert_or_visit(InputIterator first, InputIterator last, F f)
       {
         BOOST_UNORDERED_STATIC_ASSERT_INVOCABLE(F)
-        for (; first != last; ++first) {
-          table_.emplace_or_visit(*first, f);
-        }
+        return table_.insert_or_visit(first, last, f);
       }
 
       template <class F>
-      void insert_or_visit(std::initializer_list<value_type> ilist, F f)
+      size_type insert_or_visit(std::initializer_list<value_type> ilist, F f)
       {
         BOOST_UNORDERED_STATIC_ASSERT_INVOCABLE(F)
-        this->insert_or_visit(ilist.begin(), ilist.end(), f);
+        return this->insert_or_visit(ilist.begin(), ilist.end(), f);
       }
 
       template <class F>
@@ -549,19 +596,17 @@ namespace boost {
       }
 
       template <class InputIterator, class F>
-      void insert_or_cvisit(InputIterator first, InputIterator last, F f)
+      size_type insert_or_cvisit(InputIterator first, InputIterator last, F f)
       {
         BOOST_UNORDERED_STATIC_ASSERT_CONST_INVOCABLE(F)
-        for (; first != last; ++first) {
-          table_.emplace_or_cvisit(*first, f);
-        }
+        return table_.insert_or_cvisit(first, last, f);
       }
 
       template <class F>
-      void insert_or_cvisit(std::initializer_list<value_type> ilist, F f)
+      size_type insert_or_cvisit(std::initializer_list<value_type> ilist, F f)
       {
         BOOST_UNORDERED_STATIC_ASSERT_CONST_INVOCABLE(F)
-        this->insert_or_cvisit(ilist.begin(), ilist.end(), f);
+        return this->insert_or_cvisit(ilist.begin(), ilist.end(), f);
       }
 
       template <class F>
@@ -627,6 +672,30 @@ namespace boost {
           std::forward<K>(k), std::forward<Args>(args)...);
       }
 
+      template <class... Args>
+      BOOST_FORCEINLINE bool try_emplace(
+        prehashed ph, key_type const& k, Args&&... args)
+      {
+        return table_.try_emplace(ph, k, std::forward<Args>(args)...);
+      }
+
+      template <class... Args>
+      BOOST_FORCEINLINE bool try_emplace(
+        prehashed ph, key_type&& k, Args&&... args)
+      {
+        return table_.try_emplace(
+          ph, std::move(k), std::forward<Args>(args)...);
+      }
+
+      template <class K, class... Args>
+      BOOST_FORCEINLINE typename std::enable_if<
+        detail::are_transparent<K, hasher, key_equal>::value, bool>::type
+      try_emplace(prehashed ph, K&& k, Args&&... args)
+      {
+        return table_.try_emplace(
+          ph, std::forward<K>(k), std::forward<Args>(args)...);
+      }
+
       template <class Arg, class... Args>
       BOOST_FORCEINLINE bool try_emplace_or_visit(
         key_type const& k, Arg&& arg, Args&&... args)
@@ -710,6 +779,21 @@ namespace boost {
         return table_.erase_if(std::forward<K>(k), f);
       }
 
+      template <class FwdIterator>
+      BOOST_FORCEINLINE size_type erase(FwdIterator first, FwdIterator last)
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_BULK_VISIT_ITERATOR(FwdIterator)
+        return table_.erase(first, last);
+      }
+
+      template <class FwdIterator, class F>
+      BOOST_FORCEINLINE size_type erase_if(
+        FwdIterator first, FwdIterator last, F f)
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_BULK_VISIT_ITERATOR(FwdIterator)
+        return table_.erase_if(first, last, f);
+      }
+
 #if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
       template <class ExecPolicy, class F>
       typename std::enable_if<detail::is_execution_policy<ExecPolicy>::value,
@@ -806,6 +890,19 @@ namespace boost {
         return table_.contains(k);
       }
 
+      BOOST_FORCEINLINE bool contains(prehashed ph, key_type const& k) const
+      {
+        return table_.contains(ph, k);
+      }
+
+      template <class K>
+      BOOST_FORCEINLINE typename std::enable_if<
+        detail::are_transparent<K, hasher, key_equal>::value, bool>::type
+      contains(prehashed ph, K const& k) const
+      {
+        return table_.contains(ph, k);
+      }
+
       /// Hash Policy
       ///
       size_type bucket_count() const noexcept { return table_.capacity(); }
@@ -815,11 +912,23 @@ namespace boost {
       {
         return table_.max_load_factor();
       }
-      void max_load_factor(float) {}
+      void max_load_factor(float z) { table_.max_load_factor(z); }
       size_type max_load() const noexcept { return table_.max_load(); }
 
       void rehash(size_type n) { table_.rehash(n); }
       void reserve(size_type n) { table_.reserve(n); }
+      void compact() { table_.compact(); }
+      void prefault() { table_.prefault(); }
+
+      bool incremental_rehash() const noexcept
+      {
+        return table_.incremental_rehash();
+      }
+
+      void incremental_rehash(bool enable)
+      {
+        table_.incremental_rehash(enable);
+      }
 
 #if defined(BOOST_UNORDERED_ENABLE_STATS)
       /// Stats
@@ -837,6 +946,16 @@ namespace boost {
       }
 
       hasher hash_function() const { return table_.hash_function(); }
+
+      prehashed prehash(key_type const& k) const { return table_.prehash(k); }
+
+      template <class K>
+      typename std::enable_if<
+        detail::are_transparent<K, hasher, key_equal>::value, prehashed>::type
+      prehash(K const& k) const
+      {
+        return table_.prehash(k);
+      }
       key_equal key_eq() const { return table_.key_eq(); }
     };
 
@@ -0,0 +1,198 @@
+/* Fast path for the serialization of flat open-addressing tables.
+ *
+ * Copyright 2026 agent.
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See https://www.boost.org/libs/unordered for library home page.
+ */
+
+#ifndef BOOST_UNORDERED_DETAIL_FOA_BULK_SERIALIZATION_HPP
+#define BOOST_UNORDERED_DETAIL_FOA_BULK_SERIALIZATION_HPP
+
+#include <boost/core/serialization.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/unordered/detail/bad_archive_exception.hpp>
+#include <boost/unordered/detail/serialize_container.hpp>
+#include <boost/unordered/detail/type_traits.hpp>
+#include <type_traits>
+#include <utility>
+
+namespace boost{
+namespace unordered{
+namespace detail{
+namespace foa{
+
+/* Archives with array optimization (Boost.Serialization binary archives)
+ * save flat tables of bitwise serializable, trivially copyable elements
+ * with table_core::save_bulk, which dumps the group array and the elements
+ * as raw bytes, so that loading can restore them without rehashing
+ * (see table_core::load_bulk). Starting at bulk_serialization_version, a
+ * flag ahead of the table tells whether the bulk format is used;
+ * other archives, element types and older versions go element-wise
+ * (serialize_container.hpp).
+ */
+
+static constexpr unsigned int bulk_serialization_version=1;
+
+template<typename Archive,typename=void>
+struct has_array_optimization:std::false_type{};
+
+template<typename Archive>
+struct has_array_optimization<
+  Archive,void_t<typename Archive::use_array_optimization>
+>:std::true_type{};
+
+template<typename Archive,typename T>
+struct is_archive_bitwise_serializable:std::integral_constant<
+  bool,
+  Archive::use_array_optimization::template apply<
+    typename std::remove_const<T>::type>::value
+>{};
+
+template<typename Archive,typename Value,typename Key>
+struct is_archive_bitwise_serializable_value: /* set */
+  is_archive_bitwise_serializable<Archive,Value>{};
+
+template<typename Archive,typename Key,typename T>
+struct is_archive_bitwise_serializable_value<
+  Archive,std::pair<const Key,T>,Key
+>:std::integral_constant<
+  bool,
+  is_archive_bitwise_serializable<Archive,Key>::value&&
+  is_archive_bitwise_serializable<Archive,T>::value
+>{};
+
+template<typename Archive,typename Table,typename=void>
+struct use_bulk_serialization:std::false_type{};
+
+template<typename Archive,typename Table>
+struct use_bulk_serialization<
+  Archive,Table,void_t<typename Archive::use_array_optimization>
+>:std::integral_constant<
+  bool,
+  Table::bulk_serializable&&
+  is_archive_bitwise_serializable_value<
+    Archive,typename Table::value_type,typename Table::key_type>::value
+>{};
+
+template<typename Archive,typename Table>
+bool save_bulk_flag(
+  Archive& ar,bool bulk_allowed,std::true_type /* array optimization */)
+{
+  const bool bulk=use_bulk_serialization<Archive,Table>::value&&bulk_allowed;
+  ar<<core::make_nvp("bulk",bulk);
+  return bulk;
+}
+
+template<typename Archive,typename Table>
+bool save_bulk_flag(
+  Archive&,bool,std::false_type /* no array optimization */)
+{
+  return false;
+}
+
+/* saves the bulk flag, if any, and returns whether bulk format follows */
+
+template<typename Archive,typename Table>
+bool save_bulk_flag(Archive& ar,bool bulk_allowed=true)
+{
+  return save_bulk_flag<Archive,Table>(
+    ar,bulk_allowed,has_array_optimization<Archive>{});
+}
+
+template<typename Archive>
+bool load_bulk_flag(
+  Archive& ar,unsigned int version,std::true_type /* array optimization */)
+{
+  bool bulk=false;
+  if(version>=bulk_serialization_version){
+    ar>>core::make_nvp("bulk",bulk);
+  }
+  return bulk;
+}
+
+template<typename Archive>
+bool load_bulk_flag(
+  Archive&,unsigned int,std::false_type /* no array optimization */)
+{
+  return false;
+}
+
+/* loads the bulk flag, if any, and returns whether bulk format follows */
+
+template<typename Archive>
+bool load_bulk_flag(Archive& ar,unsigned int version)
+{
+  return load_bulk_flag(ar,version,has_array_optimization<Archive>{});
+}
+
+template<typename Archive,typename Table>
+void save_bulk(Archive& ar,const Table& t,std::true_type /* bulk */)
+{
+  t.save_bulk(ar);
+}
+
+template<typename Archive,typename Table>
+void save_bulk(Archive&,const Table&,std::false_type /* not bulk */){}
+
+template<typename Archive,typename Table>
+void load_bulk(Archive& ar,Table& t,std::true_type /* bulk */)
+{
+  t.load_bulk(ar);
+}
+
+template<typename Archive,typename Table>
+void load_bulk(Archive&,Table&,std::false_type /* not bulk */)
+{
+  /* saved in bulk by a program with a different element type */
+  throw_exception(bad_archive_exception());
+}
+
+template<typename Archive,typename Container,typename Table>
+void serialize_flat_container(
+  Archive& ar,Container& x,Table& t,unsigned int version,
+  std::true_type /* saving */)
+{
+  /* a table being incrementally rehashed is saved element-wise */
+  if(save_bulk_flag<Archive,Table>(ar,!t.migrating())){
+    save_bulk(ar,t,use_bulk_serialization<Archive,Table>{});
+  }
+  else{
+    serialize_container(ar,x,version);
+  }
+}
+
+template<typename Archive,typename Container,typename Table>
+void serialize_flat_container(
+  Archive& ar,Container& x,Table& t,unsigned int version,
+  std::false_type /* loading */)
+{
+  if(load_bulk_flag(ar,version)){
+    load_bulk(ar,t,use_bulk_serialization<Archive,Table>{});
+  }
+  else{
+    serialize_container(ar,x,version);
+  }
+}
+
+/* serialize_flat_container(ar,x,t,v) serializes a flat container x with
+ * internal table t.
+ */
+
+template<typename Archive,typename Container,typename Table>
+void serialize_flat_container(
+  Archive& ar,Container& x,Table& t,unsigned int version)
+{
+  serialize_flat_container(
+    ar,x,t,version,
+    std::integral_constant<bool,Archive::is_saving::value>{});
+}
+
+} /* namespace foa */
+} /* namespace detail */
+} /* namespace unordered */
+} /* namespace boost */
+
+#endif
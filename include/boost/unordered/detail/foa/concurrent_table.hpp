@@ -16,6 +16,7 @@
 #include <boost/assert.hpp>
 #include <boost/config.hpp>
 #include <boost/core/ignore_unused.hpp>
+#include <boost/core/yield_primitives.hpp>
 #include <boost/core/no_exceptions_support.hpp>
 #include <boost/core/serialization.hpp>
 #include <boost/cstdint.hpp>
@@ -23,6 +24,7 @@
 #include <boost/throw_exception.hpp>
 #include <boost/unordered/detail/archive_constructed.hpp>
 #include <boost/unordered/detail/bad_archive_exception.hpp>
+#include <boost/unordered/detail/foa/bulk_serialization.hpp>
 #include <boost/unordered/detail/foa/core.hpp>
 #include <boost/unordered/detail/foa/reentrancy_check.hpp>
 #include <boost/unordered/detail/foa/rw_spinlock.hpp>
@@ -30,7 +32,9 @@
 #include <boost/unordered/detail/serialization_version.hpp>
 #include <boost/unordered/detail/static_assert.hpp>
 #include <boost/unordered/detail/type_traits.hpp>
+#include <climits>
 #include <cstddef>
+#include <cstring>
 #include <functional>
 #include <initializer_list>
 #include <iterator>
@@ -40,38 +44,13 @@
 #include <tuple>
 #include <utility>
 
-#if !defined(BOOST_UNORDERED_DISABLE_PARALLEL_ALGORITHMS)
-#if defined(BOOST_UNORDERED_ENABLE_PARALLEL_ALGORITHMS)|| \
-    !defined(BOOST_NO_CXX17_HDR_EXECUTION)
-#define BOOST_UNORDERED_PARALLEL_ALGORITHMS
-#endif
-#endif
-
-#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
-#include <algorithm>
-#include <execution>
+#if defined(BOOST_UNORDERED_ENABLE_STATS)
+#include <chrono>
 #endif
 
 namespace boost{
 namespace unordered{
 namespace detail{
-
-#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
-
-template<typename ExecutionPolicy>
-using is_execution_policy=std::is_execution_policy<
-  typename std::remove_cv<
-    typename std::remove_reference<ExecutionPolicy>::type
-  >::type
->;
-
-#else
-
-template<typename ExecutionPolicy>
-using is_execution_policy=std::false_type;
-
-#endif
-
 namespace foa{
 
 static constexpr std::size_t cacheline_size=64;
@@ -213,25 +192,89 @@ struct atomic_integral
   std::atomic<Integral> n;
 };
 
+/* If BOOST_UNORDERED_OPTIMISTIC_READS is defined, groups are additionally
+ * protected by a seqlock-style version counter: exclusive group access
+ * makes the version odd on locking and even again on unlocking, so that
+ * const lookups of flat, trivially copyable elements can copy the element
+ * without writing to the group lock and then validate the copy against the
+ * version (see unprotected_optimistic_visit). All translation units in a
+ * program must agree on this setting.
+ */
+
+#if defined(BOOST_UNORDERED_OPTIMISTIC_READS)
+template<typename Mutex>
+class versioned_lock_guard
+{
+public:
+  versioned_lock_guard(Mutex& m_,std::atomic<boost::uint32_t>& v_)noexcept:
+    m(m_),v(v_)
+  {
+    m.lock();
+    v.store(v.load(std::memory_order_relaxed)+1,std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+  }
+
+  ~versioned_lock_guard()noexcept
+  {
+    v.store(v.load(std::memory_order_relaxed)+1,std::memory_order_release);
+    m.unlock();
+  }
+
+  /* not used but VS in pre-C++17 mode needs to see it for RVO */
+  versioned_lock_guard(const versioned_lock_guard&);
+
+private:
+  Mutex                        &m;
+  std::atomic<boost::uint32_t> &v;
+};
+#endif
+
 /* Group-level concurrency protection. It provides a rw mutex plus an
  * atomic insertion counter for optimistic insertion (see
- * unprotected_norehash_emplace_or_visit).
+ * unprotected_norehash_emplace_or_visit) and, optionally, a version counter
+ * for optimistic reads.
  */
 
 struct group_access
 {    
   using mutex_type=rw_spinlock;
   using shared_lock_guard=shared_lock<mutex_type>;
+#if defined(BOOST_UNORDERED_OPTIMISTIC_READS)
+  using exclusive_lock_guard=versioned_lock_guard<mutex_type>;
+#else
   using exclusive_lock_guard=lock_guard<mutex_type>;
+#endif
   using insert_counter_type=std::atomic<boost::uint32_t>;
 
   shared_lock_guard    shared_access(){return shared_lock_guard{m};}
+#if defined(BOOST_UNORDERED_OPTIMISTIC_READS)
+  exclusive_lock_guard exclusive_access(){return exclusive_lock_guard{m,ver};}
+#else
   exclusive_lock_guard exclusive_access(){return exclusive_lock_guard{m};}
+#endif
   insert_counter_type& insert_counter(){return cnt;}
 
+#if defined(BOOST_UNORDERED_OPTIMISTIC_READS)
+  /* returns an odd value if the group is being written to */
+
+  boost::uint32_t read_begin()const noexcept
+  {
+    return ver.load(std::memory_order_acquire);
+  }
+
+  bool read_validate(boost::uint32_t v)const noexcept
+  {
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return ver.load(std::memory_order_relaxed)==v;
+  }
+#endif
+
 private:
-  mutex_type          m;
-  insert_counter_type cnt{0};
+  mutex_type                   m;
+  insert_counter_type          cnt{0};
+#if defined(BOOST_UNORDERED_OPTIMISTIC_READS)
+  std::atomic<boost::uint32_t> ver{0};
+#endif
 };
 
 template<std::size_t Size>
@@ -250,15 +293,19 @@ group_access* dummy_group_accesses()
 
 /* subclasses table_arrays to add an additional group_access array */
 
-template<typename Value,typename Group,typename SizePolicy,typename Allocator>
-struct concurrent_table_arrays:table_arrays<Value,Group,SizePolicy,Allocator>
+template<
+  typename Value,typename Group,typename SizePolicy,typename Allocator,
+  typename StoredHash=void
+>
+struct concurrent_table_arrays:
+  table_arrays<Value,Group,SizePolicy,Allocator,StoredHash>
 {
   using group_access_allocator_type=
     typename boost::allocator_rebind<Allocator,group_access>::type;
   using group_access_pointer=
     typename boost::allocator_pointer<group_access_allocator_type>::type;
 
-  using super=table_arrays<Value,Group,SizePolicy,Allocator>;
+  using super=table_arrays<Value,Group,SizePolicy,Allocator,StoredHash>;
   using allocator_type=typename super::allocator_type;
 
   concurrent_table_arrays(const super& arrays,group_access_pointer pga):
@@ -340,22 +387,179 @@ struct concurrent_table_arrays:table_arrays<Value,Group,SizePolicy,Allocator>
   group_access_pointer group_accesses_;
 };
 
+/* Size of a concurrent table, accounted per stripe so that concurrent
+ * insertions don't contend on a single atomic counter: the
+ * size is the sum of the stripes' sizes (which can individually wrap around
+ * due to erasures of elements inserted through other stripes). Insertions
+ * need be checked against the maximum load: this is done by reserving
+ * batches of slots from a central counter (reserved), which are then
+ * consumed by the stripe's insertions without further synchronization
+ * (budget). The invariant is
+ * reserved == sum of sizes + sum of budgets <= max load, so that reserve
+ * only fails when the table may be full: fold then transfers unused budgets
+ * back to reserved under container-level write access, after which
+ * size() >= ml exactly tells whether the table needs growing. Erasures give
+ * their slot back to reserved rather than to the local budget, as they may
+ * also decrease the maximum load (see table_core::recover_slot), which
+ * the budget would then overrun.
+ *
+ * Read-modify-write operations other than reserve, unreserve and prefix
+ * decrement (used by erasure) are meant for use under write access.
+ */
+
+struct striped_size
+{
+  static constexpr std::size_t num_stripes=64;
+  static constexpr std::size_t max_batch=32;
+
+  enum reservation{reservation_failed=0,reservation_succeeded,
+    reservation_crossed_threshold};
+
+  striped_size(std::size_t size_)noexcept
+  {
+    *this=size_;
+  }
+
+  striped_size(const striped_size&)=delete;
+  striped_size& operator=(const striped_size&)=delete;
+
+  operator std::size_t()const noexcept
+  {
+    std::size_t res=0;
+    for(auto& s:stripes)res+=s.size.load(std::memory_order_relaxed);
+    return res;
+  }
+
+  striped_size& operator=(std::size_t size_)noexcept
+  {
+    for(auto& s:stripes){
+      s.size.store(0,std::memory_order_relaxed);
+      s.budget.store(0,std::memory_order_relaxed);
+    }
+    stripes[0].size.store(size_,std::memory_order_relaxed);
+    reserved.store(size_,std::memory_order_relaxed);
+    return *this;
+  }
+
+  striped_size& operator+=(std::size_t n)noexcept
+  {
+    local().size.fetch_add(n,std::memory_order_relaxed);
+    reserved.fetch_add(n,std::memory_order_relaxed);
+    return *this;
+  }
+
+  striped_size& operator++()noexcept{return *this+=1;}
+
+  striped_size& operator--()noexcept
+  {
+    local().size.fetch_sub(1,std::memory_order_relaxed);
+    reserved.fetch_sub(1,std::memory_order_relaxed);
+    return *this;
+  }
+
+  /* Reserves one slot and accounts for it in the size (undone with
+   * unreserve). Reports when the reserved slots reach threshold.
+   */
+
+  reservation reserve(std::size_t ml,std::size_t threshold)noexcept
+  {
+    auto& s=local();
+    auto  budget=s.budget.load(std::memory_order_relaxed);
+    while(budget){
+      if(s.budget.compare_exchange_weak(
+        budget,budget-1,std::memory_order_relaxed)){
+        s.size.fetch_add(1,std::memory_order_relaxed);
+        return reservation_succeeded;
+      }
+    }
+    return reserve_batch(s,ml,threshold);
+  }
+
+  void unreserve()noexcept
+  {
+    /* the slot can be reused by this stripe */
+    auto& s=local();
+    s.size.fetch_sub(1,std::memory_order_relaxed);
+    s.budget.fetch_add(1,std::memory_order_relaxed);
+  }
+
+  /* write access only */
+
+  void fold()noexcept
+  {
+    *this=static_cast<std::size_t>(*this);
+  }
+
+  friend void swap(striped_size& x,striped_size& y)noexcept
+  {
+    std::size_t tmp=x;
+    x=static_cast<std::size_t>(y);
+    y=tmp;
+  }
+
+private:
+  struct stripe
+  {
+    std::atomic<std::size_t> size{0},
+                             budget{0};
+    unsigned char            pad_[
+      cacheline_size-2*sizeof(std::atomic<std::size_t>)];
+  };
+
+  static std::size_t thread_stripe()noexcept
+  {
+    static std::atomic<std::size_t> thread_counter{0};
+    thread_local std::size_t        id=(thread_counter++)%num_stripes;
+    return id;
+  }
+
+  stripe& local()noexcept{return stripes[thread_stripe()];}
+
+  BOOST_NOINLINE reservation reserve_batch(
+    stripe& s,std::size_t ml,std::size_t threshold)noexcept
+  {
+    /* Batches shrink as reserved approaches ml, so that slots sitting
+     * unused in other stripes rarely cause reserve to fail before the
+     * table is really full.
+     */
+
+    auto r=reserved.load(std::memory_order_relaxed);
+    for(;;){
+      if(r>=ml)return reservation_failed;
+      std::size_t n=(ml-r)/(2*num_stripes);
+      n=n<1?1:n>max_batch?max_batch:n;
+      if(reserved.compare_exchange_weak(r,r+n,std::memory_order_relaxed)){
+        s.size.fetch_add(1,std::memory_order_relaxed);
+        if(n>1)s.budget.fetch_add(n-1,std::memory_order_relaxed);
+        return r<threshold&&r+n>=threshold?
+          reservation_crossed_threshold:reservation_succeeded;
+      }
+    }
+  }
+
+  unsigned char            pad0_[cacheline_size-sizeof(std::atomic<std::size_t>)];
+  std::atomic<std::size_t> reserved;
+  unsigned char            pad1_[cacheline_size-sizeof(std::atomic<std::size_t>)];
+  stripe                   stripes[num_stripes];
+};
+
 struct atomic_size_control
 {
   static constexpr auto atomic_size_t_size=sizeof(std::atomic<std::size_t>);
   BOOST_UNORDERED_STATIC_ASSERT(atomic_size_t_size<cacheline_size);
 
   atomic_size_control(std::size_t ml_,std::size_t size_):
-    pad0_{},ml{ml_},pad1_{},size{size_}{}
+    pad0_{},ml{ml_},size{size_}{}
   atomic_size_control(const atomic_size_control& x):
-    pad0_{},ml{x.ml.load()},pad1_{},size{x.size.load()}{}
+    pad0_{},ml{x.ml.load()},size{static_cast<std::size_t>(x.size)}{}
 
-  /* padding to avoid false sharing internally and with sorrounding data */
+  /* padding to avoid false sharing with sorrounding data (size is padded
+   * internally)
+   */
 
   unsigned char            pad0_[cacheline_size-atomic_size_t_size];
   std::atomic<std::size_t> ml;
-  unsigned char            pad1_[cacheline_size-atomic_size_t_size];
-  std::atomic<std::size_t> size;
+  striped_size             size;
 };
 
 /* std::swap can't be used on non-assignable atomics */
@@ -371,9 +575,25 @@ swap_atomic_size_t(std::atomic<std::size_t>& x,std::atomic<std::size_t>& y)
 inline void swap(atomic_size_control& x,atomic_size_control& y)
 {
   swap_atomic_size_t(x.ml,y.ml);
-  swap_atomic_size_t(x.size,y.size);
+  swap(x.size,y.size);
 }
 
+#if defined(BOOST_UNORDERED_ENABLE_STATS)
+/* stats support */
+
+struct concurrent_table_growth_stats
+{
+  std::size_t            count;
+  sequence_stats_summary exclusive_lock_time; /* nanoseconds */
+  sequence_stats_summary preallocated;        /* 1 or 0 */
+};
+
+struct concurrent_table_stats:table_core_stats
+{
+  concurrent_table_growth_stats growth;
+};
+#endif
+
 /* foa::concurrent_table serves as the foundation for end-user concurrent
  * hash containers.
  * 
@@ -427,6 +647,38 @@ inline void swap(atomic_size_control& x,atomic_size_control& y)
  *       whole operation (which is checked by comparing with c0), then we're
  *       good to go and complete the insertion, otherwise we roll back and
  *       start over.
+ *
+ * When incremental rehashing is enabled, growth only holds the container-level
+ * write lock for allocating the new arrays, which are published in place of
+ * the old ones; elements are then moved over (migrated) by the threads using
+ * the container, under container-level read access:
+ *
+ *   - Lookups probe the old arrays first and then the new ones. An element is
+ *     constructed in the new arrays before its old slot is cleared, both
+ *     done under the lock of the old group, so lookups never miss it.
+ *   - Insertions and erasures by key first migrate the old groups in the
+ *     probe sequence of the key with a reduced hash match, so that they then
+ *     need only look at the new arrays (no insertions go to the old arrays),
+ *     and next migrate a batch of the groups not yet claimed (see
+ *     migration_pos).
+ *   - Operations traversing the entire table migrate whatever is left first.
+ *   - When all groups have been claimed and migrated, the next insertion or
+ *     erasure briefly takes the container-level write lock to deallocate the
+ *     old arrays. Container-wide operations under write lock complete any
+ *     pending migration.
+ *
+ * Migrating moves elements to the new arrays while holding the lock of the
+ * old group, so a thread may hold two group locks at a time, always an old
+ * group first and a new group second.
+ *
+ * Allocating and initializing the arrays for the next growth is not done
+ * under the container-level write lock, either: the insertion reserving
+ * the slot at 7/8 of the maximum load allocates them (next_arrays) under
+ * read access, so that the write lock is later only held for transferring the
+ * elements (or just publishing the arrays, with incremental rehashing).
+ * next_arrays is discarded if, by the time growth happens, it doesn't have
+ * the capacity required (e.g. due to intervening calls to rehash or
+ * max_load_factor).
  */
 
 template<typename,typename,typename,typename>
@@ -434,7 +686,7 @@ class table; /* concurrent/non-concurrent interop */
 
 template <typename TypePolicy,typename Hash,typename Pred,typename Allocator>
 using concurrent_table_core_impl=table_core<
-  TypePolicy,group15<atomic_integral>,concurrent_table_arrays,
+  TypePolicy,default_group<atomic_integral>,concurrent_table_arrays,
   atomic_size_control,Hash,Pred,Allocator>;
 
 #include <boost/unordered/detail/foa/ignore_wshadow.hpp>
@@ -468,9 +720,10 @@ public:
   using allocator_type=typename super::allocator_type;
   using size_type=typename super::size_type;
   static constexpr std::size_t bulk_visit_size=16;
+  using super::bulk_serializable;
 
 #if defined(BOOST_UNORDERED_ENABLE_STATS)
-  using stats=typename super::stats;
+  using stats=concurrent_table_stats;
 #endif
 
 private:
@@ -511,6 +764,7 @@ public:
           x.arrays.elements_});},
       size_ctrl_type{x.size_ctrl.ml,x.size_ctrl.size}}
   {
+    this->mlf_=x.mlf_;
     x.arrays=ah.release();
     x.size_ctrl.ml=x.initial_max_load();
     x.size_ctrl.size=0;
@@ -518,15 +772,26 @@ public:
   }
 
   concurrent_table(compatible_nonconcurrent_table&& x):
-    concurrent_table(std::move(x),x.make_empty_arrays())
+    concurrent_table(
+      std::move(x),
+      (x.complete_migration(),x.make_empty_arrays())) /* see foa::table */
   {}
 
-  ~concurrent_table()=default;
+  ~concurrent_table()
+  {
+    if(migrating())this->delete_old_arrays(old_arrays);
+    discard_next_arrays();
+  }
 
   concurrent_table& operator=(const concurrent_table& x)
   {
     auto lck=exclusive_access(*this,x);
-    super::operator=(x);
+    if(this!=&x){
+      complete_migration();
+      discard_next_arrays(); /* allocator may change */
+      super::operator=(completed(x));
+      incremental_=x.incremental_;
+    }
     return *this;
   }
 
@@ -534,12 +799,20 @@ public:
     noexcept(std::declval<super&>() = std::declval<super&&>()))
   {
     auto lck=exclusive_access(*this,x);
-    super::operator=(std::move(x));
+    if(this!=&x){
+      complete_migration();
+      discard_next_arrays();
+      super::operator=(std::move(completed(x)));
+      incremental_=x.incremental_;
+      BOOST_UNORDERED_COPY_STATS(growth_cstats,x.growth_cstats);
+      BOOST_UNORDERED_RESET_STATS_OF(x);
+    }
     return *this;
   }
 
   concurrent_table& operator=(std::initializer_list<value_type> il) {
     auto lck=exclusive_access();
+    clear_old_arrays();
     super::clear();
     super::noshrink_reserve(il.size());
     for (auto const& v : il) {
@@ -572,6 +845,24 @@ public:
     return visit(x,std::forward<F>(f));
   }
 
+  template<typename Key,typename F>
+  BOOST_FORCEINLINE std::size_t visit(prehashed ph,const Key& x,F&& f)
+  {
+    return visit_impl(group_exclusive{},ph,x,std::forward<F>(f));
+  }
+
+  template<typename Key,typename F>
+  BOOST_FORCEINLINE std::size_t visit(prehashed ph,const Key& x,F&& f)const
+  {
+    return visit_impl(group_shared{},ph,x,std::forward<F>(f));
+  }
+
+  template<typename Key,typename F>
+  BOOST_FORCEINLINE std::size_t cvisit(prehashed ph,const Key& x,F&& f)const
+  {
+    return visit(ph,x,std::forward<F>(f));
+  }
+
   template<typename FwdIterator,typename F>
   BOOST_FORCEINLINE
   std::size_t visit(FwdIterator first,FwdIterator last,F&& f)
@@ -739,6 +1030,14 @@ public:
       try_emplace_args_t{},std::forward<Key>(x),std::forward<Args>(args)...);
   }
 
+  template<typename Key,typename... Args>
+  BOOST_FORCEINLINE bool try_emplace(prehashed ph,Key&& x,Args&&... args)
+  {
+    return prehashed_emplace_or_visit_impl(
+      group_shared{},ph,[](const value_type&){},
+      try_emplace_args_t{},std::forward<Key>(x),std::forward<Args>(args)...);
+  }
+
   template<typename Key,typename... Args>
   BOOST_FORCEINLINE bool try_emplace_or_visit(Key&& x,Args&&... args)
   {
@@ -851,6 +1150,32 @@ public:
       group_shared{},std::forward<F>(f),std::move(x));
   }
 
+  /* Ranges of value_type or init_type given by forward iterators are
+   * inserted in bulk (see bulk_insert_or_visit).
+   */
+
+  template<typename InputIterator>
+  std::size_t insert(InputIterator first,InputIterator last)
+  {
+    return insert_range(first,last,is_bulk_insertable<InputIterator>{});
+  }
+
+  template<typename InputIterator,typename F>
+  std::size_t insert_or_visit(InputIterator first,InputIterator last,F&& f)
+  {
+    return insert_range_or_visit(
+      group_exclusive{},first,last,std::forward<F>(f),
+      is_bulk_insertable<InputIterator>{});
+  }
+
+  template<typename InputIterator,typename F>
+  std::size_t insert_or_cvisit(InputIterator first,InputIterator last,F&& f)
+  {
+    return insert_range_or_visit(
+      group_shared{},first,last,std::forward<F>(f),
+      is_bulk_insertable<InputIterator>{});
+  }
+
   template<typename Key>
   BOOST_FORCEINLINE std::size_t erase(const Key& x)
   {
@@ -860,19 +1185,52 @@ public:
   template<typename Key,typename F>
   BOOST_FORCEINLINE auto erase_if(const Key& x,F&& f)->typename std::enable_if<
     !is_execution_policy<Key>::value,std::size_t>::type
+  {
+    auto lck=shared_access();
+    auto res=unprotected_erase_if(x,this->hash_for(x),f);
+    lck.unlock();
+    release_old_arrays_if_migrated();
+    return res;
+  }
+
+  template<typename FwdIterator>
+  std::size_t erase(FwdIterator first,FwdIterator last)
+  {
+    return erase_if(first,last,[](const value_type&){return true;});
+  }
+
+  template<typename FwdIterator,typename F>
+  std::size_t erase_if(FwdIterator first,FwdIterator last,F&& f)
   {
     auto        lck=shared_access();
-    auto        hash=this->hash_for(x);
     std::size_t res=0;
-    unprotected_internal_visit(
-      group_exclusive{},x,this->position_for(hash),hash,
-      [&,this](group_type* pg,unsigned int n,element_type* p)
-      {
-        if(f(cast_for(group_exclusive{},type_policy::value_from(*p)))){
-          super::erase(pg,n,p);
-          res=1;
-        }
-      });
+    if(BOOST_UNLIKELY(migrating())){
+      for(;first!=last;++first){
+        res+=unprotected_erase_if(*first,this->hash_for(*first),f);
+      }
+    }
+    else{
+      auto n=static_cast<std::size_t>(std::distance(first,last));
+      while(n){
+        auto m=n<2*bulk_visit_size?n:bulk_visit_size;
+        unprotected_bulk_internal_visit(
+          group_exclusive{},first,m,
+          [&,this](group_type* pg,unsigned int i,element_type* p)
+          {
+            if(f(cast_for(group_exclusive{},type_policy::value_from(*p)))){
+              super::erase(pg,i,p);
+              ++res;
+            }
+          });
+        n-=m;
+        std::advance(
+          first,
+          static_cast<
+            typename std::iterator_traits<FwdIterator>::difference_type>(m));
+      }
+    }
+    lck.unlock();
+    release_old_arrays_if_migrated();
     return res;
   }
 
@@ -889,6 +1247,8 @@ public:
           ++res;
         }
       });
+    lck.unlock();
+    release_old_arrays_if_migrated();
     return res;
   }
 
@@ -905,6 +1265,8 @@ public:
           super::erase(pg,n,p);
         }
       });
+    lck.unlock();
+    release_old_arrays_if_migrated();
   }
 #endif
 
@@ -913,11 +1275,23 @@ public:
   {
     auto lck=exclusive_access(*this,x);
     super::swap(x);
+    std::swap(incremental_,x.incremental_);
+    std::swap(old_arrays,x.old_arrays);
+    std::swap(migration_step,x.migration_step);
+    swap_atomic_size_t(migration_pos,x.migration_pos);
+    swap_atomic_size_t(num_migrated,x.num_migrated);
+    migration_done.store(
+      x.migration_done.exchange(migration_done.load()));
+    std::swap(next_arrays,x.next_arrays);
+    next_arrays_claimed.store(
+      x.next_arrays_claimed.exchange(next_arrays_claimed.load()));
   }
 
   void clear()noexcept
   {
     auto lck=exclusive_access();
+    clear_old_arrays();
+    discard_next_arrays();
     super::clear();
   }
 
@@ -933,6 +1307,7 @@ public:
   {
     auto        lck=shared_access();
     auto        hash=this->hash_for(x);
+    if(BOOST_UNLIKELY(migrating()))unprotected_migrate_for(hash);
     unprotected_internal_visit(
       group_exclusive{},x,this->position_for(hash),hash,
       [&,this](group_type* pg,unsigned int n,element_type* p)
@@ -942,6 +1317,8 @@ public:
           super::erase(pg,n,p);
         }
       });
+    lck.unlock();
+    release_old_arrays_if_migrated();
   }
 
   // TODO: should we accept different allocator too?
@@ -955,6 +1332,8 @@ public:
     boost::ignore_unused<super2>();
 
     auto      lck=exclusive_access(*this,x);
+    complete_migration();
+    x.complete_migration();
     size_type s=super::size();
     x.super2::for_all_elements( /* super2::for_all_elements -> unprotected */
       [&,this](group_type* pg,unsigned int n,element_type* p){
@@ -973,6 +1352,13 @@ public:
     return super::hash_function();
   }
 
+  template<typename Key>
+  prehashed prehash(const Key& x)const
+  {
+    auto lck=shared_access();
+    return super::prehash(x);
+  }
+
   key_equal key_eq()const
   {
     auto lck=shared_access();
@@ -991,6 +1377,12 @@ public:
     return visit(std::forward<Key>(x),[](const value_type&){})!=0;
   }
 
+  template<typename Key>
+  BOOST_FORCEINLINE bool contains(prehashed ph,const Key& x)const
+  {
+    return visit(ph,x,[](const value_type&){})!=0;
+  }
+
   std::size_t capacity()const noexcept
   {
     auto lck=shared_access();
@@ -1005,7 +1397,20 @@ public:
                                    float(super::capacity());
   }
 
-  using super::max_load_factor;
+  float max_load_factor()const noexcept
+  {
+    auto lck=shared_access();
+    return super::max_load_factor();
+  }
+
+  void max_load_factor(float z)
+  {
+    auto lck=exclusive_access();
+    complete_migration();
+    discard_next_arrays();
+    this->size_ctrl.size.fold(); /* slots reserved against former max load */
+    super::max_load_factor(z);
+  }
 
   std::size_t max_load()const noexcept
   {
@@ -1016,20 +1421,71 @@ public:
   void rehash(std::size_t n)
   {
     auto lck=exclusive_access();
+    complete_migration();
+    discard_next_arrays();
     super::rehash(n);
   }
 
   void reserve(std::size_t n)
   {
     auto lck=exclusive_access();
+    complete_migration();
+    discard_next_arrays();
     super::reserve(n);
   }
 
+  void compact()
+  {
+    auto lck=exclusive_access();
+    complete_migration();
+    super::compact();
+  }
+
+  void prefault()
+  {
+    auto lck=exclusive_access();
+    complete_migration();
+    super::prefault();
+  }
+
+  bool incremental_rehash()const noexcept
+  {
+    auto lck=shared_access();
+    return incremental_;
+  }
+
+  void incremental_rehash(bool enable)
+  {
+    BOOST_UNORDERED_STATIC_ASSERT(
+      std::is_nothrow_move_constructible<init_type>::value||
+      !std::is_same<element_type,value_type>::value);
+
+    auto lck=exclusive_access();
+    if(!enable)complete_migration();
+    incremental_=enable;
+  }
+
 #if defined(BOOST_UNORDERED_ENABLE_STATS)
   /* already thread safe */
 
-  using super::get_stats;
-  using super::reset_stats;
+  stats get_stats()const
+  {
+    stats res;
+    static_cast<typename super::stats&>(res)=super::get_stats();
+    auto growth=growth_cstats.get_summary();
+    res.growth={
+      growth.count,
+      growth.sequence_summary[0],
+      growth.sequence_summary[1]
+    };
+    return res;
+  }
+
+  void reset_stats()noexcept
+  {
+    super::reset_stats();
+    growth_cstats.reset();
+  }
 #endif
 
   template<typename Predicate>
@@ -1041,7 +1497,8 @@ public:
   friend bool operator==(const concurrent_table& x,const concurrent_table& y)
   {
     auto lck=exclusive_access(x,y);
-    return static_cast<const super&>(x)==static_cast<const super&>(y);
+    return static_cast<const super&>(completed(x))==
+           static_cast<const super&>(completed(y));
   }
 
   friend bool operator!=(const concurrent_table& x,const concurrent_table& y)
@@ -1063,15 +1520,21 @@ private:
   using group_insert_counter_type=typename group_access::insert_counter_type;
 
   concurrent_table(const concurrent_table& x,exclusive_lock_guard):
-    super{x}{}
+    super{completed(x)},incremental_{x.incremental_}{}
   concurrent_table(concurrent_table&& x,exclusive_lock_guard):
-    super{std::move(x)}{}
+    super{std::move(completed(x))},incremental_{x.incremental_}
+  {
+    BOOST_UNORDERED_SWAP_STATS(growth_cstats,x.growth_cstats);
+  }
   concurrent_table(
     const concurrent_table& x,const Allocator& al_,exclusive_lock_guard):
-    super{x,al_}{}
+    super{completed(x),al_},incremental_{x.incremental_}{}
   concurrent_table(
     concurrent_table&& x,const Allocator& al_,exclusive_lock_guard):
-    super{std::move(x),al_}{}
+    super{std::move(completed(x)),al_},incremental_{x.incremental_}
+  {
+    BOOST_UNORDERED_SWAP_STATS(growth_cstats,x.growth_cstats);
+  }
 
   inline shared_lock_guard shared_access()const
   {
@@ -1106,13 +1569,25 @@ private:
 
   inline group_shared_lock_guard access(group_shared,std::size_t pos)const
   {
-    return this->arrays.group_accesses()[pos].shared_access();
+    return access(group_shared{},this->arrays,pos);
   }
 
   inline group_exclusive_lock_guard access(
     group_exclusive,std::size_t pos)const
   {
-    return this->arrays.group_accesses()[pos].exclusive_access();
+    return access(group_exclusive{},this->arrays,pos);
+  }
+
+  static inline group_shared_lock_guard access(
+    group_shared,const arrays_type& arrays_,std::size_t pos)
+  {
+    return arrays_.group_accesses()[pos].shared_access();
+  }
+
+  static inline group_exclusive_lock_guard access(
+    group_exclusive,const arrays_type& arrays_,std::size_t pos)
+  {
+    return arrays_.group_accesses()[pos].exclusive_access();
   }
 
   inline group_insert_counter_type& insert_counter(std::size_t pos)const
@@ -1135,6 +1610,26 @@ private:
   >::type
   cast_for(group_exclusive,value_type& x){return x;}
 
+  /* Optimistic reads (BOOST_UNORDERED_OPTIMISTIC_READS) copy elements while
+   * they may be concurrently written to and discard the copy if the group
+   * version changed in the meantime, so they're restricted to flat tables
+   * with trivially copyable elements. ThreadSanitizer would rightly flag
+   * these racy copies, so optimistic reads are disabled under it.
+   */
+
+#if defined(BOOST_UNORDERED_OPTIMISTIC_READS)&&\
+    !defined(BOOST_UNORDERED_THREAD_SANITIZER)
+  static constexpr bool optimistic_reads=
+    std::is_same<element_type,value_type>::value&&
+    is_trivially_copy_constructible<element_type>::value&&
+    std::is_trivially_destructible<element_type>::value;
+#else
+  static constexpr bool optimistic_reads=false;
+#endif
+
+  /* failed attempts before falling back to locking the group */
+  static constexpr unsigned int optimistic_read_attempts=4;
+
   struct erase_on_exit
   {
     erase_on_exit(
@@ -1158,6 +1653,24 @@ private:
   {
     auto lck=shared_access();
     auto hash=this->hash_for(x);
+    if(BOOST_UNLIKELY(migrating())){
+      return unprotected_visit_while_migrating(
+        access_mode,x,hash,std::forward<F>(f));
+    }
+    return unprotected_visit(
+      access_mode,x,this->position_for(hash),hash,std::forward<F>(f));
+  }
+
+  template<typename GroupAccessMode,typename Key,typename F>
+  BOOST_FORCEINLINE std::size_t visit_impl(
+    GroupAccessMode access_mode,prehashed ph,const Key& x,F&& f)const
+  {
+    auto lck=shared_access();
+    auto hash=this->hash_for(ph,x);
+    if(BOOST_UNLIKELY(migrating())){
+      return unprotected_visit_while_migrating(
+        access_mode,x,hash,std::forward<F>(f));
+    }
     return unprotected_visit(
       access_mode,x,this->position_for(hash),hash,std::forward<F>(f));
   }
@@ -1169,6 +1682,13 @@ private:
   {
     auto        lck=shared_access();
     std::size_t res=0;
+    if(BOOST_UNLIKELY(migrating())){
+      for(;first!=last;++first){
+        res+=unprotected_visit_while_migrating(
+          access_mode,*first,this->hash_for(*first),f);
+      }
+      return res;
+    }
     auto        n=static_cast<std::size_t>(std::distance(first,last));
     while(n){
       auto m=n<2*bulk_visit_size?n:bulk_visit_size;
@@ -1236,13 +1756,86 @@ private:
     GroupAccessMode access_mode,
     const Key& x,std::size_t pos0,std::size_t hash,F&& f)const
   {
-    return unprotected_internal_visit(
-      access_mode,x,pos0,hash,
-      [&](group_type*,unsigned int,element_type* p)
-        {f(cast_for(access_mode,type_policy::value_from(*p)));});
+    return unprotected_visit(
+      access_mode,this->arrays,x,pos0,hash,std::forward<F>(f));
   }
 
-#if defined(BOOST_MSVC)
+  template<typename GroupAccessMode,typename Key,typename F>
+  BOOST_FORCEINLINE std::size_t unprotected_visit(
+    GroupAccessMode access_mode,const arrays_type& arrays_,
+    const Key& x,std::size_t pos0,std::size_t hash,F&& f)const
+  {
+    return unprotected_visit(
+      access_mode,
+      std::integral_constant<
+        bool,
+        optimistic_reads&&std::is_same<GroupAccessMode,group_shared>::value
+      >{},
+      arrays_,x,pos0,hash,std::forward<F>(f));
+  }
+
+  template<typename GroupAccessMode,typename Key,typename F>
+  BOOST_FORCEINLINE std::size_t unprotected_visit(
+    GroupAccessMode access_mode,std::false_type /* locked */,
+    const arrays_type& arrays_,
+    const Key& x,std::size_t pos0,std::size_t hash,F&& f)const
+  {
+    return unprotected_internal_visit(
+      access_mode,arrays_,x,pos0,hash,
+      [&](group_type*,unsigned int,element_type* p)
+        {f(cast_for(access_mode,type_policy::value_from(*p)));});
+  }
+
+#if defined(BOOST_UNORDERED_OPTIMISTIC_READS)
+  template<typename Key,typename F>
+  BOOST_FORCEINLINE std::size_t unprotected_visit(
+    group_shared,std::true_type /* optimistic */,
+    const arrays_type& arrays_,
+    const Key& x,std::size_t pos0,std::size_t hash,F&& f)const
+  {
+    return unprotected_optimistic_visit(
+      arrays_,x,pos0,hash,std::forward<F>(f));
+  }
+#endif
+
+  template<typename Key,typename F>
+  BOOST_FORCEINLINE std::size_t unprotected_erase_if(
+    const Key& x,std::size_t hash,F& f)
+  {
+    std::size_t res=0;
+    if(BOOST_UNLIKELY(migrating()))unprotected_migrate_for(hash);
+    unprotected_internal_visit(
+      group_exclusive{},x,this->position_for(hash),hash,
+      [&,this](group_type* pg,unsigned int n,element_type* p)
+      {
+        if(f(cast_for(group_exclusive{},type_policy::value_from(*p)))){
+          super::erase(pg,n,p);
+          res=1;
+        }
+      });
+    return res;
+  }
+
+  /* Lookup while migrating (see class comment): the old arrays are probed
+   * first, then the new ones. The fence pairs with the one in
+   * unprotected_migrate_element so that an element seen to be gone from
+   * the old arrays is found in the new ones.
+   */
+
+  template<typename GroupAccessMode,typename Key,typename F>
+  BOOST_NOINLINE std::size_t unprotected_visit_while_migrating(
+    GroupAccessMode access_mode,const Key& x,std::size_t hash,F&& f)const
+  {
+    if(unprotected_visit(
+      access_mode,old_arrays,x,this->position_for(hash,old_arrays),hash,f)){
+      return 1;
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return unprotected_visit(
+      access_mode,x,this->position_for(hash),hash,std::forward<F>(f));
+  }
+
+#if defined(BOOST_MSVC)
 /* warning: forcing value to bool 'true' or 'false' in bool(pred()...) */
 #pragma warning(push)
 #pragma warning(disable:4800)
@@ -1252,17 +1845,26 @@ private:
   BOOST_FORCEINLINE std::size_t unprotected_internal_visit(
     GroupAccessMode access_mode,
     const Key& x,std::size_t pos0,std::size_t hash,F&& f)const
+  {
+    return unprotected_internal_visit(
+      access_mode,this->arrays,x,pos0,hash,std::forward<F>(f));
+  }
+
+  template<typename GroupAccessMode,typename Key,typename F>
+  BOOST_FORCEINLINE std::size_t unprotected_internal_visit(
+    GroupAccessMode access_mode,const arrays_type& arrays_,
+    const Key& x,std::size_t pos0,std::size_t hash,F&& f)const
   {    
     BOOST_UNORDERED_STATS_COUNTER(num_cmps);
     prober pb(pos0);
     do{
       auto pos=pb.get();
-      auto pg=this->arrays.groups()+pos;
+      auto pg=arrays_.groups()+pos;
       auto mask=pg->match(hash);
       if(mask){
-        auto p=this->arrays.elements()+pos*N;
+        auto p=arrays_.elements()+pos*N;
         BOOST_UNORDERED_PREFETCH_ELEMENTS(p,N);
-        auto lck=access(access_mode,pos);
+        auto lck=access(access_mode,arrays_,pos);
         do{
           auto n=unchecked_countr_zero(mask);
           if(BOOST_LIKELY(pg->is_occupied(n))){
@@ -1283,22 +1885,34 @@ private:
         return 0;
       }
     }
-    while(BOOST_LIKELY(pb.next(this->arrays.groups_size_mask)));
+    while(BOOST_LIKELY(pb.next(arrays_.groups_size_mask)));
     BOOST_UNORDERED_ADD_STATS(
       this->cstats.unsuccessful_lookup,(pb.length(),num_cmps));
     return 0;
   }
 
- template<typename GroupAccessMode,typename FwdIterator,typename F>
+  template<typename GroupAccessMode,typename FwdIterator,typename F>
   BOOST_FORCEINLINE std::size_t unprotected_bulk_visit(
     GroupAccessMode access_mode,FwdIterator first,std::size_t m,F&& f)const
+  {
+    return unprotected_bulk_internal_visit(
+      access_mode,first,m,
+      [&](group_type*,unsigned int,element_type* p)
+        {f(cast_for(access_mode,type_policy::value_from(*p)));});
+  }
+
+  template<typename GroupAccessMode,typename FwdIterator,typename F>
+  BOOST_FORCEINLINE std::size_t unprotected_bulk_internal_visit(
+    GroupAccessMode access_mode,FwdIterator first,std::size_t m,F&& f)const
   {
     BOOST_ASSERT(m<2*bulk_visit_size);
 
+    using mask_type=typename group_type::mask_type;
+
     std::size_t res=0,
                 hashes[2*bulk_visit_size-1],
                 positions[2*bulk_visit_size-1];
-    int         masks[2*bulk_visit_size-1];
+    mask_type   masks[2*bulk_visit_size-1];
     auto        it=first;
 
     for(auto i=m;i--;++it){
@@ -1336,7 +1950,7 @@ private:
             if(BOOST_LIKELY(pg->is_occupied(n))){
               BOOST_UNORDERED_INCREMENT_STATS_COUNTER(num_cmps);
               if(bool(this->pred()(*it,this->key_from(p[n])))){
-                f(cast_for(access_mode,type_policy::value_from(p[n])));
+                f(pg,n,p+n);
                 ++res;
                 BOOST_UNORDERED_ADD_STATS(
                   this->cstats.successful_lookup,(pb.length(),num_cmps));
@@ -1366,6 +1980,90 @@ private:
     return res;
   }
 
+#if defined(BOOST_UNORDERED_OPTIMISTIC_READS)
+  /* Seqlock-style lookup: a matching slot is copied without taking the group
+   * lock, and the copy is only used if the group version read before copying
+   * is even (no writer in progress) and unchanged afterwards. Visitation
+   * functions are then passed the local copy. The container-level shared
+   * lock is still acquired by the callers, as it protects the arrays against
+   * deallocation by rehashing, but it's spread over many cachelines and
+   * written to only by the thread's assigned spinlock.
+   */
+
+  template<typename Key,typename F>
+  BOOST_FORCEINLINE std::size_t unprotected_optimistic_visit(
+    const arrays_type& arrays_,
+    const Key& x,std::size_t pos0,std::size_t hash,F&& f)const
+  {
+    BOOST_UNORDERED_STATS_COUNTER(num_cmps);
+    prober pb(pos0);
+    do{
+      auto pos=pb.get();
+      auto pg=arrays_.groups()+pos;
+      auto mask=pg->match(hash);
+      if(mask){
+        auto        p=arrays_.elements()+pos*N;
+        const auto &acc=arrays_.group_accesses()[pos];
+        BOOST_UNORDERED_PREFETCH_ELEMENTS(p,N);
+        for(unsigned int attempts=0;;){
+          auto ver=acc.read_begin();
+          if(BOOST_LIKELY(!(ver&1))){
+            auto m=mask;
+            do{
+              auto n=unchecked_countr_zero(m);
+              if(BOOST_LIKELY(pg->is_occupied(n))){
+                alignas(element_type) unsigned char buf[sizeof(element_type)];
+                std::memcpy(
+                  buf,static_cast<const void*>(p+n),sizeof(element_type));
+                if(BOOST_UNLIKELY(!acc.read_validate(ver)))goto retry;
+
+                auto &e=*reinterpret_cast<element_type*>(buf);
+                BOOST_UNORDERED_INCREMENT_STATS_COUNTER(num_cmps);
+                if(BOOST_LIKELY(bool(this->pred()(x,this->key_from(e))))){
+                  f(cast_for(group_shared{},type_policy::value_from(e)));
+                  BOOST_UNORDERED_ADD_STATS(
+                    this->cstats.successful_lookup,(pb.length(),num_cmps));
+                  return 1;
+                }
+              }
+              m&=m-1;
+            }while(m);
+            break;
+          }
+        retry:
+          if(BOOST_UNLIKELY(++attempts==optimistic_read_attempts)){
+            auto lck=access(group_shared{},arrays_,pos);
+            do{
+              auto n=unchecked_countr_zero(mask);
+              if(BOOST_LIKELY(pg->is_occupied(n))){
+                BOOST_UNORDERED_INCREMENT_STATS_COUNTER(num_cmps);
+                if(BOOST_LIKELY(bool(this->pred()(x,this->key_from(p[n]))))){
+                  f(cast_for(group_shared{},type_policy::value_from(p[n])));
+                  BOOST_UNORDERED_ADD_STATS(
+                    this->cstats.successful_lookup,(pb.length(),num_cmps));
+                  return 1;
+                }
+              }
+              mask&=mask-1;
+            }while(mask);
+            break;
+          }
+          boost::core::sp_thread_pause();
+        }
+      }
+      if(BOOST_LIKELY(pg->is_not_overflowed(hash))){
+        BOOST_UNORDERED_ADD_STATS(
+          this->cstats.unsuccessful_lookup,(pb.length(),num_cmps));
+        return 0;
+      }
+    }
+    while(BOOST_LIKELY(pb.next(arrays_.groups_size_mask)));
+    BOOST_UNORDERED_ADD_STATS(
+      this->cstats.unsuccessful_lookup,(pb.length(),num_cmps));
+    return 0;
+  }
+#endif
+
 #if defined(BOOST_MSVC)
 #pragma warning(pop) /* C4800 */
 #endif
@@ -1418,9 +2116,12 @@ private:
       this->al(),std::forward<Args>(args)...);
     int res=unprotected_norehash_emplace_or_visit(
       access_mode,std::forward<F>(f),type_policy::move(x.value()));
-    if(BOOST_LIKELY(res>=0))return res!=0;
-
     lck.unlock();
+    if(BOOST_LIKELY(res>=0)){
+      release_old_arrays_if_migrated();
+      return res!=0;
+    }
+
 
     rehash_if_full();
     return noinline_emplace_or_visit(
@@ -1474,7 +2175,249 @@ private:
         auto lck=shared_access();
         int res=unprotected_norehash_emplace_or_visit(
           access_mode,std::forward<F>(f),std::forward<Args>(args)...);
-        if(BOOST_LIKELY(res>=0))return res!=0;
+        if(BOOST_LIKELY(res>=0)){
+          lck.unlock();
+          release_old_arrays_if_migrated();
+          return res!=0;
+        }
+      }
+      rehash_if_full();
+    }
+  }
+
+  template<typename InputIterator>
+  using is_bulk_insertable=std::integral_constant<
+    bool,
+    is_forward_iterator<InputIterator>::value&&
+    is_similar_to_any<
+      decltype(*std::declval<InputIterator&>()),value_type,init_type>::value
+  >;
+
+  template<typename InputIterator>
+  std::size_t insert_range(
+    InputIterator first,InputIterator last,std::false_type /* no bulk */)
+  {
+    std::size_t res=0;
+    for(;first!=last;++first)res+=emplace(*first);
+    return res;
+  }
+
+  template<typename FwdIterator>
+  std::size_t insert_range(
+    FwdIterator first,FwdIterator last,std::true_type /* bulk */)
+  {
+    return bulk_insert_or_visit(
+      group_shared{},first,last,[](const value_type&){});
+  }
+
+  template<typename GroupAccessMode,typename InputIterator,typename F>
+  std::size_t insert_range_or_visit(
+    GroupAccessMode access_mode,InputIterator first,InputIterator last,
+    F&& f,std::false_type /* no bulk */)
+  {
+    std::size_t res=0;
+    for(;first!=last;++first){
+      res+=construct_and_emplace_or_visit(access_mode,f,*first);
+    }
+    return res;
+  }
+
+  template<typename GroupAccessMode,typename FwdIterator,typename F>
+  std::size_t insert_range_or_visit(
+    GroupAccessMode access_mode,FwdIterator first,FwdIterator last,
+    F&& f,std::true_type /* bulk */)
+  {
+    return bulk_insert_or_visit(access_mode,first,last,f);
+  }
+
+  /* Bulk insertion proceeds in chunks of bulk_visit_size, as bulk_visit_impl
+   * does: hash values are computed and groups prefetched for the whole
+   * chunk, whose elements are then processed in order of initial group
+   * position so that those sharing their initial group are looked up and
+   * inserted into it under a single acquisition of the group lock. Elements
+   * that can't be resolved within their initial group (the group is full or
+   * overflowed for the element's hash, some other thread inserted from the
+   * same position in the meantime, the table is full or being migrated) are
+   * left pending and then inserted one by one through the regular path.
+   */
+
+  template<typename GroupAccessMode,typename FwdIterator,typename F>
+  std::size_t bulk_insert_or_visit(
+    GroupAccessMode access_mode,FwdIterator first,FwdIterator last,F&& f)
+  {
+    std::size_t res=0;
+    auto        n=static_cast<std::size_t>(std::distance(first,last));
+    while(n){
+      auto        m=n<2*bulk_visit_size?n:bulk_visit_size;
+      std::size_t pending;
+      {
+        auto lck=shared_access();
+        if(BOOST_LIKELY(!migrating())){
+          pending=0;
+          res+=unprotected_bulk_insert_or_visit(
+            access_mode,first,m,f,pending);
+        }
+        else pending=(std::size_t(1)<<m)-1;
+      }
+      if(BOOST_UNLIKELY(pending!=0)){
+        auto it=first;
+        for(std::size_t i=0;i<m;++i,++it){
+          if(pending&(std::size_t(1)<<i)){
+            res+=emplace_or_visit_impl(access_mode,f,*it);
+          }
+        }
+      }
+      n-=m;
+      std::advance(
+        first,
+        static_cast<
+          typename std::iterator_traits<FwdIterator>::difference_type>(m));
+    }
+    return res;
+  }
+
+  template<typename GroupAccessMode,typename FwdIterator,typename F>
+  BOOST_FORCEINLINE std::size_t unprotected_bulk_insert_or_visit(
+    GroupAccessMode access_mode,FwdIterator first,std::size_t m,F& f,
+    std::size_t& pending)
+  {
+    BOOST_ASSERT(m<2*bulk_visit_size);
+    static_assert(
+      2*bulk_visit_size-1<=sizeof(std::size_t)*CHAR_BIT,
+      "pending elements must fit in a std::size_t mask");
+
+    std::size_t hashes[2*bulk_visit_size-1],
+                positions[2*bulk_visit_size-1],
+                order[2*bulk_visit_size-1];
+    FwdIterator its[2*bulk_visit_size-1];
+    auto        it=first;
+
+    for(std::size_t i=0;i<m;++i,++it){
+      its[i]=it;
+      auto hash=hashes[i]=this->hash_for(this->key_from(*it));
+      auto pos=positions[i]=this->position_for(hash);
+      BOOST_UNORDERED_PREFETCH(this->arrays.groups()+pos);
+      BOOST_UNORDERED_PREFETCH(this->arrays.group_accesses()+pos);
+
+      /* insertion sort, stable so that equivalent elements keep their order */
+
+      auto j=i;
+      for(;j>0&&positions[order[j-1]]>pos;--j)order[j]=order[j-1];
+      order[j]=i;
+    }
+
+    /* prefetch the slot of the element or else where it'd be inserted */
+
+    for(std::size_t i=0;i<m;++i){
+      auto pos=positions[i];
+      auto pg=this->arrays.groups()+pos;
+      auto mask=pg->match(hashes[i]);
+      if(!mask)mask=pg->match_available();
+      if(mask){
+        BOOST_UNORDERED_PREFETCH(
+          this->arrays.elements()+pos*N+unchecked_countr_zero(mask));
+      }
+    }
+
+    std::size_t res=0;
+    for(std::size_t k=0;k<m;){
+      auto pos0=positions[order[k]];
+      auto l=k+1;
+      while(l<m&&positions[order[l]]==pos0)++l;
+      res+=unprotected_insert_or_visit_in_group(
+        access_mode,pos0,order+k,l-k,hashes,its,f,pending);
+      k=l;
+    }
+    return res;
+  }
+
+  template<typename GroupAccessMode,typename FwdIterator,typename F>
+  BOOST_FORCEINLINE std::size_t unprotected_insert_or_visit_in_group(
+    GroupAccessMode access_mode,std::size_t pos0,const std::size_t* indices,
+    std::size_t num_indices,const std::size_t* hashes,const FwdIterator* its,
+    F& f,std::size_t& pending)
+  {
+    std::size_t res=0;
+    bool        prepare=false;
+    auto        pg=this->arrays.groups()+pos0;
+    auto        p=this->arrays.elements()+pos0*N;
+    {
+      auto lck=access(group_exclusive{},pos0);
+
+      /* insertions from pos0 by other threads invalidate our lookups */
+
+      boost::uint32_t counter=insert_counter(pos0);
+
+      for(std::size_t r=0;r<num_indices;++r){
+        BOOST_UNORDERED_STATS_COUNTER(num_cmps);
+        auto        i=indices[r];
+        auto        hash=hashes[i];
+        const auto &k=this->key_from(*its[i]);
+        auto        mask=pg->match(hash);
+        while(mask){
+          auto n=unchecked_countr_zero(mask);
+          if(BOOST_LIKELY(pg->is_occupied(n))){
+            BOOST_UNORDERED_INCREMENT_STATS_COUNTER(num_cmps);
+            if(bool(this->pred()(k,this->key_from(p[n])))){
+              f(cast_for(access_mode,type_policy::value_from(p[n])));
+              BOOST_UNORDERED_ADD_STATS(
+                this->cstats.successful_lookup,(1,num_cmps));
+              goto next_element;
+            }
+          }
+          mask&=mask-1;
+        }
+        if(BOOST_UNLIKELY(!pg->is_not_overflowed(hash))){
+          pending|=std::size_t(1)<<i;
+          continue;
+        }
+        BOOST_UNORDERED_ADD_STATS(
+          this->cstats.unsuccessful_lookup,(1,num_cmps));
+
+        mask=pg->match_available();
+        if(BOOST_UNLIKELY(mask==0||insert_counter(pos0)!=counter)){
+          pending|=std::size_t(1)<<i;
+          continue;
+        }
+        {
+          reserve_size rsize(*this);
+          if(BOOST_UNLIKELY(!rsize.succeeded())){
+            pending|=std::size_t(1)<<i;
+            continue;
+          }
+          auto n=unchecked_countr_zero(mask);
+          ++insert_counter(pos0);
+          ++counter;
+          reserve_slot rslot{pg,n,hash};
+          this->construct_element(p+n,*its[i]);
+          this->arrays.store_hash(pos0*N+n,hash);
+          rslot.commit();
+          if(rsize.commit_under_group_lock())prepare=true;
+          BOOST_UNORDERED_ADD_STATS(this->cstats.insertion,(1));
+          ++res;
+        }
+      next_element:;
+      }
+    }
+    if(BOOST_UNLIKELY(prepare))prepare_next_arrays();
+    return res;
+  }
+
+  template<typename GroupAccessMode,typename F,typename... Args>
+  BOOST_FORCEINLINE bool prehashed_emplace_or_visit_impl(
+    GroupAccessMode access_mode,prehashed ph,F&& f,Args&&... args)
+  {
+    for(;;){
+      {
+        auto lck=shared_access();
+        int res=unprotected_norehash_hashed_emplace_or_visit(
+          access_mode,this->hash_for(ph,this->key_from(args...)),
+          std::forward<F>(f),std::forward<Args>(args)...);
+        if(BOOST_LIKELY(res>=0)){
+          lck.unlock();
+          release_old_arrays_if_migrated();
+          return res!=0;
+        }
       }
       rehash_if_full();
     }
@@ -1502,21 +2445,39 @@ private:
   {
     reserve_size(concurrent_table& x_):x(x_)
     {
-      size_=++x.size_ctrl.size;
+      std::size_t ml=x.size_ctrl.ml;
+      res=x.size_ctrl.size.reserve(ml,ml-ml/8); /* see next_arrays */
     }
 
     ~reserve_size()
     {
-      if(!commit_)--x.size_ctrl.size;
+      if(!commit_){
+        if(succeeded())x.size_ctrl.size.unreserve();
+      }
+      else if(BOOST_UNLIKELY(
+        res==striped_size::reservation_crossed_threshold)){
+        /* group lock already released, container-level read lock held */
+        x.prepare_next_arrays();
+      }
     }
 
-    bool succeeded()const{return size_<=x.size_ctrl.ml;}
+    bool succeeded()const{return res!=striped_size::reservation_failed;}
 
     void commit(){commit_=true;}
 
-    concurrent_table &x;
-    std::size_t       size_;
-    bool              commit_=false;
+    /* the caller is then to prepare the next arrays if this returns true */
+
+    bool commit_under_group_lock()
+    {
+      commit_=true;
+      bool prepare=res==striped_size::reservation_crossed_threshold;
+      res=striped_size::reservation_succeeded;
+      return prepare;
+    }
+
+    concurrent_table         &x;
+    striped_size::reservation res;
+    bool                      commit_=false;
   };
 
   struct reserve_slot
@@ -1545,7 +2506,18 @@ private:
     GroupAccessMode access_mode,F&& f,Args&&... args)
   {
     const auto &k=this->key_from(std::forward<Args>(args)...);
-    auto        hash=this->hash_for(k);
+    return unprotected_norehash_hashed_emplace_or_visit(
+      access_mode,this->hash_for(k),
+      std::forward<F>(f),std::forward<Args>(args)...);
+  }
+
+  template<typename GroupAccessMode,typename F,typename... Args>
+  BOOST_FORCEINLINE int
+  unprotected_norehash_hashed_emplace_or_visit(
+    GroupAccessMode access_mode,std::size_t hash,F&& f,Args&&... args)
+  {
+    const auto &k=this->key_from(std::forward<Args>(args)...);
+    if(BOOST_UNLIKELY(migrating()))unprotected_migrate_for(hash);
     auto        pos0=this->position_for(hash);
 
     for(;;){
@@ -1570,6 +2542,7 @@ private:
             }
             auto p=this->arrays.elements()+pos*N+n;
             this->construct_element(p,std::forward<Args>(args)...);
+            this->arrays.store_hash(pos*N+n,hash);
             rslot.commit();
             rsize.commit();
             BOOST_UNORDERED_ADD_STATS(this->cstats.insertion,(pb.length()));
@@ -1585,9 +2558,241 @@ private:
   void rehash_if_full()
   {
     auto lck=exclusive_access();
-    if(this->size_ctrl.size==this->size_ctrl.ml){
-      this->unchecked_rehash_for_growth();
+    this->size_ctrl.size.fold(); /* reservations may have failed early */
+    if(this->size_ctrl.size>=this->size_ctrl.ml){
+#if defined(BOOST_UNORDERED_ENABLE_STATS)
+      auto start=std::chrono::steady_clock::now();
+      bool preallocated=this->fits_growth(next_arrays);
+#endif
+
+      auto next_arrays_=take_next_arrays();
+      if(incremental_)unchecked_incremental_rehash_for_growth(next_arrays_);
+      else            this->unchecked_rehash_for_growth(next_arrays_);
+
+#if defined(BOOST_UNORDERED_ENABLE_STATS)
+      growth_cstats.add(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now()-start).count(),
+        preallocated?1:0);
+#endif
+    }
+  }
+
+  BOOST_NOINLINE void prepare_next_arrays()noexcept
+  {
+    if(next_arrays_claimed.exchange(true))return;
+    BOOST_TRY{
+      next_arrays=this->new_arrays_for_growth_at_max_load();
+    }
+    BOOST_CATCH(...){
+      /* growth will try again under write access */
+    }
+    BOOST_CATCH_END
+  }
+
+  arrays_type take_next_arrays()noexcept
+  {
+    auto res=next_arrays;
+    next_arrays=no_arrays();
+    next_arrays_claimed=false;
+    return res;
+  }
+
+  void discard_next_arrays()noexcept
+  {
+    arrays_holder<arrays_type,Allocator>{take_next_arrays(),this->al()};
+  }
+
+  /* Incremental rehashing (see class comment). The old arrays are only
+   * replaced or deallocated under container-level write access; elements
+   * are migrated concurrently under read access.
+   */
+
+  static arrays_type no_arrays()noexcept
+  {
+    return {typename arrays_type::super{0,0,nullptr,nullptr},nullptr};
+  }
+
+  bool migrating()const noexcept{return old_arrays.elements()!=nullptr;}
+
+  BOOST_NOINLINE void unchecked_incremental_rehash_for_growth(
+    const arrays_type& next_arrays_)
+  {
+    arrays_holder<arrays_type,Allocator> ah{next_arrays_,this->al()};
+    complete_migration(); /* new arrays filled up before migration ended */
+    if(!this->arrays.elements()){
+      this->unchecked_rehash_for_growth(ah.release());
+      return;
+    }
+    if(!super::unchecked_incremental_rehash_for_growth(
+      old_arrays,ah.release()))return;
+
+    /* Claim enough groups per insertion or erasure to be done before the
+     * new arrays fill up.
+     */
+
+    std::size_t ml=this->size_ctrl.ml,
+                s=this->size_ctrl.size,
+                slack=ml>s?ml-s:0;
+    migration_step=(old_arrays.groups_size_mask+1)/(slack+1)+1;
+    migration_pos=0;
+    num_migrated=0;
+    migration_done=false;
+  }
+
+  static const concurrent_table& completed(const concurrent_table& x)
+  {
+    x.complete_migration();
+    return x;
+  }
+
+  static concurrent_table& completed(concurrent_table& x)
+  {
+    x.complete_migration();
+    return x;
+  }
+
+  /* Requires container-level write access. Moves the elements not yet
+   * migrated (which, if the hash function threw during migration, can be
+   * in any group) and deallocates the old arrays. Const for the same reasons
+   * as foa::table::complete_migration.
+   */
+
+  void complete_migration()const
+  {
+    if(BOOST_UNLIKELY(migrating())){
+      auto& x=const_cast<concurrent_table&>(*this);
+      x.transfer_groups(old_arrays,0,old_arrays.groups_size_mask+1);
+      x.delete_old_arrays(old_arrays);
+      old_arrays=no_arrays();
+      migration_done=false;
+    }
+  }
+
+  /* Requires container-level write access, for clearing operations. */
+
+  void clear_old_arrays()noexcept
+  {
+    if(migrating()){
+      this->delete_old_arrays(old_arrays);
+      old_arrays=no_arrays();
+      migration_done=false;
+    }
+  }
+
+  BOOST_FORCEINLINE void release_old_arrays_if_migrated()
+  {
+    if(BOOST_UNLIKELY(migration_done.load(std::memory_order_relaxed))){
+      release_old_arrays();
+    }
+  }
+
+  BOOST_NOINLINE void release_old_arrays()
+  {
+    auto lck=exclusive_access();
+    if(migration_done)complete_migration();
+  }
+
+  /* Migrates the old groups where an element with the given hash value may
+   * be, and then the next migration_step unclaimed groups.
+   */
+
+  BOOST_NOINLINE void unprotected_migrate_for(std::size_t hash)const
+  {
+    prober pb(this->position_for(hash,old_arrays));
+    do{
+      auto pos=pb.get();
+      auto pg=old_arrays.groups()+pos;
+      if(pg->match(hash))unprotected_migrate_group(pos);
+      if(BOOST_LIKELY(pg->is_not_overflowed(hash)))break;
+    }
+    while(BOOST_LIKELY(pb.next(old_arrays.groups_size_mask)));
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    auto first=migration_pos.fetch_add(migration_step);
+    unprotected_migrate_groups(first,first+migration_step);
+  }
+
+  /* Migrates all remaining groups, for whole-table traversal. Groups
+   * claimed by other threads are locked and found empty once these are
+   * done with them.
+   */
+
+  BOOST_NOINLINE void unprotected_migrate_all()const
+  {
+    std::size_t num_groups=old_arrays.groups_size_mask+1,
+                first=migration_pos.exchange(num_groups);
+    if(first>num_groups)first=num_groups;
+    for(std::size_t pos=0;pos<first;++pos){
+      unprotected_migrate_group(pos);
     }
+    unprotected_migrate_groups(first,num_groups);
+    std::atomic_thread_fence(std::memory_order_acquire);
+  }
+
+  void unprotected_migrate_groups(std::size_t first,std::size_t last)const
+  {
+    std::size_t num_groups=old_arrays.groups_size_mask+1;
+    if(first>=num_groups)return;
+    if(last>num_groups)last=num_groups;
+
+    struct count_on_exit
+    {
+      ~count_on_exit()
+      {
+        if(x.num_migrated.fetch_add(n)+n==
+           x.old_arrays.groups_size_mask+1){
+          x.migration_done=true;
+        }
+      }
+
+      const concurrent_table &x;
+      std::size_t             n;
+    } c{*this,last-first};
+
+    for(;first!=last;++first)unprotected_migrate_group(first);
+  }
+
+  void unprotected_migrate_group(std::size_t pos)const
+  {
+    auto  pg=old_arrays.groups()+pos;
+    auto  last=old_arrays.groups()+old_arrays.groups_size_mask+1;
+    auto  p=old_arrays.elements()+pos*N;
+    if(!this->match_really_occupied(pg,last))return;
+
+    auto lck=access(group_exclusive{},old_arrays,pos);
+    auto mask=this->match_really_occupied(pg,last);
+    while(mask){
+      auto n=unchecked_countr_zero(mask);
+      unprotected_migrate_element(pg,n,p+n);
+      mask&=mask-1;
+    }
+  }
+
+  void unprotected_migrate_element(
+    group_type* pg,unsigned int n,element_type* p)const
+  {
+    auto& x=const_cast<concurrent_table&>(*this);
+    auto  hash=this->hash_for_element(old_arrays,p);
+    for(prober pb(this->position_for(hash));;
+        pb.next(this->arrays.groups_size_mask)){
+      auto pos=pb.get();
+      auto pg1=this->arrays.groups()+pos;
+      auto lck=access(group_exclusive{},pos);
+      auto mask=pg1->match_available();
+      if(BOOST_LIKELY(mask!=0)){
+        auto n1=unchecked_countr_zero(mask);
+        x.construct_element(
+          this->arrays.elements()+pos*N+n1,type_policy::move(*p));
+        pg1->set(n1,hash);
+        this->arrays.store_hash(pos*N+n1,hash);
+        break;
+      }
+      pg1->mark_overflow(hash);
+    }
+    x.destroy_element(p);
+    std::atomic_thread_fence(std::memory_order_release);
+    pg->reset(n);
   }
 
   template<typename GroupAccessMode,typename F>
@@ -1619,6 +2824,7 @@ private:
   auto for_all_elements_while(GroupAccessMode access_mode,F f)const
     ->decltype(f(nullptr,0,nullptr),bool())
   {
+    if(BOOST_UNLIKELY(migrating()))unprotected_migrate_all();
     auto p=this->arrays.elements();
     if(p){
       for(auto pg=this->arrays.groups(),last=pg+this->arrays.groups_size_mask+1;
@@ -1651,6 +2857,7 @@ private:
     GroupAccessMode access_mode,ExecutionPolicy&& policy,F f)const
     ->decltype(f(nullptr,0,nullptr),void())
   {
+    if(BOOST_UNLIKELY(migrating()))unprotected_migrate_all();
     if(!this->arrays.elements())return;
     auto first=this->arrays.groups(),
          last=first+this->arrays.groups_size_mask+1;
@@ -1673,6 +2880,7 @@ private:
   bool for_all_elements_while(
     GroupAccessMode access_mode,ExecutionPolicy&& policy,F f)const
   {
+    if(BOOST_UNLIKELY(migrating()))unprotected_migrate_all();
     if(!this->arrays.elements())return true;
     auto first=this->arrays.groups(),
          last=first+this->arrays.groups_size_mask+1;
@@ -1704,15 +2912,33 @@ private:
   template<typename Archive>
   void save(Archive& ar,unsigned int version)const
   {
-    save(
-      ar,version,
-      std::integral_constant<bool,std::is_same<key_type,value_type>::value>{});
+    if(save_bulk_flag<Archive,concurrent_table>(ar)){
+      save_bulk(ar,use_bulk_serialization<Archive,concurrent_table>{});
+    }
+    else{
+      save(
+        ar,version,
+        std::integral_constant<
+          bool,std::is_same<key_type,value_type>::value>{});
+    }
+  }
+
+  template<typename Archive>
+  void save_bulk(Archive& ar,std::true_type /* bulk */)const
+  {
+    auto lck=exclusive_access();
+    complete_migration();
+    super::save_bulk(ar,[](group_type*,unsigned int,element_type*){});
   }
 
+  template<typename Archive>
+  void save_bulk(Archive&,std::false_type /* not bulk */)const{}
+
   template<typename Archive>
   void save(Archive& ar,unsigned int,std::true_type /* set */)const
   {
     auto                                    lck=exclusive_access();
+    complete_migration();
     const std::size_t                       s=super::size();
     const serialization_version<value_type> value_version;
 
@@ -1734,6 +2960,7 @@ private:
       typename TypePolicy::mapped_type>::type;
 
     auto                                         lck=exclusive_access();
+    complete_migration();
     const std::size_t                            s=super::size();
     const serialization_version<raw_key_type>    key_version;
     const serialization_version<raw_mapped_type> mapped_version;
@@ -1762,9 +2989,31 @@ private:
   template<typename Archive>
   void load(Archive& ar,unsigned int version)
   {
-    load(
-      ar,version,
-      std::integral_constant<bool,std::is_same<key_type,value_type>::value>{});
+    if(load_bulk_flag(ar,version)){
+      load_bulk(ar,use_bulk_serialization<Archive,concurrent_table>{});
+    }
+    else{
+      load(
+        ar,version,
+        std::integral_constant<
+          bool,std::is_same<key_type,value_type>::value>{});
+    }
+  }
+
+  template<typename Archive>
+  void load_bulk(Archive& ar,std::true_type /* bulk */)
+  {
+    auto lck=exclusive_access();
+    clear_old_arrays();
+    super::clear();
+    super::load_bulk(ar,[](group_type*,unsigned int,element_type*){});
+  }
+
+  template<typename Archive>
+  void load_bulk(Archive&,std::false_type /* not bulk */)
+  {
+    /* saved in bulk by a program with a different element type */
+    throw_exception(bad_archive_exception());
   }
 
   template<typename Archive>
@@ -1777,6 +3026,7 @@ private:
     ar>>core::make_nvp("count",s);
     ar>>core::make_nvp("value_version",value_version);
 
+    clear_old_arrays();
     super::clear();
     super::reserve(s);
 
@@ -1809,6 +3059,7 @@ private:
     ar>>core::make_nvp("key_version",key_version);
     ar>>core::make_nvp("mapped_version",mapped_version);
 
+    clear_old_arrays();
     super::clear();
     super::reserve(s);
 
@@ -1831,8 +3082,20 @@ private:
     }
   }
 
-  static std::atomic<std::size_t> thread_counter;
-  mutable multimutex_type         mutexes;
+  static std::atomic<std::size_t>  thread_counter;
+  mutable multimutex_type          mutexes;
+  bool                             incremental_=false;
+  mutable arrays_type              old_arrays=no_arrays();
+  std::size_t                      migration_step=0;
+  mutable std::atomic<std::size_t> migration_pos{0},
+                                   num_migrated{0};
+  mutable std::atomic<bool>        migration_done{false};
+  arrays_type                      next_arrays=no_arrays();
+  std::atomic<bool>                next_arrays_claimed{false};
+
+#if defined(BOOST_UNORDERED_ENABLE_STATS)
+  mutable concurrent_cumulative_stats<2> growth_cstats;
+#endif
 };
 
 template<typename T,typename H,typename P,typename A>
@@ -1847,6 +3110,21 @@ std::atomic<std::size_t> concurrent_table<T,H,P,A>::thread_counter={};
 } /* namespace foa */
 } /* namespace detail */
 } /* namespace unordered */
+
+namespace serialization{
+
+template<typename TypePolicy,typename Hash,typename Pred,typename Allocator>
+struct version<
+  boost::unordered::detail::foa::concurrent_table<
+    TypePolicy,Hash,Pred,Allocator>
+>
+{
+  BOOST_STATIC_CONSTANT(
+    int,value=boost::unordered::detail::foa::bulk_serialization_version);
+};
+
+} /* namespace serialization */
+
 } /* namespace boost */
 
 #endif
@@ -23,7 +23,9 @@
 #include <boost/core/pointer_traits.hpp>
 #include <boost/cstdint.hpp>
 #include <boost/predef.h>
+#include <boost/throw_exception.hpp>
 #include <boost/unordered/detail/allocator_constructed.hpp>
+#include <boost/unordered/detail/bad_archive_exception.hpp>
 #include <boost/unordered/detail/narrow_cast.hpp>
 #include <boost/unordered/detail/mulx.hpp>
 #include <boost/unordered/detail/static_assert.hpp>
@@ -34,17 +36,35 @@
 #include <cmath>
 #include <cstddef>
 #include <cstring>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <new>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #if defined(BOOST_UNORDERED_ENABLE_STATS)
 #include <boost/unordered/detail/foa/cumulative_stats.hpp>
 #endif
 
+#if !defined(BOOST_UNORDERED_DISABLE_PARALLEL_ALGORITHMS)
+#if defined(BOOST_UNORDERED_ENABLE_PARALLEL_ALGORITHMS)|| \
+    !defined(BOOST_NO_CXX17_HDR_EXECUTION)
+#define BOOST_UNORDERED_PARALLEL_ALGORITHMS
+#endif
+#endif
+
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+#include <boost/unordered/detail/foa/rw_spinlock.hpp>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <execution>
+#include <mutex>
+#endif
+
 #if !defined(BOOST_UNORDERED_DISABLE_SSE2)
 #if defined(BOOST_UNORDERED_ENABLE_SSE2)|| \
     defined(__SSE2__)|| \
@@ -60,12 +80,57 @@
 #endif
 #endif
 
+#if !defined(BOOST_UNORDERED_DISABLE_AVX2)
+#if defined(BOOST_UNORDERED_ENABLE_AVX2)||defined(__AVX2__)
+#define BOOST_UNORDERED_AVX2
+#endif
+#endif
+
+#if !defined(BOOST_UNORDERED_DISABLE_AVX512)
+#if defined(BOOST_UNORDERED_ENABLE_AVX512)||defined(__AVX512BW__)
+#define BOOST_UNORDERED_AVX512
+#endif
+#endif
+
 #if defined(BOOST_UNORDERED_SSE2)
 #include <emmintrin.h>
 #elif defined(BOOST_UNORDERED_LITTLE_ENDIAN_NEON)
 #include <arm_neon.h>
 #endif
 
+#if defined(BOOST_UNORDERED_AVX2)||defined(BOOST_UNORDERED_AVX512)
+#include <immintrin.h>
+#endif
+
+/* BOOST_UNORDERED_GROUP_SIZE selects the metadata group used by all FOA
+ * containers: 15 (default, group15), 31 (group31, requires AVX2) or
+ * 63 (group63, requires AVX-512BW). All translation units in a program must
+ * agree on this setting.
+ */
+
+#if !defined(BOOST_UNORDERED_GROUP_SIZE)
+#define BOOST_UNORDERED_GROUP_SIZE 15
+#endif
+
+#if BOOST_UNORDERED_GROUP_SIZE==31
+#if !defined(BOOST_UNORDERED_AVX2)
+#error "BOOST_UNORDERED_GROUP_SIZE==31 requires AVX2"
+#endif
+#elif BOOST_UNORDERED_GROUP_SIZE==63
+#if !defined(BOOST_UNORDERED_AVX512)
+#error "BOOST_UNORDERED_GROUP_SIZE==63 requires AVX-512BW"
+#endif
+#elif BOOST_UNORDERED_GROUP_SIZE!=15
+#error "BOOST_UNORDERED_GROUP_SIZE must be one of 15, 31, 63"
+#endif
+
+/* If BOOST_UNORDERED_FINE_GRAINED_SIZES is defined, FOA containers use
+ * fastrange_size_policy instead of pow2_size_policy, trading slightly slower
+ * hash->position mapping and more frequent rehashing for lower memory
+ * overshoot after growth. As with BOOST_UNORDERED_GROUP_SIZE, all translation
+ * units in a program must agree on this setting.
+ */
+
 #ifdef __has_builtin
 #define BOOST_UNORDERED_HAS_BUILTIN(x) __has_builtin(x)
 #else
@@ -146,6 +211,23 @@
 namespace boost{
 namespace unordered{
 namespace detail{
+
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+
+template<typename ExecutionPolicy>
+using is_execution_policy=std::is_execution_policy<
+  typename std::remove_cv<
+    typename std::remove_reference<ExecutionPolicy>::type
+  >::type
+>;
+
+#else
+
+template<typename ExecutionPolicy>
+using is_execution_policy=std::false_type;
+
+#endif
+
 namespace foa{
 
 static constexpr std::size_t default_bucket_count=0;
@@ -155,7 +237,8 @@ static constexpr std::size_t default_bucket_count=0;
  * boost::unordered_(flat|node)_(map|set) and boost::concurrent_flat_(map|set),
  * respectively. Its main internal design aspects are:
  * 
- *   - Element slots are logically split into groups of size N=15. The number
+ *   - Element slots are logically split into groups of size N=15 (or 31/63
+ *     with wide SIMD groups, see BOOST_UNORDERED_GROUP_SIZE). The number
  *     of groups is always a power of two, so the number of allocated slots
        is of the form (N*2^n)-1 (final slot reserved for a sentinel mark).
  *   - Positioning is done at the group level rather than the slot level, that
@@ -221,6 +304,7 @@ struct group15
 {
   static constexpr std::size_t N=15;
   static constexpr bool        regular_layout=true;
+  using mask_type=int;
 
   struct dummy_group_type
   {
@@ -284,6 +368,11 @@ struct group15
     overflow()|=static_cast<unsigned char>(1<<(hash%8));
   }
 
+  inline void reset_overflow()
+  {
+    overflow()=0;
+  }
+
   static inline bool maybe_caused_overflow(unsigned char* pc)
   {
     std::size_t pos=reinterpret_cast<uintptr_t>(pc)%sizeof(group15);
@@ -424,6 +513,7 @@ struct group15
 {
   static constexpr std::size_t N=15;
   static constexpr bool        regular_layout=true;
+  using mask_type=int;
 
   struct dummy_group_type
   {
@@ -486,6 +576,11 @@ struct group15
     overflow()|=static_cast<unsigned char>(1<<(hash%8));
   }
 
+  inline void reset_overflow()
+  {
+    overflow()=0;
+  }
+
   static inline bool maybe_caused_overflow(unsigned char* pc)
   {
     std::size_t pos=reinterpret_cast<uintptr_t>(pc)%sizeof(group15);
@@ -619,6 +714,7 @@ struct group15
 {
   static constexpr std::size_t N=15;
   static constexpr bool        regular_layout=false;
+  using mask_type=int;
 
   struct dummy_group_type
   {
@@ -677,6 +773,12 @@ struct group15
     reinterpret_cast<boost::uint16_t*>(m)[hash%8]|=0x8000u;
   }
 
+  inline void reset_overflow()
+  {
+    m[0]&=boost::uint64_t(0x7FFF7FFF7FFF7FFFull);
+    m[1]&=boost::uint64_t(0x7FFF7FFF7FFF7FFFull);
+  }
+
   static inline bool maybe_caused_overflow(unsigned char* pc)
   {
     std::size_t     pos=reinterpret_cast<uintptr_t>(pc)%sizeof(group15);
@@ -798,173 +900,792 @@ private:
 
 #endif
 
-/* foa::table_core uses a size policy to obtain the permissible sizes of the
- * group array (and, by implication, the element array) and to do the
- * hash->group mapping.
- * 
- *   - size_index(n) returns an unspecified "index" number used in other policy
- *     operations.
- *   - size(size_index_) returns the number of groups for the given index. It
- *     is guaranteed that size(size_index(n)) >= n.
- *   - min_size() is the minimum number of groups permissible, i.e.
- *     size(size_index(0)).
- *   - position(hash,size_index_) maps hash to a position in the range
- *     [0,size(size_index_)).
- * 
- * The reason we're introducing the intermediate index value for calculating
- * sizes and positions is that it allows us to optimize the implementation of
- * position, which is in the hot path of lookup and insertion operations:
- * pow2_size_policy, the actual size policy used by foa::table, returns 2^n
- * (n>0) as permissible sizes and returns the n most significant bits
- * of the hash value as the position in the group array; using a size index
- * defined as i = (bits in std::size_t) - n, we have an unbeatable
- * implementation of position(hash) as hash>>i.
- * There's a twofold reason for choosing the high bits of hash for positioning:
- *   - Multiplication-based mixing tends to yield better entropy in the high
- *     part of its result.
- *   - group15 reduced-hash values take the *low* bits of hash, and we want
- *     these values and positioning to be as uncorrelated as possible.
+/* group31 and group63 are wider variants of group15 holding N=31 and N=63
+ * element slots, respectively, with a 32B/64B metadata word laid out as in
+ * group15 (reduced hash values in bytes 0..N-1 and the overflow byte at
+ * position N). Matching is done with 256-bit AVX2 and 512-bit AVX-512BW
+ * operations: a probe step thus checks twice/four times as many slots as
+ * with group15, which reduces the number of groups (and cache lines) visited
+ * on unsuccessful lookups and long probe sequences, at the expense of
+ * coarser-grained group locking in foa::concurrent_table. These groups are
+ * opt-in via BOOST_UNORDERED_GROUP_SIZE.
  */
 
-struct pow2_size_policy
+#if defined(BOOST_UNORDERED_AVX2)
+
+template<template<typename> class IntegralWrapper>
+struct group31
 {
-  static inline std::size_t size_index(std::size_t n)
+  static constexpr std::size_t N=31;
+  static constexpr bool        regular_layout=true;
+  using mask_type=int;
+
+  struct dummy_group_type
   {
-    // TODO: min size is 2, see if we can bring it down to 1 without loss
-    // of performance
+    alignas(32) unsigned char storage[N+1]={
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0};
+  };
 
-    return sizeof(std::size_t)*CHAR_BIT-
-      (n<=2?1:((std::size_t)(boost::core::bit_width(n-1))));
+  inline void initialize()
+  {
+    _mm256_store_si256(
+      reinterpret_cast<__m256i*>(m),_mm256_setzero_si256());
   }
 
-  static inline std::size_t size(std::size_t size_index_)
+  inline void set(std::size_t pos,std::size_t hash)
   {
-     return std::size_t(1)<<(sizeof(std::size_t)*CHAR_BIT-size_index_);  
+    BOOST_ASSERT(pos<N);
+    at(pos)=reduced_hash(hash);
   }
-    
-  static constexpr std::size_t min_size(){return 2;}
 
-  static inline std::size_t position(std::size_t hash,std::size_t size_index_)
+  inline void set_sentinel()
   {
-    return hash>>size_index_;
+    at(N-1)=sentinel_;
   }
-};
 
-/* size index of a group array for a given *element* capacity */
+  inline bool is_sentinel(std::size_t pos)const
+  {
+    BOOST_ASSERT(pos<N);
+    return at(pos)==sentinel_;
+  }
 
-template<typename Group,typename SizePolicy>
-static inline std::size_t size_index_for(std::size_t n)
-{
-  /* n/N+1 == ceil((n+1)/N) (extra +1 for the sentinel) */
-  return SizePolicy::size_index(n/Group::N+1);
-}
+  static inline bool is_sentinel(unsigned char* pc)noexcept
+  {
+    return *pc==sentinel_;
+  }
 
-/* Quadratic prober over a power-of-two range using triangular numbers.
- * mask in next(mask) must be the range size minus one (and since size is 2^n,
- * mask has exactly its n first bits set to 1).
- */
+  inline void reset(std::size_t pos)
+  {
+    BOOST_ASSERT(pos<N);
+    at(pos)=available_;
+  }
 
-struct pow2_quadratic_prober
-{
-  pow2_quadratic_prober(std::size_t pos_):pos{pos_}{}
+  static inline void reset(unsigned char* pc)
+  {
+    *reinterpret_cast<slot_type*>(pc)=available_;
+  }
 
-  inline std::size_t get()const{return pos;}
-  inline std::size_t length()const{return step+1;}
+  inline int match(std::size_t hash)const
+  {
+    return _mm256_movemask_epi8(
+      _mm256_cmpeq_epi8(
+        load_metadata(),_mm256_set1_epi8((char)reduced_hash(hash))))&
+      0x7FFFFFFF;
+  }
 
-  /* next returns false when the whole array has been traversed, which ends
-   * probing (in practice, full-table probing will only happen with very small
-   * arrays).
-   */
+  inline bool is_not_overflowed(std::size_t hash)const
+  {
+    static constexpr unsigned char shift[]={1,2,4,8,16,32,64,128};
 
-  inline bool next(std::size_t mask)
+    return !(overflow()&shift[hash%8]);
+  }
+
+  inline void mark_overflow(std::size_t hash)
   {
-    step+=1;
-    pos=(pos+step)&mask;
-    return step<=mask;
+    overflow()|=static_cast<unsigned char>(1<<(hash%8));
   }
 
-private:
-  std::size_t pos,step=0;
-};
+  inline void reset_overflow()
+  {
+    overflow()=0;
+  }
 
-/* Mixing policies: no_mix is the identity function, and mulx_mix
- * uses the mulx function from <boost/unordered/detail/mulx.hpp>.
- *
- * foa::table_core mixes hash results with mulx_mix unless the hash is marked
- * as avalanching, i.e. of good quality
- * (see <boost/unordered/hash_traits.hpp>).
- */
+  static inline bool maybe_caused_overflow(unsigned char* pc)
+  {
+    std::size_t pos=reinterpret_cast<uintptr_t>(pc)%sizeof(group31);
+    group31    *pg=reinterpret_cast<group31*>(pc-pos);
+    return !pg->is_not_overflowed(*pc);
+  }
 
-struct no_mix
-{
-  template<typename Hash,typename T>
-  static inline std::size_t mix(const Hash& h,const T& x)
+  inline int match_available()const
   {
-    return h(x);
+    return _mm256_movemask_epi8(
+      _mm256_cmpeq_epi8(load_metadata(),_mm256_setzero_si256()))&0x7FFFFFFF;
   }
-};
 
-struct mulx_mix
-{
-  template<typename Hash,typename T>
-  static inline std::size_t mix(const Hash& h,const T& x)
+  inline bool is_occupied(std::size_t pos)const
   {
-    return mulx(h(x));
+    BOOST_ASSERT(pos<N);
+    return at(pos)!=available_;
   }
-};
 
-/* boost::core::countr_zero has a potentially costly check for
- * the case x==0.
- */
+  static inline bool is_occupied(unsigned char* pc)noexcept
+  {
+    return *reinterpret_cast<slot_type*>(pc)!=available_;
+  }
 
-inline unsigned int unchecked_countr_zero(int x)
-{
-#if defined(BOOST_MSVC)
-  unsigned long r;
-  _BitScanForward(&r,(unsigned long)x);
-  return (unsigned int)r;
+  inline int match_occupied()const
+  {
+    return (~match_available())&0x7FFFFFFF;
+  }
+
+private:
+  using slot_type=IntegralWrapper<unsigned char>;
+  BOOST_UNORDERED_STATIC_ASSERT(sizeof(slot_type)==1);
+
+  static constexpr unsigned char available_=0,
+                                 sentinel_=1;
+
+  inline __m256i load_metadata()const
+  {
+#if defined(BOOST_UNORDERED_THREAD_SANITIZER)
+    /* ThreadSanitizer complains on 1-byte atomic writes combined with
+     * 32-byte atomic reads.
+     */
+
+    return _mm256_set_epi8(
+      (char)m[31],(char)m[30],(char)m[29],(char)m[28],
+      (char)m[27],(char)m[26],(char)m[25],(char)m[24],
+      (char)m[23],(char)m[22],(char)m[21],(char)m[20],
+      (char)m[19],(char)m[18],(char)m[17],(char)m[16],
+      (char)m[15],(char)m[14],(char)m[13],(char)m[12],
+      (char)m[11],(char)m[10],(char)m[ 9],(char)m[ 8],
+      (char)m[ 7],(char)m[ 6],(char)m[ 5],(char)m[ 4],
+      (char)m[ 3],(char)m[ 2],(char)m[ 1],(char)m[ 0]);
 #else
-  BOOST_UNORDERED_ASSUME(x!=0);
-  return (unsigned int)boost::core::countr_zero((unsigned int)x);
+    return _mm256_load_si256(reinterpret_cast<const __m256i*>(m));
 #endif
-}
-
-/* table_arrays controls allocation, initialization and deallocation of
- * paired arrays of groups and element slots. Only one chunk of memory is
- * allocated to place both arrays: this is not done for efficiency reasons,
- * but in order to be able to properly align the group array without storing
- * additional offset information --the alignment required (16B) is usually
- * greater than alignof(std::max_align_t) and thus not guaranteed by
- * allocators.
- */
+  }
 
-template<typename Group,std::size_t Size>
-Group* dummy_groups()
-{
-  /* Dummy storage initialized as if in an empty container (actually, each
-   * of its groups is initialized like a separate empty container).
-   * We make table_arrays::groups point to this when capacity()==0, so that
-   * we are not allocating any dynamic memory and yet lookup can be implemented
-   * without checking for groups==nullptr. This space won't ever be used for
-   * insertion as the container's capacity is precisely zero.
+  /* same mapping as group15::match_word: 0 and 1 are reserved for
+   * available/sentinel slots and mapped to 8 and 9 so that reduced hashes
+   * stay invariant under modulo 8.
    */
 
-  static constexpr typename Group::dummy_group_type
-  storage[Size]={typename Group::dummy_group_type(),};
+  inline static unsigned char reduced_hash(std::size_t hash)
+  {
+    auto h=narrow_cast<unsigned char>(hash);
+    return h<2?static_cast<unsigned char>(h+8):h;
+  }
 
-  return reinterpret_cast<Group*>(
-    const_cast<typename Group::dummy_group_type*>(storage));
-}
+  inline slot_type& at(std::size_t pos)
+  {
+    return m[pos];
+  }
 
-template<
-  typename Ptr,typename Ptr2,
-  typename std::enable_if<!std::is_same<Ptr,Ptr2>::value>::type* = nullptr
->
-Ptr to_pointer(Ptr2 p)
-{
-  if(!p){return nullptr;}
-  return boost::pointer_traits<Ptr>::pointer_to(*p);
-}
+  inline const slot_type& at(std::size_t pos)const
+  {
+    return m[pos];
+  }
+
+  inline slot_type& overflow()
+  {
+    return at(N);
+  }
+
+  inline const slot_type& overflow()const
+  {
+    return at(N);
+  }
+
+  alignas(32) slot_type m[32];
+};
+
+#endif
+
+#if defined(BOOST_UNORDERED_AVX512)
+
+template<template<typename> class IntegralWrapper>
+struct group63
+{
+  static constexpr std::size_t N=63;
+  static constexpr bool        regular_layout=true;
+  using mask_type=boost::uint64_t;
+
+  struct dummy_group_type
+  {
+    alignas(64) unsigned char storage[N+1]={
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+      0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0};
+  };
+
+  inline void initialize()
+  {
+    _mm512_store_si512(
+      reinterpret_cast<__m512i*>(m),_mm512_setzero_si512());
+  }
+
+  inline void set(std::size_t pos,std::size_t hash)
+  {
+    BOOST_ASSERT(pos<N);
+    at(pos)=reduced_hash(hash);
+  }
+
+  inline void set_sentinel()
+  {
+    at(N-1)=sentinel_;
+  }
+
+  inline bool is_sentinel(std::size_t pos)const
+  {
+    BOOST_ASSERT(pos<N);
+    return at(pos)==sentinel_;
+  }
+
+  static inline bool is_sentinel(unsigned char* pc)noexcept
+  {
+    return *pc==sentinel_;
+  }
+
+  inline void reset(std::size_t pos)
+  {
+    BOOST_ASSERT(pos<N);
+    at(pos)=available_;
+  }
+
+  static inline void reset(unsigned char* pc)
+  {
+    *reinterpret_cast<slot_type*>(pc)=available_;
+  }
+
+  inline mask_type match(std::size_t hash)const
+  {
+    return static_cast<mask_type>(
+      _mm512_cmpeq_epi8_mask(
+        load_metadata(),_mm512_set1_epi8((char)reduced_hash(hash))))&
+      mask_;
+  }
+
+  inline bool is_not_overflowed(std::size_t hash)const
+  {
+    static constexpr unsigned char shift[]={1,2,4,8,16,32,64,128};
+
+    return !(overflow()&shift[hash%8]);
+  }
+
+  inline void mark_overflow(std::size_t hash)
+  {
+    overflow()|=static_cast<unsigned char>(1<<(hash%8));
+  }
+
+  inline void reset_overflow()
+  {
+    overflow()=0;
+  }
+
+  static inline bool maybe_caused_overflow(unsigned char* pc)
+  {
+    std::size_t pos=reinterpret_cast<uintptr_t>(pc)%sizeof(group63);
+    group63    *pg=reinterpret_cast<group63*>(pc-pos);
+    return !pg->is_not_overflowed(*pc);
+  }
+
+  inline mask_type match_available()const
+  {
+    return static_cast<mask_type>(
+      _mm512_cmpeq_epi8_mask(load_metadata(),_mm512_setzero_si512()))&
+      mask_;
+  }
+
+  inline bool is_occupied(std::size_t pos)const
+  {
+    BOOST_ASSERT(pos<N);
+    return at(pos)!=available_;
+  }
+
+  static inline bool is_occupied(unsigned char* pc)noexcept
+  {
+    return *reinterpret_cast<slot_type*>(pc)!=available_;
+  }
+
+  inline mask_type match_occupied()const
+  {
+    return (~match_available())&mask_;
+  }
+
+private:
+  using slot_type=IntegralWrapper<unsigned char>;
+  BOOST_UNORDERED_STATIC_ASSERT(sizeof(slot_type)==1);
+
+  static constexpr unsigned char available_=0,
+                                 sentinel_=1;
+  static constexpr mask_type     mask_=0x7FFFFFFFFFFFFFFFull;
+
+  inline __m512i load_metadata()const
+  {
+#if defined(BOOST_UNORDERED_THREAD_SANITIZER)
+    /* ThreadSanitizer complains on 1-byte atomic writes combined with
+     * 64-byte atomic reads.
+     */
+
+    alignas(64) unsigned char data[N+1];
+    for(std::size_t i=0;i<N+1;++i)data[i]=(unsigned char)m[i];
+    return _mm512_load_si512(reinterpret_cast<const void*>(data));
+#else
+    return _mm512_load_si512(reinterpret_cast<const void*>(m));
+#endif
+  }
+
+  inline static unsigned char reduced_hash(std::size_t hash)
+  {
+    auto h=narrow_cast<unsigned char>(hash);
+    return h<2?static_cast<unsigned char>(h+8):h;
+  }
+
+  inline slot_type& at(std::size_t pos)
+  {
+    return m[pos];
+  }
+
+  inline const slot_type& at(std::size_t pos)const
+  {
+    return m[pos];
+  }
+
+  inline slot_type& overflow()
+  {
+    return at(N);
+  }
+
+  inline const slot_type& overflow()const
+  {
+    return at(N);
+  }
+
+  alignas(64) slot_type m[64];
+};
+
+#endif
+
+/* default_group is the group type selected by BOOST_UNORDERED_GROUP_SIZE. */
+
+#if BOOST_UNORDERED_GROUP_SIZE==31
+template<template<typename> class IntegralWrapper>
+using default_group=group31<IntegralWrapper>;
+#elif BOOST_UNORDERED_GROUP_SIZE==63
+template<template<typename> class IntegralWrapper>
+using default_group=group63<IntegralWrapper>;
+#else
+template<template<typename> class IntegralWrapper>
+using default_group=group15<IntegralWrapper>;
+#endif
+
+/* foa::table_core uses a size policy to obtain the permissible sizes of the
+ * group array (and, by implication, the element array) and to do the
+ * hash->group mapping.
+ * 
+ *   - size_index(n) returns an unspecified "index" number used in other policy
+ *     operations.
+ *   - size(size_index_) returns the number of groups for the given index. It
+ *     is guaranteed that size(size_index(n)) >= n.
+ *   - min_size() is the minimum number of groups permissible, i.e.
+ *     size(size_index(0)).
+ *   - position(hash,size_index_) maps hash to a position in the range
+ *     [0,size(size_index_)).
+ * 
+ * The reason we're introducing the intermediate index value for calculating
+ * sizes and positions is that it allows us to optimize the implementation of
+ * position, which is in the hot path of lookup and insertion operations:
+ * pow2_size_policy, the default size policy used by foa::table, returns 2^n
+ * (n>0) as permissible sizes and returns the n most significant bits
+ * of the hash value as the position in the group array; using a size index
+ * defined as i = (bits in std::size_t) - n, we have an unbeatable
+ * implementation of position(hash) as hash>>i.
+ * There's a twofold reason for choosing the high bits of hash for positioning:
+ *   - Multiplication-based mixing tends to yield better entropy in the high
+ *     part of its result.
+ *   - group15 reduced-hash values take the *low* bits of hash, and we want
+ *     these values and positioning to be as uncorrelated as possible.
+ */
+
+struct pow2_size_policy
+{
+  static inline std::size_t size_index(std::size_t n)
+  {
+    // TODO: min size is 2, see if we can bring it down to 1 without loss
+    // of performance
+
+    return sizeof(std::size_t)*CHAR_BIT-
+      (n<=2?1:((std::size_t)(boost::core::bit_width(n-1))));
+  }
+
+  static inline std::size_t size(std::size_t size_index_)
+  {
+     return std::size_t(1)<<(sizeof(std::size_t)*CHAR_BIT-size_index_);  
+  }
+    
+  static constexpr std::size_t min_size(){return 2;}
+
+  static inline std::size_t position(std::size_t hash,std::size_t size_index_)
+  {
+    return hash>>size_index_;
+  }
+};
+
+/* fastrange_size_policy allows for sizes of the form 2^n and 3*2^(n-1), so
+ * that growth proceeds in alternate steps of 1.5x and 1.33x rather than 2x,
+ * and maps hash to [0,size) as the high word of hash*size (Lemire's fast
+ * range reduction). Like pow2_size_policy, this takes the high bits of hash
+ * for positioning, and in fact yields the exact same positions when size is
+ * a power of two. The size index is the size itself.
+ */
+
+struct fastrange_size_policy
+{
+  static inline std::size_t size_index(std::size_t n)
+  {
+    if(n<=2)return 2;
+
+    std::size_t p=boost::core::bit_ceil(n),
+                q=p/4*3;
+    return q>=n?q:p;
+  }
+
+  static inline std::size_t size(std::size_t size_index_)
+  {
+    return size_index_;
+  }
+
+  static constexpr std::size_t min_size(){return 2;}
+
+  static inline std::size_t position(std::size_t hash,std::size_t size_index_)
+  {
+    return mulhi(hash,size_index_);
+  }
+};
+
+/* size index of a group array for a given *element* capacity */
+
+template<typename Group,typename SizePolicy>
+static inline std::size_t size_index_for(std::size_t n)
+{
+  /* n/N+1 == ceil((n+1)/N) (extra +1 for the sentinel) */
+  return SizePolicy::size_index(n/Group::N+1);
+}
+
+/* Quadratic prober over a power-of-two range using triangular numbers.
+ * mask in next(mask) must be the range size minus one (and since size is 2^n,
+ * mask has exactly its n first bits set to 1).
+ */
+
+struct pow2_quadratic_prober
+{
+  pow2_quadratic_prober(std::size_t pos_):pos{pos_}{}
+
+  inline std::size_t get()const{return pos;}
+  inline std::size_t length()const{return step+1;}
+
+  /* next returns false when the whole array has been traversed, which ends
+   * probing (in practice, full-table probing will only happen with very small
+   * arrays).
+   */
+
+  inline bool next(std::size_t mask)
+  {
+    step+=1;
+    pos=(pos+step)&mask;
+    return step<=mask;
+  }
+
+private:
+  std::size_t pos,step=0;
+};
+
+/* Quadratic prober over an arbitrary range [0,mask] (mask being the range
+ * size minus one, as with pow2_quadratic_prober). Triangular probing only
+ * visits every position when the range size is a power of two, so we probe
+ * over the smallest power-of-two range covering [0,mask] and skip positions
+ * falling outside. For power-of-two ranges, this behaves exactly as
+ * pow2_quadratic_prober.
+ */
+
+struct covering_quadratic_prober
+{
+  covering_quadratic_prober(std::size_t pos_):pos{pos_}{}
+
+  inline std::size_t get()const{return pos;}
+  inline std::size_t length()const{return step+1;}
+
+  inline bool next(std::size_t mask)
+  {
+    std::size_t cover_mask=boost::core::bit_ceil(mask+1)-1;
+    do{
+      step+=1;
+      pos=(pos+step)&cover_mask;
+    }while(pos>mask);
+    return step<=cover_mask;
+  }
+
+private:
+  std::size_t pos,step=0;
+};
+
+/* default_size_policy and default_prober are selected by
+ * BOOST_UNORDERED_FINE_GRAINED_SIZES.
+ */
+
+#if defined(BOOST_UNORDERED_FINE_GRAINED_SIZES)
+using default_size_policy=fastrange_size_policy;
+using default_prober=covering_quadratic_prober;
+#else
+using default_size_policy=pow2_size_policy;
+using default_prober=pow2_quadratic_prober;
+#endif
+
+/* Fingerprint of the configuration-dependent layout of group arrays, for
+ * formats storing these arrays verbatim.
+ */
+
+static constexpr boost::uint32_t arrays_layout=
+  static_cast<boost::uint32_t>(BOOST_UNORDERED_GROUP_SIZE)
+#if defined(BOOST_UNORDERED_SSE2)
+  |(1u<<8)
+#elif defined(BOOST_UNORDERED_LITTLE_ENDIAN_NEON)
+  |(2u<<8)
+#endif
+#if defined(BOOST_UNORDERED_FINE_GRAINED_SIZES)
+  |(1u<<16)
+#endif
+  ;
+
+/* Saved ahead of the arrays by table_core::save_bulk. */
+
+struct bulk_serialization_header
+{
+  boost::uint32_t layout;
+  boost::uint32_t size_t_size;
+  boost::uint32_t group_size;
+  boost::uint32_t element_size;
+  boost::uint32_t hash_slot_size; /* 0 if hashes not stored */
+  boost::uint32_t reserved;
+  boost::uint64_t num_groups;     /* 0 if no arrays */
+  boost::uint64_t size;
+  boost::uint64_t ml;
+  boost::uint64_t hash_digest;
+};
+
+/* Coalesce the many small runs of elements saved and loaded by
+ * table_core::save_bulk/load_bulk into fewer calls to the archive.
+ */
+
+static constexpr std::size_t bulk_buffer_size=16384;
+
+template<typename Archive>
+struct bulk_binary_writer
+{
+  explicit bulk_binary_writer(Archive& ar_):ar{ar_}{}
+  bulk_binary_writer(const bulk_binary_writer&)=delete;
+  bulk_binary_writer& operator=(const bulk_binary_writer&)=delete;
+
+  void write(const void* p,std::size_t n)
+  {
+    if(n>bulk_buffer_size-m){
+      flush();
+      if(n>=bulk_buffer_size){
+        ar.save_binary(p,n);
+        return;
+      }
+    }
+    std::memcpy(buf+m,p,n);
+    m+=n;
+  }
+
+  void flush()
+  {
+    if(m){
+      ar.save_binary(buf,m);
+      m=0;
+    }
+  }
+
+  Archive&      ar;
+  std::size_t   m=0;
+  unsigned char buf[bulk_buffer_size];
+};
+
+template<typename Archive>
+struct bulk_binary_reader
+{
+  /* reads no more than n bytes from ar */
+
+  bulk_binary_reader(Archive& ar_,boost::uint64_t n):ar{ar_},remaining{n}{}
+  bulk_binary_reader(const bulk_binary_reader&)=delete;
+  bulk_binary_reader& operator=(const bulk_binary_reader&)=delete;
+
+  void read(void* p,std::size_t n)
+  {
+    auto pc=static_cast<unsigned char*>(p);
+    while(n){
+      if(pos==m)refill();
+      auto k=n<m-pos?n:m-pos;
+      std::memcpy(pc,buf+pos,k);
+      pos+=k;
+      pc+=k;
+      n-=k;
+    }
+  }
+
+  void refill()
+  {
+    if(!remaining)throw_exception(bad_archive_exception());
+    m=remaining<bulk_buffer_size?
+      static_cast<std::size_t>(remaining):bulk_buffer_size;
+    ar.load_binary(buf,m);
+    remaining-=m;
+    pos=0;
+  }
+
+  Archive&        ar;
+  boost::uint64_t remaining;
+  std::size_t     pos=0,m=0;
+  unsigned char   buf[bulk_buffer_size];
+};
+
+/* Mixing policies: no_mix is the identity function, and mulx_mix
+ * uses the mulx function from <boost/unordered/detail/mulx.hpp>.
+ *
+ * foa::table_core mixes hash results with mulx_mix unless the hash is marked
+ * as avalanching, i.e. of good quality
+ * (see <boost/unordered/hash_traits.hpp>).
+ */
+
+struct no_mix
+{
+  template<typename Hash,typename T>
+  static inline std::size_t mix(const Hash& h,const T& x)
+  {
+    return h(x);
+  }
+
+  static inline std::size_t mix(std::size_t hash)
+  {
+    return hash;
+  }
+};
+
+struct mulx_mix
+{
+  template<typename Hash,typename T>
+  static inline std::size_t mix(const Hash& h,const T& x)
+  {
+    return mulx(h(x));
+  }
+
+  static inline std::size_t mix(std::size_t hash)
+  {
+    return mulx(hash);
+  }
+};
+
+/* Hash values stored alongside elements (see stored_hash_type in
+ * <boost/unordered/hash_traits.hpp>) are either the full hash or its lower
+ * 32 bits. In the latter case, when std::size_t is wider than 32 bits, the
+ * hash actually used by the table is rebuilt from its lower 32 bits s as
+ * (s*C mod 2^32)*2^32+s, C being the 32-bit golden ratio constant, so that
+ * it can be recovered from the stored value: canonical(x) gives the table's
+ * hash for a (mixed) hash result or a stored value x, and is idempotent.
+ */
+
+template<typename StoredHash>
+struct stored_hash_policy
+{
+  static inline std::size_t canonical(std::size_t x){return x;}
+};
+
+template<>
+struct stored_hash_policy<boost::uint32_t>
+{
+  static inline std::size_t canonical(std::size_t x)
+  {
+    return canonical(
+      x,std::integral_constant<
+        bool,(sizeof(std::size_t)>sizeof(boost::uint32_t))>{});
+  }
+
+  static inline std::size_t canonical(std::size_t x,std::true_type)
+  {
+    auto s=static_cast<boost::uint32_t>(x);
+    return
+      (static_cast<std::size_t>(
+        static_cast<boost::uint32_t>(s*0x9E3779B9u))<<16<<16)|s;
+  }
+
+  static inline std::size_t canonical(std::size_t x,std::false_type)
+  {
+    return x;
+  }
+};
+
+/* boost::core::countr_zero has a potentially costly check for
+ * the case x==0.
+ */
+
+inline unsigned int unchecked_countr_zero(int x)
+{
+#if defined(BOOST_MSVC)
+  unsigned long r;
+  _BitScanForward(&r,(unsigned long)x);
+  return (unsigned int)r;
+#else
+  BOOST_UNORDERED_ASSUME(x!=0);
+  return (unsigned int)boost::core::countr_zero((unsigned int)x);
+#endif
+}
+
+inline unsigned int unchecked_countr_zero(boost::uint64_t x)
+{
+#if defined(BOOST_MSVC)&&defined(_M_X64)
+  unsigned long r;
+  _BitScanForward64(&r,(unsigned __int64)x);
+  return (unsigned int)r;
+#else
+  BOOST_UNORDERED_ASSUME(x!=0);
+  return (unsigned int)boost::core::countr_zero(x);
+#endif
+}
+
+/* table_arrays controls allocation, initialization and deallocation of
+ * paired arrays of groups and element slots. Only one chunk of memory is
+ * allocated to place both arrays: this is not done for efficiency reasons,
+ * but in order to be able to properly align the group array without storing
+ * additional offset information --the alignment required (16B) is usually
+ * greater than alignof(std::max_align_t) and thus not guaranteed by
+ * allocators.
+ */
+
+template<typename Group,std::size_t Size>
+Group* dummy_groups()
+{
+  /* Dummy storage initialized as if in an empty container (actually, each
+   * of its groups is initialized like a separate empty container).
+   * We make table_arrays::groups point to this when capacity()==0, so that
+   * we are not allocating any dynamic memory and yet lookup can be implemented
+   * without checking for groups==nullptr. This space won't ever be used for
+   * insertion as the container's capacity is precisely zero.
+   */
+
+  static constexpr typename Group::dummy_group_type
+  storage[Size]={typename Group::dummy_group_type(),};
+
+  return reinterpret_cast<Group*>(
+    const_cast<typename Group::dummy_group_type*>(storage));
+}
+
+/* Reads and writes back one byte every 4KB of [p,p+size) so that the OS
+ * backs the whole block with physical memory. Contents are not modified.
+ */
+
+inline void prefault_memory(void* p,std::size_t size)noexcept
+{
+  static constexpr std::size_t page_size=4096;
+
+  auto pc=static_cast<volatile unsigned char*>(p);
+  for(std::size_t i=0;i<size;i+=page_size)pc[i]=pc[i];
+  if(size)pc[size-1]=pc[size-1];
+}
+
+template<
+  typename Ptr,typename Ptr2,
+  typename std::enable_if<!std::is_same<Ptr,Ptr2>::value>::type* = nullptr
+>
+Ptr to_pointer(Ptr2 p)
+{
+  if(!p){return nullptr;}
+  return boost::pointer_traits<Ptr>::pointer_to(*p);
+}
 
 template<typename Ptr>
 Ptr to_pointer(Ptr p)
@@ -990,6 +1711,8 @@ struct arrays_holder
     }
   }
 
+  const Arrays& get()const noexcept{return arrays_;}
+
   const Arrays& release()
   {
     released_=true;
@@ -1002,7 +1725,27 @@ private:
   bool      released_=false;
 };
 
-template<typename Value,typename Group,typename SizePolicy,typename Allocator>
+/* Past the groups array, table_arrays reserves room for a pointer to an
+ * arrays_link, null save for the old arrays of a foa::table being
+ * incrementally rehashed, where it points to a link to the new arrays (held
+ * by the table) so that table_iterator can traverse both.
+ */
+
+template<typename Group,typename Value>
+struct arrays_link
+{
+  Group* groups;
+  Value* elements;
+};
+
+/* When StoredHash is not void, table_arrays keeps an array of StoredHash
+ * values, one per element slot, in between the elements and the groups.
+ */
+
+template<
+  typename Value,typename Group,typename SizePolicy,typename Allocator,
+  typename StoredHash=void
+>
 struct table_arrays
 {
   using allocator_type=typename boost::allocator_rebind<Allocator,Value>::type;
@@ -1011,12 +1754,17 @@ struct table_arrays
   using group_type=Group;
   static constexpr auto N=group_type::N;
   using size_policy=SizePolicy;
+  using stored_hash_type=StoredHash;
+  static constexpr bool stores_hash=!std::is_void<stored_hash_type>::value;
+  using hash_slot_type=typename std::conditional<
+    stores_hash,stored_hash_type,unsigned char>::type;
   using value_type_pointer=
     typename boost::allocator_pointer<allocator_type>::type;
   using group_type_pointer=
     typename boost::pointer_traits<value_type_pointer>::template
       rebind<group_type>;
   using group_type_pointer_traits=boost::pointer_traits<group_type_pointer>;
+  using link_type=arrays_link<group_type,value_type>;
 
   // For natvis purposes
   using char_pointer=
@@ -1031,6 +1779,29 @@ struct table_arrays
   value_type* elements()const noexcept{return boost::to_address(elements_);}
   group_type* groups()const noexcept{return boost::to_address(groups_);}
 
+  hash_slot_type* hashes()const noexcept
+  {
+    return hashes_for(elements(),groups_size_mask+1);
+  }
+
+  void store_hash(std::size_t n,std::size_t hash)const noexcept
+  {
+    store_hash(n,hash,std::integral_constant<bool,stores_hash>{});
+  }
+
+  void store_hash(std::size_t n,std::size_t hash,std::true_type)const noexcept
+  {
+    hashes()[n]=static_cast<hash_slot_type>(hash);
+  }
+
+  void store_hash(std::size_t,std::size_t,std::false_type)const noexcept{}
+
+  const link_type*& link()const noexcept
+  {
+    BOOST_ASSERT(elements());
+    return *reinterpret_cast<const link_type**>(groups()+groups_size_mask+1);
+  }
+
   static void set_arrays(table_arrays& arrays,allocator_type al,std::size_t n)
   {
     return set_arrays(
@@ -1052,7 +1823,10 @@ struct table_arrays
       * depends on such alignment for its increment operation.
       */
 
-    auto p=reinterpret_cast<unsigned char*>(arrays.elements()+groups_size*N-1);
+    auto p=stores_hash?
+      reinterpret_cast<unsigned char*>(
+        hashes_for(arrays.elements(),groups_size)+groups_size*N-1):
+      reinterpret_cast<unsigned char*>(arrays.elements()+groups_size*N-1);
     p+=(uintptr_t(sizeof(group_type))-
         reinterpret_cast<uintptr_t>(p))%sizeof(group_type);
     arrays.groups_=
@@ -1062,6 +1836,7 @@ struct table_arrays
       arrays.groups(),groups_size,
       is_trivially_default_constructible<group_type>{});
     arrays.groups()[groups_size-1].set_sentinel();
+    arrays.link()=nullptr;
   }
 
   static void set_arrays(
@@ -1097,15 +1872,39 @@ struct table_arrays
     }
   }
 
-  /* combined space for elements and groups measured in sizeof(value_type)s */
+  void prefault()const noexcept
+  {
+    if(elements()){
+      prefault_memory(
+        elements(),buffer_size(groups_size_mask+1)*sizeof(value_type));
+    }
+  }
+
+  static hash_slot_type* hashes_for(value_type* pe,std::size_t groups_size)
+  {
+    auto p=reinterpret_cast<unsigned char*>(pe+groups_size*N-1);
+    p+=(uintptr_t(alignof(hash_slot_type))-
+        reinterpret_cast<uintptr_t>(p))%alignof(hash_slot_type);
+    return reinterpret_cast<hash_slot_type*>(p);
+  }
+
+  /* combined space for elements, stored hashes and groups measured in
+   * sizeof(value_type)s
+   */
 
   static std::size_t buffer_size(std::size_t groups_size)
   {
     auto buffer_bytes=
       /* space for elements (we subtract 1 because of the sentinel) */
       sizeof(value_type)*(groups_size*N-1)+
+      /* space for stored hashes + padding for their alignment */
+      (stores_hash?
+        sizeof(hash_slot_type)*(groups_size*N-1)+alignof(hash_slot_type)-1:
+        0)+
       /* space for groups + padding for group alignment */
-      sizeof(group_type)*(groups_size+1)-1;
+      sizeof(group_type)*(groups_size+1)-1+
+      /* space for the link to other arrays */
+      sizeof(const link_type*);
 
     /* ceil(buffer_bytes/sizeof(value_type)) */
     return (buffer_bytes+sizeof(value_type)-1)/sizeof(value_type);
@@ -1210,6 +2009,17 @@ void swap_if(T& x,T& y){using std::swap; swap(x,y);}
 template<bool B,typename T,typename std::enable_if<!B>::type* =nullptr>
 void swap_if(T&,T&){}
 
+template<typename Iterator,typename=void>
+struct is_forward_iterator:std::false_type{};
+
+template<typename Iterator>
+struct is_forward_iterator<
+  Iterator,
+  void_t<typename std::iterator_traits<Iterator>::iterator_category>
+>:std::is_base_of<
+  std::forward_iterator_tag,
+  typename std::iterator_traits<Iterator>::iterator_category>{};
+
 template<typename Allocator>
 struct is_std_allocator:std::false_type{};
 
@@ -1251,11 +2061,13 @@ _STL_RESTORE_DEPRECATED_WARNING
 #pragma warning(pop)
 #endif
 
-/* We expose the hard-coded max load factor so that tests can use it without
+/* We expose the default max load factor so that tests can use it without
  * needing to pull it from an instantiated class template such as the table
- * class.
+ * class. Users can change it per container within [min_mlf,max_mlf].
  */
 static constexpr float mlf=0.875f;
+static constexpr float min_mlf=0.001f;
+static constexpr float max_mlf=1.0f;
 
 template<typename Group,typename Element>
 struct table_locator
@@ -1423,16 +2235,24 @@ public:
   using type_policy=TypePolicy;
   using group_type=Group;
   static constexpr auto N=group_type::N;
-  using size_policy=pow2_size_policy;
-  using prober=pow2_quadratic_prober;
+  using size_policy=default_size_policy;
+  using prober=default_prober;
   using mix_policy=typename std::conditional<
     hash_is_avalanching<Hash>::value,
     no_mix,
     mulx_mix
   >::type;
+  using stored_hash_type=typename boost::unordered::stored_hash_type<
+    Hash>::type;
+  BOOST_UNORDERED_STATIC_ASSERT(
+    std::is_void<stored_hash_type>::value||
+    std::is_same<stored_hash_type,std::size_t>::value||
+    std::is_same<stored_hash_type,boost::uint32_t>::value);
+  using stored_hash_policy_type=stored_hash_policy<stored_hash_type>;
   using alloc_traits=boost::allocator_traits<Allocator>;
   using element_type=typename type_policy::element_type;
-  using arrays_type=Arrays<element_type,group_type,size_policy,Allocator>;
+  using arrays_type=Arrays<
+    element_type,group_type,size_policy,Allocator,stored_hash_type>;
   using size_ctrl_type=SizeControl;
   static constexpr auto uses_fancy_pointers=!std::is_same<
     typename alloc_traits::pointer,
@@ -1454,6 +2274,14 @@ public:
   using locator=table_locator<group_type,element_type>;
   using arrays_holder_type=arrays_holder<arrays_type,Allocator>;
 
+  /* elements can be saved and loaded as raw bytes by save_bulk/load_bulk */
+  static constexpr bool bulk_serializable=
+    std::is_same<element_type,value_type>::value&&
+    is_trivially_copy_constructible<element_type>::value&&
+    std::is_trivially_destructible<element_type>::value&&(
+      is_std_allocator<Allocator>::value||
+      !alloc_has_construct<Allocator,value_type*,const value_type&>::value);
+
 #if defined(BOOST_UNORDERED_ENABLE_STATS)
   using cumulative_stats=table_core_cumulative_stats;
   using stats=table_core_stats;
@@ -1499,31 +2327,85 @@ public:
       std::move(x.h()),std::move(x.pred()),std::move(x.al()),
       arrays_fn,x.size_ctrl)
   {
+    mlf_=x.mlf_;
     x.arrays=ah.release();
     x.size_ctrl.ml=x.initial_max_load();
     x.size_ctrl.size=0;
     BOOST_UNORDERED_SWAP_STATS(cstats,x.cstats);
   }
 
-  table_core(table_core&& x)
-    noexcept(
-      std::is_nothrow_move_constructible<Hash>::value&&
-      std::is_nothrow_move_constructible<Pred>::value&&
-      std::is_nothrow_move_constructible<Allocator>::value&&
-      !uses_fancy_pointers):
+  table_core(table_core&& x)
+    noexcept(
+      std::is_nothrow_move_constructible<Hash>::value&&
+      std::is_nothrow_move_constructible<Pred>::value&&
+      std::is_nothrow_move_constructible<Allocator>::value&&
+      !uses_fancy_pointers):
+    table_core{
+      std::move(x),x.make_empty_arrays(),[&x]{return x.arrays;}}
+  {}
+
+  table_core(const table_core& x,const Allocator& al_):
+    table_core{
+      std::size_t(std::ceil(float(x.size())/x.mlf_)),x.h(),x.pred(),al_}
+  {
+    mlf_=x.mlf_;
+    size_ctrl.ml=initial_max_load();
+    copy_elements_from(x);
+  }
+
+  /* copies x along with the elements of x_old_arrays_, which x's derived
+   * class may hold aside of x.arrays (and are accounted for in x.size())
+   */
+
+  table_core(
+    const table_core& x,const arrays_type& x_old_arrays_,const Allocator& al_):
+    table_core{
+      std::size_t(std::ceil(float(x.size())/x.mlf_)),x.h(),x.pred(),al_}
+  {
+    mlf_=x.mlf_;
+    size_ctrl.ml=initial_max_load();
+    copy_elements_from(x,x_old_arrays_);
+  }
+
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+  template<
+    typename ExecutionPolicy,
+    typename std::enable_if<
+      is_execution_policy<ExecutionPolicy>::value>::type* =nullptr
+  >
+  table_core(ExecutionPolicy&& policy,const table_core& x):
     table_core{
-      std::move(x),x.make_empty_arrays(),[&x]{return x.arrays;}}
-  {}
+      std::size_t(std::ceil(float(x.size())/x.mlf_)),x.h(),x.pred(),
+      alloc_traits::select_on_container_copy_construction(x.al())}
+  {
+    mlf_=x.mlf_;
+    size_ctrl.ml=initial_max_load();
+    copy_elements_from(std::forward<ExecutionPolicy>(policy),x);
+  }
 
-  table_core(const table_core& x,const Allocator& al_):
-    table_core{std::size_t(std::ceil(float(x.size())/mlf)),x.h(),x.pred(),al_}
+  template<
+    typename ExecutionPolicy,
+    typename std::enable_if<
+      is_execution_policy<ExecutionPolicy>::value>::type* =nullptr
+  >
+  table_core(
+    ExecutionPolicy&& policy,const table_core& x,
+    const arrays_type& x_old_arrays_):
+    table_core{
+      std::size_t(std::ceil(float(x.size())/x.mlf_)),x.h(),x.pred(),
+      alloc_traits::select_on_container_copy_construction(x.al())}
   {
-    copy_elements_from(x);
+    mlf_=x.mlf_;
+    size_ctrl.ml=initial_max_load();
+    copy_elements_from(
+      std::forward<ExecutionPolicy>(policy),x,x_old_arrays_);
   }
+#endif
 
   table_core(table_core&& x,const Allocator& al_):
     table_core{std::move(x.h()),std::move(x.pred()),al_}
   {
+    mlf_=x.mlf_;
     if(al()==x.al()){
       using std::swap;
       swap(arrays,x.arrays);
@@ -1539,8 +2421,10 @@ public:
       /* This works because subsequent x.clear() does not depend on the
        * elements' values.
        */
-      x.for_all_elements([this](element_type* p){
-        unchecked_insert(type_policy::move(type_policy::value_from(*p)));
+      x.for_all_elements([&x,this](element_type* p){
+        unchecked_insert(
+          hash_for_element(x.arrays,p),
+          type_policy::move(type_policy::value_from(*p)));
       });
     }
   }
@@ -1562,7 +2446,7 @@ public:
       return capacity_; /* we allow 100% usage */
     }
     else{
-      return (std::size_t)(mlf*(float)(capacity_));
+      return (std::size_t)(mlf_*(float)(capacity_));
     }
   }
 
@@ -1575,41 +2459,51 @@ public:
   {
     BOOST_UNORDERED_STATIC_ASSERT_HASH_PRED(Hash, Pred)
 
-    static constexpr auto pocca=
-      alloc_traits::propagate_on_container_copy_assignment::value;
+    if(this!=std::addressof(x)){
+      prepare_copy_assign(x);
+      copy_elements_from(x);
+    }
+    return *this;
+  }
+
+  /* copy assignment from x plus the elements of x_old_arrays_ */
+
+  void copy_assign(const table_core& x,const arrays_type& x_old_arrays_)
+  {
+    BOOST_UNORDERED_STATIC_ASSERT_HASH_PRED(Hash, Pred)
 
     if(this!=std::addressof(x)){
-      /* If copy construction here winds up throwing, the container is still
-       * left intact so we perform these operations first.
-       */
-      hasher    tmp_h=x.h();
-      key_equal tmp_p=x.pred();
+      prepare_copy_assign(x);
+      copy_elements_from(x,x_old_arrays_);
+    }
+  }
 
-      clear();
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+  template<typename ExecutionPolicy>
+  void assign(ExecutionPolicy&& policy,const table_core& x)
+  {
+    BOOST_UNORDERED_STATIC_ASSERT_HASH_PRED(Hash, Pred)
 
-      /* Because we've asserted at compile-time that Hash and Pred are nothrow
-       * swappable, we can safely mutate our source container and maintain
-       * consistency between the Hash, Pred compatibility.
-       */
-      using std::swap;
-      swap(h(),tmp_h);
-      swap(pred(),tmp_p);
-
-      if_constexpr<pocca>([&,this]{
-        if(al()!=x.al()){
-          auto ah=x.make_arrays(std::size_t(std::ceil(float(x.size())/mlf)));
-          delete_arrays(arrays);
-          arrays=ah.release();
-          size_ctrl.ml=initial_max_load();
-        }
-        copy_assign_if<pocca>(al(),x.al());
-      });
-      /* noshrink: favor memory reuse over tightness */
-      noshrink_reserve(x.size());
-      copy_elements_from(x);
+    if(this!=std::addressof(x)){
+      prepare_copy_assign(x);
+      copy_elements_from(std::forward<ExecutionPolicy>(policy),x);
+    }
+  }
+
+  template<typename ExecutionPolicy>
+  void assign(
+    ExecutionPolicy&& policy,const table_core& x,
+    const arrays_type& x_old_arrays_)
+  {
+    BOOST_UNORDERED_STATIC_ASSERT_HASH_PRED(Hash, Pred)
+
+    if(this!=std::addressof(x)){
+      prepare_copy_assign(x);
+      copy_elements_from(
+        std::forward<ExecutionPolicy>(policy),x,x_old_arrays_);
     }
-    return *this;
   }
+#endif
 
 #if defined(BOOST_MSVC)
 #pragma warning(push)
@@ -1639,6 +2533,7 @@ public:
 
       using std::swap;
 
+      mlf_=x.mlf_;
       clear();
 
       if(pocma||al()==x.al()){
@@ -1669,8 +2564,10 @@ public:
         /* This works because subsequent x.clear() does not depend on the
          * elements' values.
          */
-        x.for_all_elements([this](element_type* p){
-          unchecked_insert(type_policy::move(type_policy::value_from(*p)));
+        x.for_all_elements([&x,this](element_type* p){
+          unchecked_insert(
+            hash_for_element(x.arrays,p),
+            type_policy::move(type_policy::value_from(*p)));
         });
       }
     }
@@ -1717,15 +2614,23 @@ public:
   template<typename Key>
   BOOST_FORCEINLINE locator find(
     const Key& x,std::size_t pos0,std::size_t hash)const
+  {    
+    return find(arrays,x,pos0,hash);
+  }
+
+  template<typename Key>
+  BOOST_FORCEINLINE locator find(
+    const arrays_type& arrays_,
+    const Key& x,std::size_t pos0,std::size_t hash)const
   {    
     BOOST_UNORDERED_STATS_COUNTER(num_cmps);
     prober pb(pos0);
     do{
       auto pos=pb.get();
-      auto pg=arrays.groups()+pos;
+      auto pg=arrays_.groups()+pos;
       auto mask=pg->match(hash);
       if(mask){
-        auto elements=arrays.elements();
+        auto elements=arrays_.elements();
         BOOST_UNORDERED_ASSUME(elements!=nullptr);
         auto p=elements+pos*N;
         BOOST_UNORDERED_PREFETCH_ELEMENTS(p,N);
@@ -1746,12 +2651,92 @@ public:
         return {};
       }
     }
-    while(BOOST_LIKELY(pb.next(arrays.groups_size_mask)));
+    while(BOOST_LIKELY(pb.next(arrays_.groups_size_mask)));
     BOOST_UNORDERED_ADD_STATS(
       cstats.unsuccessful_lookup,(pb.length(),num_cmps));
     return {};
   }
 
+  /* Pipelined lookup of m<2*bulk_lookup_size keys starting at first: hash
+   * values of all keys are calculated and their groups prefetched, then
+   * initial groups are matched and the first matching elements prefetched,
+   * and only then are keys compared, so that the cache misses incurred by
+   * different keys overlap. f(loc) is invoked for each key in sequence, loc
+   * being empty if the key is not present.
+   */
+
+  static constexpr std::size_t bulk_lookup_size=16;
+
+  template<typename FwdIterator,typename F>
+  BOOST_FORCEINLINE void bulk_find(FwdIterator first,std::size_t m,F&& f)const
+  {
+    BOOST_ASSERT(m<2*bulk_lookup_size);
+
+    using mask_type=typename group_type::mask_type;
+
+    std::size_t hashes[2*bulk_lookup_size-1],
+                positions[2*bulk_lookup_size-1];
+    mask_type   masks[2*bulk_lookup_size-1];
+    auto        it=first;
+
+    for(std::size_t i=0;i<m;++i,++it){
+      auto hash=hashes[i]=hash_for(*it);
+      auto pos=positions[i]=position_for(hash);
+      BOOST_UNORDERED_PREFETCH(arrays.groups()+pos);
+    }
+
+    for(std::size_t i=0;i<m;++i){
+      auto pos=positions[i];
+      auto mask=masks[i]=(arrays.groups()+pos)->match(hashes[i]);
+      if(mask){
+        BOOST_UNORDERED_PREFETCH(
+          arrays.elements()+pos*N+unchecked_countr_zero(mask));
+      }
+    }
+
+    it=first;
+    for(std::size_t i=0;i<m;++i,++it){
+      BOOST_UNORDERED_STATS_COUNTER(num_cmps);
+      auto    pos=positions[i];
+      prober  pb(pos);
+      auto    pg=arrays.groups()+pos;
+      auto    mask=masks[i];
+      locator loc;
+      for(;;){
+        if(mask){
+          auto elements=arrays.elements();
+          BOOST_UNORDERED_ASSUME(elements!=nullptr);
+          auto p=elements+pos*N;
+          do{
+            BOOST_UNORDERED_INCREMENT_STATS_COUNTER(num_cmps);
+            auto n=unchecked_countr_zero(mask);
+            if(BOOST_LIKELY(bool(pred()(*it,key_from(p[n]))))){
+              BOOST_UNORDERED_ADD_STATS(
+                cstats.successful_lookup,(pb.length(),num_cmps));
+              loc={pg,n,p+n};
+              goto next_key;
+            }
+            mask&=mask-1;
+          }while(mask);
+        }
+        if(BOOST_LIKELY(pg->is_not_overflowed(hashes[i]))||
+           BOOST_UNLIKELY(!pb.next(arrays.groups_size_mask))){
+          BOOST_UNORDERED_ADD_STATS(
+            cstats.unsuccessful_lookup,(pb.length(),num_cmps));
+          goto next_key;
+        }
+        pos=pb.get();
+        pg=arrays.groups()+pos;
+        mask=pg->match(hashes[i]);
+        if(mask){
+          BOOST_UNORDERED_PREFETCH_ELEMENTS(arrays.elements()+pos*N,N);
+        }
+      }
+    next_key:
+      f(loc);
+    }
+  }
+
 #if defined(BOOST_MSVC)
 #pragma warning(pop) /* C4800 */
 #endif
@@ -1779,6 +2764,7 @@ public:
     swap(pred(),x.pred());
     swap(arrays,x.arrays);
     swap(size_ctrl,x.size_ctrl);
+    swap(mlf_,x.mlf_);
   }
 
   void clear()noexcept
@@ -1802,6 +2788,9 @@ public:
   }
 
   hasher hash_function()const{return h();}
+
+  template<typename Key>
+  prehashed prehash(const Key& x)const{return prehashed{h()(x)};}
   key_equal key_eq()const{return pred();}
 
   std::size_t capacity()const noexcept
@@ -1815,13 +2804,42 @@ public:
     else             return float(size())/float(capacity());
   }
 
-  float max_load_factor()const noexcept{return mlf;}
+  float max_load_factor()const noexcept{return mlf_;}
+
+  /* z is clamped to [min_mlf,max_mlf]. The maximum load is recalculated so
+   * that subsequent insertions grow the table according to the new value;
+   * if it falls below the current size, the table is rehashed right away to
+   * the capacity the new value requires.
+   */
+
+  void max_load_factor(float z)
+  {
+    if(!(z>=min_mlf))z=min_mlf; /* also for NaN */
+    else if(z>max_mlf)z=max_mlf;
+
+    /* keep the reduction of the maximum load due to erasures (see
+     * recover_slot)
+     */
+    std::size_t ml0=initial_max_load(),
+                ml=size_ctrl.ml,
+                drift=ml0>ml?ml0-ml:0;
+    mlf_=z;
+    ml0=initial_max_load();
+    size_ctrl.ml=ml0>drift?ml0-drift:0;
+
+    /* the maximum load can't be left below the size (erasures would make
+     * it wrap around)
+     */
+    if(size_ctrl.ml<size()){
+      unchecked_rehash(std::size_t(std::ceil(float(size())/mlf_)));
+    }
+  }
 
   std::size_t max_load()const noexcept{return size_ctrl.ml;}
 
   void rehash(std::size_t n)
   {
-    auto m=size_t(std::ceil(float(size())/mlf));
+    auto m=size_t(std::ceil(float(size())/mlf_));
     if(m>n)n=m;
     if(n)n=capacity_for(n); /* exact resulting capacity */
 
@@ -1830,7 +2848,307 @@ public:
 
   void reserve(std::size_t n)
   {
-    rehash(std::size_t(std::ceil(float(n)/mlf)));
+    rehash(std::size_t(std::ceil(float(n)/mlf_)));
+  }
+
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+  template<typename ExecutionPolicy>
+  void rehash(ExecutionPolicy&& policy,std::size_t n)
+  {
+    auto m=size_t(std::ceil(float(size())/mlf_));
+    if(m>n)n=m;
+    if(n)n=capacity_for(n); /* exact resulting capacity */
+
+    if(n!=capacity()){
+      unchecked_rehash(std::forward<ExecutionPolicy>(policy),n);
+    }
+  }
+
+  template<typename ExecutionPolicy>
+  void reserve(ExecutionPolicy&& policy,std::size_t n)
+  {
+    rehash(
+      std::forward<ExecutionPolicy>(policy),
+      std::size_t(std::ceil(float(n)/mlf_)));
+  }
+
+  /* Inserts the n elements of the range starting at first in parallel.
+   * The table is grown beforehand (in parallel) to accommodate all of them,
+   * the range is split into chunks processed by the threads of the execution
+   * policy, and each element is looked up and, if not present, emplaced
+   * group by group along its probe sequence under the lock of the group
+   * being visited. As all insertions of equivalent elements follow the same
+   * probe sequence and slots are never freed in the process, the first
+   * group with an available slot is always visited under lock by every one
+   * of them, so no duplicates can be inserted. Which element among a set of
+   * equivalent ones in the range gets inserted is unspecified. If an
+   * exception is thrown, the elements inserted up to that point remain in
+   * the table.
+   */
+
+  template<typename ExecutionPolicy,typename FwdIterator>
+  void parallel_insert(
+    ExecutionPolicy&& policy,FwdIterator first,std::size_t n)
+  {
+    static constexpr std::size_t chunk_size=1024;
+
+    if(!n)return;
+    if(size()+n>size_ctrl.ml){
+      auto c=capacity_for(
+        std::size_t(std::ceil(float(size()+n)/mlf_)));
+      if(c<capacity())c=capacity(); /* restore ml, do not shrink */
+      unchecked_rehash(policy,c);
+    }
+
+    std::vector<FwdIterator> chunks;
+    chunks.reserve((n+chunk_size-1)/chunk_size);
+    for(std::size_t i=0;i<n;i+=chunk_size){
+      chunks.push_back(first);
+      if(n-i>chunk_size){
+        std::advance(
+          first,
+          static_cast<
+            typename std::iterator_traits<FwdIterator>::difference_type>(
+              chunk_size));
+      }
+    }
+
+    group_locks              locks{al(),arrays.groups_size_mask+1};
+    std::atomic<std::size_t> num_inserted{0};
+    std::atomic<bool>        failed{false};
+    std::exception_ptr       ep;
+    BOOST_TRY{
+      std::for_each(policy,chunks.begin(),chunks.end(),
+        [&,this](const FwdIterator& chunk_first){
+          if(failed.load(std::memory_order_relaxed))return;
+          auto        i=static_cast<std::size_t>(&chunk_first-chunks.data());
+          auto        m=(std::min)(chunk_size,n-i*chunk_size);
+          auto        it=chunk_first;
+          std::size_t s=0;
+          BOOST_TRY{
+            /* hash and prefetch in batches, as in bulk lookup */
+
+            std::size_t hashes[bulk_lookup_size];
+            while(m){
+              auto k=(std::min)(m,bulk_lookup_size);
+              auto it2=it;
+              for(std::size_t j=0;j<k;++j,++it2){
+                auto hash=hashes[j]=hash_for(key_from(*it2));
+                auto pos=position_for(hash);
+                BOOST_UNORDERED_PREFETCH(arrays.groups()+pos);
+                BOOST_UNORDERED_PREFETCH(locks.data()+pos);
+                BOOST_UNORDERED_PREFETCH(arrays.elements()+pos*N);
+              }
+              for(std::size_t j=0;j<k;++j,++it){
+                s+=parallel_emplace(locks.data(),hashes[j],*it);
+              }
+              m-=k;
+            }
+          }
+          BOOST_CATCH(...){
+            if(!failed.exchange(true))ep=std::current_exception();
+          }
+          BOOST_CATCH_END
+          num_inserted+=s;
+        }
+      );
+    }
+    BOOST_CATCH(...){ /* parallel algorithm failed to acquire resources */
+      if(!failed.exchange(true))ep=std::current_exception();
+    }
+    BOOST_CATCH_END
+
+    size_ctrl.size+=num_inserted.load();
+    if(failed.load())std::rethrow_exception(ep);
+  }
+#endif
+
+  /* Overflow bits are never cleared on erasure, and the maximum load is
+   * lowered instead to keep probe lengths in check (see recover_slot).
+   * compact rebuilds the overflow bits from scratch by walking the probe
+   * sequence of each element up to its actual position, moving the element
+   * to the first group with room along the way, if any (only when this can't
+   * throw), and restores the maximum load. No memory is allocated. If the
+   * hash function throws, all overflow bits are set (so lookups are still
+   * correct) and the maximum load is set to the current size.
+   */
+
+  void compact()
+  {
+    if(!arrays.elements())return;
+
+    auto pg0=arrays.groups(),last=pg0+arrays.groups_size_mask+1;
+    for(auto pg=pg0;pg!=last;++pg)pg->reset_overflow();
+    BOOST_TRY{
+      for_all_elements([&,this](group_type* pg,unsigned int n,element_type* p){
+        compact_element(pg,n,p,std::integral_constant<
+          bool,
+          std::is_nothrow_move_constructible<init_type>::value||
+          !std::is_same<element_type,value_type>::value>{});
+      });
+    }
+    BOOST_CATCH(...){
+      for(auto pg=pg0;pg!=last;++pg){
+        for(std::size_t i=0;i<8;++i)pg->mark_overflow(i);
+      }
+      size_ctrl.ml=size();
+      BOOST_RETHROW
+    }
+    BOOST_CATCH_END
+    size_ctrl.ml=initial_max_load();
+  }
+
+  void prefault()noexcept
+  {
+    arrays.prefault();
+  }
+
+  /* Bulk binary serialization (see bulk_serialization.hpp): a
+   * bulk_serialization_header is followed by the group array verbatim and by
+   * the elements (and stored hashes, if any) of occupied slots in slot
+   * order. If the layout and hash function of the archived table match
+   * ours, loading restores the group array as is and puts the elements back
+   * in their slots without rehashing; otherwise, they are reinserted one by
+   * one. f(pg,n,p) is invoked for every element saved or loaded, in the same
+   * order on both ends.
+   */
+
+  template<typename Archive,typename F>
+  void save_bulk(Archive& ar,F f)const
+  {
+    bulk_serialization_header hd;
+    std::memset(&hd,0,sizeof(hd));
+    hd.layout=arrays_layout;
+    hd.size_t_size=sizeof(std::size_t);
+    hd.group_size=sizeof(group_type);
+    hd.element_size=sizeof(element_type);
+    hd.hash_slot_size=bulk_hash_slot_size;
+    hd.size=size();
+    if(arrays.elements()){
+      hd.num_groups=arrays.groups_size_mask+1;
+      hd.ml=std::size_t(size_ctrl.ml);
+      hd.hash_digest=bulk_hash_digest(arrays);
+    }
+    ar.save_binary(&hd,sizeof(hd));
+    if(!hd.num_groups)return;
+
+    ar.save_binary(
+      arrays.groups(),(arrays.groups_size_mask+1)*sizeof(group_type));
+    bulk_binary_writer<Archive> w{ar};
+    for_all_element_runs(arrays,[&](element_type* p,std::size_t k){
+      w.write(p,k*sizeof(element_type));
+    });
+    save_bulk_hashes(
+      w,std::integral_constant<bool,arrays_type::stores_hash>{});
+    w.flush();
+    for_all_elements(f);
+  }
+
+  template<typename Archive,typename F>
+  void load_bulk(Archive& ar,F f)
+  {
+    BOOST_ASSERT(empty());
+
+    bulk_serialization_header hd;
+    ar.load_binary(&hd,sizeof(hd));
+    if(hd.size_t_size!=sizeof(std::size_t)||
+       hd.element_size!=sizeof(element_type)||
+       (!hd.num_groups&&hd.size)){
+      throw_exception(bad_archive_exception());
+    }
+    if(!hd.num_groups)return;
+
+    if(hd.layout!=arrays_layout||
+       hd.group_size!=sizeof(group_type)||
+       hd.hash_slot_size!=bulk_hash_slot_size){
+      /* saved with a different configuration, group array can't be reused.
+       * The saved slot count per group is not known, but each slot takes at
+       * least one byte of its group, which bounds the number of elements
+       * before anything gets allocated for them.
+       */
+      auto max_size=(std::numeric_limits<std::size_t>::max)();
+      if(!hd.group_size||
+         hd.num_groups>max_size/hd.group_size||
+         hd.size>hd.num_groups*hd.group_size||
+         hd.size>max_size/sizeof(element_type)||
+         (hd.hash_slot_size&&hd.size>max_size/hd.hash_slot_size)){
+        throw_exception(bad_archive_exception());
+      }
+      auto size_=static_cast<std::size_t>(hd.size);
+      skip_bulk_bytes(ar,hd.num_groups*hd.group_size);
+      std::vector<locator> locs;
+      locs.reserve(size_);
+      reserve(size_);
+      bulk_binary_reader<Archive> r{ar,hd.size*sizeof(element_type)};
+      for(std::size_t i=0;i<size_;++i){
+        alignas(element_type) unsigned char buf[sizeof(element_type)];
+        r.read(buf,sizeof(element_type));
+        locs.push_back(
+          bulk_reinsert(*reinterpret_cast<element_type*>(buf)));
+      }
+      skip_bulk_bytes(ar,hd.size*hd.hash_slot_size);
+      for(const auto& loc:locs)f(loc.pg,loc.n,loc.p);
+      return;
+    }
+
+    if(hd.num_groups>(std::numeric_limits<std::size_t>::max)()/N||
+       hd.size>hd.num_groups*N-1){
+      throw_exception(bad_archive_exception());
+    }
+    auto num_groups=static_cast<std::size_t>(hd.num_groups);
+    auto size_=static_cast<std::size_t>(hd.size);
+    if(size_policy::size(
+         size_index_for<group_type,size_policy>(num_groups*N-1))!=
+           num_groups){
+      throw_exception(bad_archive_exception());
+    }
+
+    auto ah=make_arrays(num_groups*N-1);
+    auto& new_arrays_=ah.get();
+    BOOST_ASSERT(new_arrays_.groups_size_mask+1==num_groups);
+
+    /* Group metadata is loaded byte by byte even for atomic groups (cfoa),
+     * which assumes atomic_integral has the same representation as the
+     * underlying integral type (true for lock-free atomics).
+     */
+
+    auto pg=new_arrays_.groups();
+    ar.load_binary(static_cast<void*>(pg),num_groups*sizeof(group_type));
+    std::size_t num_occupied=0;
+    for_all_element_runs(new_arrays_,[&](element_type*,std::size_t k){
+      num_occupied+=k;
+    });
+    if(!pg[num_groups-1].is_sentinel(N-1)||num_occupied!=size_){
+      throw_exception(bad_archive_exception());
+    }
+    bulk_binary_reader<Archive> r{
+      ar,hd.size*(sizeof(element_type)+bulk_hash_slot_size)};
+    for_all_element_runs(new_arrays_,[&](element_type* p,std::size_t k){
+      r.read(static_cast<void*>(p),k*sizeof(element_type));
+    });
+    load_bulk_hashes(
+      r,new_arrays_,std::integral_constant<bool,arrays_type::stores_hash>{});
+
+    if(bulk_hash_digest(new_arrays_)==hd.hash_digest){
+      delete_arrays(arrays);
+      arrays=ah.release();
+      size_ctrl.size=size_;
+      std::size_t ml=initial_max_load();
+      if(hd.ml<ml)ml=static_cast<std::size_t>(hd.ml);
+      if(ml<size_)ml=size_;
+      size_ctrl.ml=ml;
+      for_all_elements(f);
+    }
+    else{
+      /* different hash function */
+      std::vector<locator> locs;
+      locs.reserve(size_);
+      reserve(size_);
+      for_all_elements(new_arrays_,[&,this](element_type* p){
+        locs.push_back(bulk_reinsert(*p));
+      });
+      for(const auto& loc:locs)f(loc.pg,loc.n,loc.p);
+    }
   }
 
 #if defined(BOOST_UNORDERED_ENABLE_STATS)
@@ -1939,7 +3257,44 @@ public:
   template<typename Key>
   inline std::size_t hash_for(const Key& x)const
   {
-    return mix_policy::mix(h(),x);
+    return stored_hash_policy_type::canonical(mix_policy::mix(h(),x));
+  }
+
+  /* hash for x given the result of invoking our hash function on it */
+
+  template<typename Key>
+  inline std::size_t hash_for(prehashed ph,const Key& x)const
+  {
+    BOOST_ASSERT_MSG(
+      ph.hash==h()(x),"prehashed value does not match the hash function");
+    (void)x;
+    return stored_hash_policy_type::canonical(mix_policy::mix(ph.hash));
+  }
+
+  /* hash of the element pointed to by p, retrieved from arrays_ if stored
+   * there and computed with our hash function otherwise
+   */
+
+  inline std::size_t hash_for_element(
+    const arrays_type& arrays_,const element_type* p)const
+  {
+    return hash_for_element(
+      arrays_,p,std::integral_constant<bool,arrays_type::stores_hash>{});
+  }
+
+  inline std::size_t hash_for_element(
+    const arrays_type& arrays_,const element_type* p,
+    std::true_type /* stored */)const
+  {
+    return stored_hash_policy_type::canonical(
+      arrays_.hashes()[p-arrays_.elements()]);
+  }
+
+  inline std::size_t hash_for_element(
+    const arrays_type&,const element_type* p,
+    std::false_type /* not stored */)const
+  {
+    return hash_for(key_from(*p));
   }
 
   inline std::size_t position_for(std::size_t hash)const
@@ -1953,10 +3308,13 @@ public:
     return size_policy::position(hash,arrays_.groups_size_index);
   }
 
-  static inline int match_really_occupied(group_type* pg,group_type* last)
+  static inline typename group_type::mask_type match_really_occupied(
+    group_type* pg,group_type* last)
   {
+    using mask_type=typename group_type::mask_type;
+
     /* excluding the sentinel */
-    return pg->match_occupied()&~(int(pg==last-1)<<(N-1));
+    return pg->match_occupied()&~(mask_type(pg==last-1)<<(N-1));
   }
 
   template<typename... Args>
@@ -1971,15 +3329,63 @@ public:
 
   BOOST_NOINLINE void unchecked_rehash_for_growth()
   {
+    if(compact_for_growth(1))return;
     auto new_arrays_=new_arrays_for_growth();
     unchecked_rehash(new_arrays_);
   }
 
+  /* concurrent_table allocates the arrays for its next growth in advance,
+   * outside of its exclusive lock, with new_arrays_for_growth_at_max_load.
+   * The overload below takes ownership of these (possibly empty)
+   * next_arrays_, which are used if they've still got the capacity growth
+   * calls for and deallocated otherwise.
+   */
+
+  arrays_type new_arrays_for_growth_at_max_load()const
+  {
+    return new_arrays(slots_for_growth(1,size_ctrl.ml));
+  }
+
+  bool fits_growth(const arrays_type& arrays_)const
+  {
+    return
+      arrays_.elements()&&
+      (arrays_.groups_size_mask+1)*N-1==capacity_for(slots_for_growth(1));
+  }
+
+  BOOST_NOINLINE void unchecked_rehash_for_growth(
+    const arrays_type& next_arrays_)
+  {
+    arrays_holder<arrays_type,Allocator> ah{next_arrays_,al()};
+    if(compact_for_growth(1))return;
+    auto new_arrays_=
+      fits_growth(next_arrays_)?ah.release():new_arrays_for_growth();
+    unchecked_rehash(new_arrays_);
+  }
+
   template<typename... Args>
-  BOOST_NOINLINE locator
+  BOOST_FORCEINLINE locator
   unchecked_emplace_with_rehash(std::size_t hash,Args&&... args)
   {
-    auto    new_arrays_=new_arrays_for_growth();
+    return unchecked_emplace_with_rehash_n(
+      1,hash,std::forward<Args>(args)...);
+  }
+
+  /* n is the number of elements expected to be inserted (including this
+   * one), used to size the new arrays in bulk insertion.
+   */
+
+  template<typename... Args>
+  BOOST_NOINLINE locator
+  unchecked_emplace_with_rehash_n(
+    std::size_t n,std::size_t hash,Args&&... args)
+  {
+    if(compact_for_growth(n)){
+      return unchecked_emplace_at(
+        position_for(hash),hash,std::forward<Args>(args)...);
+    }
+
+    auto    new_arrays_=new_arrays_for_growth(n);
     locator it;
     BOOST_TRY{
       /* strong exception guarantee -> try insertion before rehash */
@@ -1991,12 +3397,108 @@ public:
       delete_arrays(new_arrays_);
       BOOST_RETHROW
     }
-    BOOST_CATCH_END
+    BOOST_CATCH_END
+
+    /* new_arrays_ lifetime taken care of by unchecked_rehash */
+    unchecked_rehash(new_arrays_);
+    ++size_ctrl.size;
+    return it;
+  }
+
+  /* Incremental rehashing support (see foa::table).
+   * unchecked_emplace_with_incremental_rehash_n works as
+   * unchecked_emplace_with_rehash_n except that, rather than transferring
+   * all the elements to the new arrays, it hands the old arrays over to the
+   * caller, which then moves the elements in batches with
+   * transfer_groups and finally gets rid of the old arrays with
+   * delete_old_arrays.
+   */
+
+  template<typename... Args>
+  BOOST_NOINLINE locator
+  unchecked_emplace_with_incremental_rehash_n(
+    arrays_type& old_arrays_,std::size_t n,std::size_t hash,Args&&... args)
+  {
+    if(compact_for_growth(n)){
+      return unchecked_emplace_at(
+        position_for(hash),hash,std::forward<Args>(args)...);
+    }
+
+    auto    new_arrays_=new_arrays_for_growth(n);
+    locator it;
+    BOOST_TRY{
+      it=nosize_unchecked_emplace_at(
+        new_arrays_,position_for(hash,new_arrays_),
+        hash,std::forward<Args>(args)...);
+    }
+    BOOST_CATCH(...){
+      delete_arrays(new_arrays_);
+      BOOST_RETHROW
+    }
+    BOOST_CATCH_END
+
+    old_arrays_=arrays;
+    arrays=new_arrays_;
+    size_ctrl.ml=initial_max_load();
+    ++size_ctrl.size;
+    return it;
+  }
+
+  /* Same without inserting any element (concurrent_table). Returns false,
+   * leaving old_arrays_ untouched, if compaction made room instead.
+   * next_arrays_ is as in unchecked_rehash_for_growth(const arrays_type&).
+   */
+
+  bool unchecked_incremental_rehash_for_growth(
+    arrays_type& old_arrays_,const arrays_type& next_arrays_)
+  {
+    arrays_holder<arrays_type,Allocator> ah{next_arrays_,al()};
+    if(compact_for_growth(1))return false;
+
+    auto new_arrays_=
+      fits_growth(next_arrays_)?ah.release():new_arrays_for_growth();
+    old_arrays_=arrays;
+    arrays=new_arrays_;
+    size_ctrl.ml=initial_max_load();
+    return true;
+  }
+
+  /* Moves the elements of groups [first,last) of old_arrays_ to arrays.
+   * Emptied groups keep their overflow bits so that lookups into old_arrays_
+   * still reach the elements yet to be transferred. Element transfer is
+   * required not to throw; if the hash function throws, the elements
+   * transferred up to that point stay in arrays and the rest remain in
+   * old_arrays_.
+   */
+
+  void transfer_groups(
+    const arrays_type& old_arrays_,std::size_t first,std::size_t last)
+  {
+    auto pg=old_arrays_.groups()+first,
+         last_group=old_arrays_.groups()+old_arrays_.groups_size_mask+1;
+    auto p=old_arrays_.elements()+first*N;
+    for(;first!=last;++first,++pg,p+=N){
+      auto mask=match_really_occupied(pg,last_group);
+      while(mask){
+        auto        n=unchecked_countr_zero(mask);
+        std::size_t num_destroyed=0;
+        nosize_transfer_element(
+          p+n,hash_for_element(old_arrays_,p+n),arrays,num_destroyed);
+        BOOST_ASSERT(num_destroyed==1);
+        pg->reset(n);
+        mask&=mask-1;
+      }
+    }
+  }
 
-    /* new_arrays_ lifetime taken care of by unchecked_rehash */
-    unchecked_rehash(new_arrays_);
-    ++size_ctrl.size;
-    return it;
+  /* destroys the elements remaining in old_arrays_ and deallocates it */
+
+  void delete_old_arrays(arrays_type& old_arrays_)noexcept
+  {
+    for_all_elements(old_arrays_,[this](element_type* p){
+      destroy_element(p);
+    });
+    delete_arrays(old_arrays_);
   }
 
   void noshrink_reserve(std::size_t n)
@@ -2005,7 +3507,7 @@ public:
     BOOST_ASSERT(empty());
 
     if(n){
-      n=std::size_t(std::ceil(float(n)/mlf)); /* elements -> slots */
+      n=std::size_t(std::ceil(float(n)/mlf_)); /* elements -> slots */
       n=capacity_for(n); /* exact resulting capacity */
 
       if(n>capacity()){
@@ -2072,6 +3574,7 @@ public:
     return true;
   }
 
+  float                    mlf_=mlf; /* before arrays, used in initialization */
   arrays_type              arrays;
   size_ctrl_type           size_ctrl;
 
@@ -2114,7 +3617,7 @@ private:
     return arrays_type::new_(typename arrays_type::allocator_type(al()),n);
   }
 
-  arrays_type new_arrays_for_growth()const
+  arrays_type new_arrays_for_growth(std::size_t n=1)const
   {
     /* Due to the anti-drift mechanism (see recover_slot), the new arrays may
      * be of the same size as the old arrays; in the limit, erasing one
@@ -2126,8 +3629,70 @@ private:
      * probability of an element having caused overflow; P has been measured as
      * ~0.162 under ideal conditions, yielding F ~ 0.0165 ~ 1/61.
      */
-    return new_arrays(std::size_t(
-      std::ceil(static_cast<float>(size()+size()/61+1)/mlf)));
+    return new_arrays(slots_for_growth(n));
+  }
+
+  std::size_t slots_for_growth(std::size_t n)const
+  {
+    return slots_for_growth(n,size());
+  }
+
+  std::size_t slots_for_growth(std::size_t n,std::size_t size_)const
+  {
+    std::size_t m=size_/61+1;
+    return std::size_t(std::ceil(static_cast<float>(size_+(n>m?n:m))/mlf_));
+  }
+
+  /* When growth would yield arrays of the same capacity as the current ones
+   * (because the maximum load has been lowered by erasures), we compact
+   * instead, which has the same effect on probe lengths for unsuccessful
+   * lookups without allocating or moving elements. Returns true if the
+   * table can take n more elements without growing.
+   */
+
+  bool compact_for_growth(std::size_t n)
+  {
+    if(!arrays.elements()||capacity_for(slots_for_growth(n))>capacity()){
+      return false;
+    }
+    compact();
+    return size_ctrl.size+n<=size_ctrl.ml;
+  }
+
+  void compact_element(
+    group_type* pg,unsigned int n,element_type* p,std::true_type /* move */)
+  {
+    auto        hash=hash_for_element(arrays,p);
+    auto        pg0=arrays.groups();
+    std::size_t pos=static_cast<std::size_t>(pg-pg0);
+    for(prober pb(position_for(hash));pb.get()!=pos;
+        pb.next(arrays.groups_size_mask)){
+      auto pg1=pg0+pb.get();
+      auto mask=pg1->match_available();
+      if(mask!=0){
+        auto n1=unchecked_countr_zero(mask);
+        auto p1=arrays.elements()+pb.get()*N+n1;
+        construct_element(p1,type_policy::move(*p));
+        pg1->set(n1,hash);
+        arrays.store_hash(pb.get()*N+n1,hash);
+        destroy_element(p);
+        pg->reset(n);
+        return;
+      }
+      pg1->mark_overflow(hash);
+    }
+  }
+
+  void compact_element(
+    group_type* pg,unsigned int,element_type* p,std::false_type /* don't */)
+  {
+    auto        hash=hash_for_element(arrays,p);
+    auto        pg0=arrays.groups();
+    std::size_t pos=static_cast<std::size_t>(pg-pg0);
+    for(prober pb(position_for(hash));pb.get()!=pos;
+        pb.next(arrays.groups_size_mask)){
+      pg0[pb.get()].mark_overflow(hash);
+    }
   }
 
   void delete_arrays(arrays_type& arrays_)noexcept
@@ -2135,6 +3700,96 @@ private:
     arrays_type::delete_(typename arrays_type::allocator_type(al()),arrays_);
   }
 
+  static constexpr boost::uint32_t bulk_hash_slot_size=
+    arrays_type::stores_hash?sizeof(typename arrays_type::hash_slot_type):0;
+
+  /* invokes f(p,k) for every run of k consecutive occupied slots starting
+   * at p within a group
+   */
+
+  template<typename F>
+  static void for_all_element_runs(const arrays_type& arrays_,F f)
+  {
+    using mask_type=typename std::make_unsigned<
+      typename group_type::mask_type>::type;
+
+    auto p=arrays_.elements();
+    if(!p)return;
+    for(auto pg=arrays_.groups(),last=pg+arrays_.groups_size_mask+1;
+        pg!=last;++pg,p+=N){
+      auto mask=static_cast<mask_type>(match_really_occupied(pg,last));
+      while(mask){
+        auto n=boost::core::countr_zero(mask);
+        auto k=boost::core::countr_zero(static_cast<mask_type>(~(mask>>n)));
+        f(p+n,static_cast<std::size_t>(k));
+        mask&=static_cast<mask_type>(mask+(mask_type(1)<<n)); /* clear run */
+      }
+    }
+  }
+
+  /* combines the hashes of the first elements as computed by our hash
+   * function, to tell whether archived arrays were laid out with it
+   */
+
+  boost::uint64_t bulk_hash_digest(const arrays_type& arrays_)const
+  {
+    static constexpr std::size_t digest_size=16; /* elements */
+
+    boost::uint64_t res=0;
+    std::size_t     n=0;
+    for_all_elements_while(arrays_,[&,this](element_type* p){
+      res=res*0x9E3779B97F4A7C15ull+
+        static_cast<boost::uint64_t>(hash_for(key_from(*p)));
+      return ++n<digest_size;
+    });
+    return res;
+  }
+
+  template<typename Writer>
+  void save_bulk_hashes(Writer& w,std::true_type /* stored */)const
+  {
+    for_all_element_runs(arrays,[&,this](element_type* p,std::size_t k){
+      w.write(
+        arrays.hashes()+(p-arrays.elements()),k*sizeof(stored_hash_type));
+    });
+  }
+
+  template<typename Writer>
+  void save_bulk_hashes(Writer&,std::false_type /* not stored */)const{}
+
+  template<typename Reader>
+  static void load_bulk_hashes(
+    Reader& r,const arrays_type& arrays_,std::true_type /* stored */)
+  {
+    for_all_element_runs(arrays_,[&](element_type* p,std::size_t k){
+      r.read(
+        arrays_.hashes()+(p-arrays_.elements()),k*sizeof(stored_hash_type));
+    });
+  }
+
+  template<typename Reader>
+  static void load_bulk_hashes(
+    Reader&,const arrays_type&,std::false_type /* not stored */){}
+
+  template<typename Archive>
+  static void skip_bulk_bytes(Archive& ar,boost::uint64_t n)
+  {
+    unsigned char buf[256];
+    while(n){
+      auto m=n<sizeof(buf)?static_cast<std::size_t>(n):sizeof(buf);
+      ar.load_binary(buf,m);
+      n-=m;
+    }
+  }
+
+  locator bulk_reinsert(const element_type& x)
+  {
+    auto hash=hash_for(key_from(x));
+    auto pos0=position_for(hash);
+    if(find(key_from(x),pos0,hash))throw_exception(bad_archive_exception());
+    return unchecked_emplace_at(pos0,hash,x);
+  }
+
   arrays_holder_type make_arrays(std::size_t n)const
   {
     return {new_arrays(n),al()};
@@ -2162,6 +3817,45 @@ private:
     type_policy::construct(this->al(),p,std::forward<Key>(x));
   }
 
+  /* leaves *this empty, with x's hash function, predicate, max load factor
+   * and (if propagated) allocator, and room for x.size() elements
+   */
+
+  void prepare_copy_assign(const table_core& x)
+  {
+    static constexpr auto pocca=
+      alloc_traits::propagate_on_container_copy_assignment::value;
+
+    /* If copy construction here winds up throwing, the container is still
+     * left intact so we perform these operations first.
+     */
+    hasher    tmp_h=x.h();
+    key_equal tmp_p=x.pred();
+
+    mlf_=x.mlf_;
+    clear();
+
+    /* Because we've asserted at compile-time that Hash and Pred are nothrow
+     * swappable, we can safely mutate our source container and maintain
+     * consistency between the Hash, Pred compatibility.
+     */
+    using std::swap;
+    swap(h(),tmp_h);
+    swap(pred(),tmp_p);
+
+    if_constexpr<pocca>([&,this]{
+      if(al()!=x.al()){
+        auto ah=x.make_arrays(std::size_t(std::ceil(float(x.size())/mlf_)));
+        delete_arrays(arrays);
+        arrays=ah.release();
+        size_ctrl.ml=initial_max_load();
+      }
+      copy_assign_if<pocca>(al(),x.al());
+    });
+    /* noshrink: favor memory reuse over tightness */
+    noshrink_reserve(x.size());
+  }
+
   void copy_elements_from(const table_core& x)
   {
     BOOST_ASSERT(empty());
@@ -2170,17 +3864,38 @@ private:
       fast_copy_elements_from(x);
     }
     else{
-      x.for_all_elements([this](const element_type* p){
-        unchecked_insert(*p);
+      x.for_all_elements([&x,this](const element_type* p){
+        unchecked_insert(hash_for_element(x.arrays,p),*p);
       });
     }
   }
 
+  void copy_elements_from(
+    const table_core& x,const arrays_type& x_old_arrays_)
+  {
+    if(!x_old_arrays_.elements()){
+      copy_elements_from(x);
+    }
+    else{
+      BOOST_ASSERT(empty());
+      BOOST_ASSERT(this!=std::addressof(x));
+      auto copy_from=[this](const arrays_type& arrays_){
+        for_all_elements(arrays_,[&,this](const element_type* p){
+          unchecked_insert(hash_for_element(arrays_,p),*p);
+        });
+      };
+      copy_from(x_old_arrays_);
+      copy_from(x.arrays);
+    }
+  }
+
   void fast_copy_elements_from(const table_core& x)
   {
     if(arrays.elements()&&x.arrays.elements()){
       copy_elements_array_from(x);
       copy_groups_array_from(x);
+      copy_hashes_array_from(
+        x,std::integral_constant<bool,arrays_type::stores_hash>{});
       size_ctrl.ml=std::size_t(x.size_ctrl.ml);
       size_ctrl.size=std::size_t(x.size_ctrl.size);
     }
@@ -2255,11 +3970,230 @@ private:
     }
   }
 
+  void copy_hashes_array_from(
+    const table_core& x,std::true_type /* stored */)
+  {
+    std::memcpy(
+      arrays.hashes(),x.arrays.hashes(),
+      x.capacity()*sizeof(stored_hash_type));
+  }
+
+  void copy_hashes_array_from(const table_core&,std::false_type){}
+
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+  /* Parallel copy: if both tables have the same layout, groups are split into
+   * ranges copied independently (elements, metadata and stored hashes) by
+   * the threads of the execution policy. Otherwise, x's groups are split
+   * the same way and their elements emplaced along their probe sequences in
+   * *this under group locks (see parallel_insert). If an exception is thrown,
+   * *this is left empty.
+   */
+
+  static constexpr std::size_t copy_chunk_size=256; /* groups */
+
+  template<typename ExecutionPolicy>
+  void copy_elements_from(ExecutionPolicy&& policy,const table_core& x)
+  {
+    BOOST_ASSERT(empty());
+    BOOST_ASSERT(this!=std::addressof(x));
+    if(x.empty())return;
+
+    if(arrays.groups_size_mask==x.arrays.groups_size_mask){
+      BOOST_TRY{
+        for_each_group_range(
+          std::forward<ExecutionPolicy>(policy),arrays.groups_size_mask+1,
+          [&,this](std::size_t first,std::size_t last){
+            copy_group_range_from(x,first,last);
+          });
+      }
+      BOOST_CATCH(...){
+        clear();
+        BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+      size_ctrl.ml=std::size_t(x.size_ctrl.ml);
+      size_ctrl.size=std::size_t(x.size_ctrl.size);
+    }
+    else{
+      group_locks              locks{al(),arrays.groups_size_mask+1};
+      std::atomic<std::size_t> num_inserted{0};
+      BOOST_TRY{
+        for_each_group_range(
+          std::forward<ExecutionPolicy>(policy),x.arrays.groups_size_mask+1,
+          [&,this](std::size_t first,std::size_t last){
+            std::size_t s=0;
+            BOOST_TRY{
+              for_elements_in_group_range_while(
+                x.arrays,first,last,[&,this](const element_type* p){
+                  s+=parallel_emplace(
+                    locks.data(),hash_for_element(x.arrays,p),*p);
+                  return true;
+                });
+            }
+            BOOST_CATCH(...){
+              num_inserted+=s;
+              BOOST_RETHROW
+            }
+            BOOST_CATCH_END
+            num_inserted+=s;
+          });
+      }
+      BOOST_CATCH(...){
+        clear();
+        BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+      size_ctrl.size=num_inserted.load();
+    }
+  }
+
+  /* elements in x_old_arrays_ are rare and short-lived: copy sequentially */
+
+  template<typename ExecutionPolicy>
+  void copy_elements_from(
+    ExecutionPolicy&& policy,const table_core& x,
+    const arrays_type& x_old_arrays_)
+  {
+    if(!x_old_arrays_.elements()){
+      copy_elements_from(std::forward<ExecutionPolicy>(policy),x);
+    }
+    else{
+      copy_elements_from(x,x_old_arrays_);
+    }
+  }
+
+  /* Invokes f(first,last) in parallel for consecutive ranges of groups
+   * covering [0,n). Once an exception is thrown, remaining ranges are
+   * skipped and the exception is rethrown at the end.
+   */
+
+  template<typename ExecutionPolicy,typename F>
+  static void for_each_group_range(ExecutionPolicy&& policy,std::size_t n,F f)
+  {
+    std::vector<std::size_t> chunks;
+    chunks.reserve((n+copy_chunk_size-1)/copy_chunk_size);
+    for(std::size_t i=0;i<n;i+=copy_chunk_size)chunks.push_back(i);
+
+    std::atomic<bool>  failed{false};
+    std::exception_ptr ep;
+    BOOST_TRY{
+      std::for_each(
+        std::forward<ExecutionPolicy>(policy),chunks.begin(),chunks.end(),
+        [&](std::size_t first){
+          if(failed.load(std::memory_order_relaxed))return;
+          BOOST_TRY{
+            f(first,(std::min)(first+copy_chunk_size,n));
+          }
+          BOOST_CATCH(...){
+            if(!failed.exchange(true))ep=std::current_exception();
+          }
+          BOOST_CATCH_END
+        }
+      );
+    }
+    BOOST_CATCH(...){ /* parallel algorithm failed to acquire resources */
+      if(!failed.exchange(true))ep=std::current_exception();
+    }
+    BOOST_CATCH_END
+
+    if(failed.load())std::rethrow_exception(ep);
+  }
+
+  template<typename F>
+  static bool for_elements_in_group_range_while(
+    const arrays_type& arrays_,std::size_t first,std::size_t last,F f)
+  {
+    auto pg=arrays_.groups()+first,
+         last_group=arrays_.groups()+arrays_.groups_size_mask+1;
+    auto p=arrays_.elements()+first*N;
+    for(auto i=first;i!=last;++i,++pg,p+=N){
+      auto mask=match_really_occupied(pg,last_group);
+      while(mask){
+        if(!f(p+unchecked_countr_zero(mask)))return false;
+        mask&=mask-1;
+      }
+    }
+    return true;
+  }
+
+  /* Elements are copied before metadata so that, on exception, groups in
+   * [first,last) are left empty.
+   */
+
+  void copy_group_range_from(
+    const table_core& x,std::size_t first,std::size_t last)
+  {
+    copy_elements_array_from(
+      x,first,last,
+      std::integral_constant<
+        bool,
+        is_trivially_copy_constructible<element_type>::value&&(
+          is_std_allocator<Allocator>::value||
+          !alloc_has_construct<Allocator,value_type*,const value_type&>::value)
+      >{}
+    );
+    std::copy(
+      x.arrays.groups()+first,x.arrays.groups()+last,arrays.groups()+first);
+    copy_hashes_array_from(
+      x,first,last,std::integral_constant<bool,arrays_type::stores_hash>{});
+  }
+
+  void copy_elements_array_from(
+    const table_core& x,std::size_t first,std::size_t last,
+    std::true_type /* -> memcpy */)
+  {
+    std::memcpy(
+      reinterpret_cast<unsigned char*>(arrays.elements()+first*N),
+      reinterpret_cast<unsigned char*>(x.arrays.elements()+first*N),
+      ((std::min)(last*N,x.capacity())-first*N)*sizeof(value_type));
+  }
+
+  void copy_elements_array_from(
+    const table_core& x,std::size_t first,std::size_t last,
+    std::false_type /* -> manual */)
+  {
+    std::size_t num_constructed=0;
+    BOOST_TRY{
+      for_elements_in_group_range_while(
+        x.arrays,first,last,[&,this](const element_type* p){
+          construct_element(arrays.elements()+(p-x.arrays.elements()),*p);
+          ++num_constructed;
+          return true;
+        });
+    }
+    BOOST_CATCH(...){
+      if(num_constructed){
+        for_elements_in_group_range_while(
+          x.arrays,first,last,[&,this](const element_type* p){
+            destroy_element(arrays.elements()+(p-x.arrays.elements()));
+            return --num_constructed!=0;
+          });
+      }
+      BOOST_RETHROW
+    }
+    BOOST_CATCH_END
+  }
+
+  void copy_hashes_array_from(
+    const table_core& x,std::size_t first,std::size_t last,
+    std::true_type /* stored */)
+  {
+    auto n=(std::min)(last*N,x.capacity());
+    std::copy(
+      x.arrays.hashes()+first*N,x.arrays.hashes()+n,
+      arrays.hashes()+first*N);
+  }
+
+  void copy_hashes_array_from(
+    const table_core&,std::size_t,std::size_t,std::false_type){}
+#endif
+
   void recover_slot(unsigned char* pc)
   {
     /* If this slot potentially caused overflow, we decrease the maximum load
      * so that average probe length won't increase unboundedly in repeated
-     * insert/erase cycles (drift).
+     * insert/erase cycles (drift). The maximum load is restored by rehashing
+     * or compacting (see compact_for_growth).
      */
     size_ctrl.ml-=group_type::maybe_caused_overflow(pc);
     group_type::reset(pc);
@@ -2319,10 +4253,177 @@ private:
     size_ctrl.ml=initial_max_load();
   }
 
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+  /* Parallel rehashing: old groups are distributed among the threads of the
+   * execution policy, and each element is moved to the new arrays after
+   * claiming a slot (or marking overflow) under the lock of the destination
+   * group. Element transfer is required not to throw, and moved elements are
+   * removed from their old groups so that, if the hash function throws,
+   * the old arrays can be restored with the elements not yet moved (those
+   * already moved are lost, as in unchecked_rehash(arrays_type&)).
+   * Insertion stats are not recorded.
+   */
+
+  struct group_locks
+  {
+    using allocator_type=
+      typename boost::allocator_rebind<Allocator,rw_spinlock>::type;
+    using pointer=typename boost::allocator_pointer<allocator_type>::type;
+
+    group_locks(const Allocator& al_,std::size_t n_):
+      al{al_},n{n_},p{boost::allocator_allocate(al,n)}
+    {
+      for(std::size_t i=0;i<n;++i)::new (data()+i) rw_spinlock();
+    }
+
+    group_locks(const group_locks&)=delete;
+    group_locks& operator=(const group_locks&)=delete;
+
+    ~group_locks(){boost::allocator_deallocate(al,p,n);}
+
+    rw_spinlock* data()const noexcept{return boost::to_address(p);}
+
+    allocator_type al;
+    std::size_t    n;
+    pointer        p;
+  };
+
+  template<typename ExecutionPolicy>
+  BOOST_NOINLINE void unchecked_rehash(ExecutionPolicy&& policy,std::size_t n)
+  {
+    unchecked_rehash(
+      std::forward<ExecutionPolicy>(policy),n,
+      std::integral_constant<
+        bool,
+        std::is_nothrow_move_constructible<init_type>::value||
+        !std::is_same<element_type,value_type>::value>{});
+  }
+
+  template<typename ExecutionPolicy>
+  void unchecked_rehash(ExecutionPolicy&&,std::size_t n,std::false_type)
+  {
+    /* elements are copied or can throw on move: go sequential */
+    unchecked_rehash(n);
+  }
+
+  template<typename ExecutionPolicy>
+  void unchecked_rehash(
+    ExecutionPolicy&& policy,std::size_t n,std::true_type /* nothrow */)
+  {
+    if(empty()){
+      unchecked_rehash(n);
+      return;
+    }
+
+    group_locks locks{al(),(n+1)/N}; /* n is an exact capacity */
+    auto        new_arrays_=new_arrays(n);
+    BOOST_ASSERT(locks.n==new_arrays_.groups_size_mask+1);
+
+    std::atomic<bool>  failed{false};
+    std::exception_ptr ep;
+    auto               pg0=arrays.groups(),last=pg0+arrays.groups_size_mask+1;
+    BOOST_TRY{
+      std::for_each(std::forward<ExecutionPolicy>(policy),pg0,last,
+        [&,this](group_type& g){
+          if(failed.load(std::memory_order_relaxed))return;
+          auto pg=&g;
+          auto p=arrays.elements()+static_cast<std::size_t>(pg-pg0)*N;
+          auto mask=match_really_occupied(pg,last);
+          BOOST_TRY{
+            while(mask){
+              auto n=unchecked_countr_zero(mask);
+              parallel_transfer_element(p+n,new_arrays_,locks.data());
+              pg->reset(n);
+              mask&=mask-1;
+            }
+          }
+          BOOST_CATCH(...){
+            if(!failed.exchange(true))ep=std::current_exception();
+          }
+          BOOST_CATCH_END
+        }
+      );
+    }
+    BOOST_CATCH(...){ /* parallel algorithm failed to acquire resources */
+      if(!failed.exchange(true))ep=std::current_exception();
+    }
+    BOOST_CATCH_END
+
+    if(failed.load()){
+      /* Same treatment as recover_slot for the elements moved, conservatively
+       * assuming that each of them caused overflow.
+       */
+      for_all_elements(new_arrays_,[this](element_type* p){
+        destroy_element(p);
+      });
+      delete_arrays(new_arrays_);
+      std::size_t s=0;
+      for_all_elements([&](element_type*){++s;});
+      size_ctrl.ml-=size_ctrl.size-s;
+      size_ctrl.size=s;
+      std::rethrow_exception(ep);
+    }
+
+    delete_arrays(arrays);
+    arrays=new_arrays_;
+    size_ctrl.ml=initial_max_load();
+  }
+
   template<typename Value>
-  void unchecked_insert(Value&& x)
+  bool parallel_emplace(rw_spinlock* locks,std::size_t hash,Value&& x)
+  {
+    const auto& k=key_from(x);
+    for(prober pb(position_for(hash));;pb.next(arrays.groups_size_mask)){
+      auto                         pos=pb.get();
+      auto                         pg=arrays.groups()+pos;
+      auto                         p=arrays.elements()+pos*N;
+      std::lock_guard<rw_spinlock> lck{locks[pos]};
+      auto                         mask=pg->match(hash);
+      while(mask){
+        auto n=unchecked_countr_zero(mask);
+        if(BOOST_LIKELY(bool(pred()(k,key_from(p[n])))))return false;
+        mask&=mask-1;
+      }
+      mask=pg->match_available();
+      if(BOOST_LIKELY(mask!=0)){
+        auto n=unchecked_countr_zero(mask);
+        construct_element(p+n,std::forward<Value>(x));
+        pg->set(n,hash);
+        arrays.store_hash(pos*N+n,hash);
+        return true;
+      }
+      pg->mark_overflow(hash);
+    }
+  }
+
+  void parallel_transfer_element(
+    element_type* p,const arrays_type& arrays_,rw_spinlock* locks)
+  {
+    auto hash=hash_for_element(arrays,p);
+    for(prober pb(position_for(hash,arrays_));;
+        pb.next(arrays_.groups_size_mask)){
+      auto pos=pb.get();
+      auto pg=arrays_.groups()+pos;
+      locks[pos].lock();
+      auto mask=pg->match_available();
+      if(BOOST_LIKELY(mask!=0)){
+        auto n=unchecked_countr_zero(mask);
+        pg->set(n,hash);
+        locks[pos].unlock();
+        arrays_.store_hash(pos*N+n,hash);
+        construct_element(arrays_.elements()+pos*N+n,type_policy::move(*p));
+        destroy_element(p);
+        return;
+      }
+      pg->mark_overflow(hash);
+      locks[pos].unlock();
+    }
+  }
+#endif
+
+  template<typename Value>
+  void unchecked_insert(std::size_t hash,Value&& x)
   {
-    auto hash=hash_for(key_from(x));
     unchecked_emplace_at(position_for(hash),hash,std::forward<Value>(x));
   }
 
@@ -2330,7 +4431,15 @@ private:
     element_type* p,const arrays_type& arrays_,std::size_t& num_destroyed)
   {
     nosize_transfer_element(
-      p,hash_for(key_from(*p)),arrays_,num_destroyed,
+      p,hash_for_element(arrays,p),arrays_,num_destroyed);
+  }
+
+  void nosize_transfer_element(
+    element_type* p,std::size_t hash,const arrays_type& arrays_,
+    std::size_t& num_destroyed)
+  {
+    nosize_transfer_element(
+      p,hash,arrays_,num_destroyed,
       std::integral_constant< /* std::move_if_noexcept semantics */
         bool,
         std::is_nothrow_move_constructible<init_type>::value||
@@ -2375,6 +4484,7 @@ private:
         auto p=arrays_.elements()+pos*N+n;
         construct_element(p,std::forward<Args>(args)...);
         pg->set(n,hash);
+        arrays_.store_hash(pos*N+n,hash);
         BOOST_UNORDERED_ADD_STATS(cstats.insertion,(pb.length()));
         return {pg,n,p};
       }
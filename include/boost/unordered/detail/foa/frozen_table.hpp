@@ -0,0 +1,448 @@
+/* Read-only open-addressing hash table with precomputed element placement.
+ *
+ * Copyright 2026 agent.
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See https://www.boost.org/libs/unordered for library home page.
+ */
+
+#ifndef BOOST_UNORDERED_DETAIL_FOA_FROZEN_TABLE_HPP
+#define BOOST_UNORDERED_DETAIL_FOA_FROZEN_TABLE_HPP
+
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <boost/core/allocator_access.hpp>
+#include <boost/core/empty_value.hpp>
+#include <boost/core/pointer_traits.hpp>
+#include <boost/unordered/detail/foa/table.hpp>
+#include <boost/unordered/detail/static_assert.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace boost{
+namespace unordered{
+namespace detail{
+namespace foa{
+
+/* frozen_table is an immutable version of foa::table built once from the
+ * contents of another container and optimized for lookup:
+ *
+ *   - Elements are placed offline: every group is first assigned the
+ *     elements whose hash maps to it, and only the excess of overfull groups
+ *     is then moved down the probe sequence, so no element is displaced
+ *     from its initial group unless strictly necessary (insertion into a
+ *     growing table, in contrast, fills groups in arrival order and
+ *     displaces whatever comes last). Among the elements of an overfull
+ *     group, those displaced are chosen so as to set as few overflow bits as
+ *     possible, which shortens unsuccessful lookups.
+ *   - There's no sentinel in the last group, so all slots are usable, and
+ *     the number of groups is the minimum complying with the maximum load
+ *     factor.
+ *   - Groups and elements live in a single allocation, each array aligned to
+ *     a cache line. The groups array is kept separate from the elements
+ *     array (rather than interleaving each group with its elements) as the
+ *     former, being much smaller, tends to stay in cache, which is what makes
+ *     unsuccessful lookups fast.
+ *
+ * Lookup follows exactly the same probing protocol as foa::table. Iteration
+ * uses foa::table's const_iterator, which requires a sentinel: an extra
+ * group, not reachable by lookup, is allocated past the last one to hold it.
+ */
+
+static constexpr std::size_t frozen_alignment=64; /* cache line */
+
+template<typename TypePolicy,typename Hash,typename Pred,typename Allocator>
+class frozen_table:
+  empty_value<Hash,0>,empty_value<Pred,1>,empty_value<Allocator,2>
+{
+  using hash_base=empty_value<Hash,0>;
+  using pred_base=empty_value<Pred,1>;
+  using allocator_base=empty_value<Allocator,2>;
+  using core=table_core_impl<TypePolicy,Hash,Pred,Allocator>;
+  using type_policy=TypePolicy;
+  using group_type=typename core::group_type;
+  static constexpr auto N=core::N;
+  using prober=typename core::prober;
+  using size_policy=typename core::size_policy;
+  using mix_policy=typename core::mix_policy;
+  using stored_hash_policy_type=typename core::stored_hash_policy_type;
+  using element_type=typename core::element_type;
+  using alloc_traits=boost::allocator_traits<Allocator>;
+  using char_allocator_type=
+    typename boost::allocator_rebind<Allocator,unsigned char>::type;
+  using char_alloc_traits=boost::allocator_traits<char_allocator_type>;
+  using char_pointer=typename char_alloc_traits::pointer;
+
+  BOOST_UNORDERED_STATIC_ASSERT(alignof(group_type)<=frozen_alignment);
+  BOOST_UNORDERED_STATIC_ASSERT(alignof(element_type)<=frozen_alignment);
+
+public:
+  using key_type=typename type_policy::key_type;
+  using value_type=typename type_policy::value_type;
+  using hasher=Hash;
+  using key_equal=Pred;
+  using allocator_type=Allocator;
+  using size_type=std::size_t;
+  using const_iterator=table_iterator<type_policy,group_type*,true>;
+
+  frozen_table(
+    const Hash& h_=Hash(),const Pred& pred_=Pred(),
+    const Allocator& al_=Allocator()):
+    hash_base{empty_init,h_},pred_base{empty_init,pred_},
+    allocator_base{empty_init,al_}
+  {}
+
+  explicit frozen_table(const table<TypePolicy,Hash,Pred,Allocator>& x):
+    frozen_table{x.hash_function(),x.key_eq(),x.get_allocator()}
+  {
+    build(x.begin(),x.size(),[](const value_type& v)->const value_type&{
+      return v;
+    });
+  }
+
+  /* elements of x are left in a moved-from state */
+
+  explicit frozen_table(table<TypePolicy,Hash,Pred,Allocator>&& x):
+    frozen_table{x.hash_function(),x.key_eq(),x.get_allocator()}
+  {
+    /* set iterators are const */
+
+    build(
+      x.begin(),x.size(),
+      [](const value_type& v)
+        ->decltype(type_policy::move(std::declval<element_type&>())){
+        return type_policy::move(const_cast<element_type&>(v));
+      });
+  }
+
+  frozen_table(const frozen_table& x):
+    frozen_table{
+      x.h(),x.pred(),
+      alloc_traits::select_on_container_copy_construction(x.al())}
+  {
+    build(x.begin(),x.size(),[](const value_type& v)->const value_type&{
+      return v;
+    });
+  }
+
+  frozen_table(frozen_table&& x)noexcept:
+    hash_base{empty_init,std::move(x.h())},
+    pred_base{empty_init,std::move(x.pred())},
+    allocator_base{empty_init,std::move(x.al())}
+  {
+    steal(x);
+  }
+
+  ~frozen_table()noexcept
+  {
+    delete_arrays();
+  }
+
+  frozen_table& operator=(frozen_table x)noexcept
+  {
+    swap(x);
+    return *this;
+  }
+
+  void swap(frozen_table& x)noexcept
+  {
+    using std::swap;
+    swap(h(),x.h());
+    swap(pred(),x.pred());
+    swap(al(),x.al());
+    swap(storage_,x.storage_);
+    swap(storage_size_,x.storage_size_);
+    swap(groups_,x.groups_);
+    swap(elements_,x.elements_);
+    swap(groups_size_index,x.groups_size_index);
+    swap(groups_size_mask,x.groups_size_mask);
+    swap(size_,x.size_);
+  }
+
+  const_iterator begin()const noexcept
+  {
+    const_iterator it{groups_,0,elements_};
+    if(elements_&&!(groups_[0].match_occupied()&0x1))++it;
+    return it;
+  }
+
+  const_iterator end()const noexcept{return {};}
+
+  bool        empty()const noexcept{return size_==0;}
+  std::size_t size()const noexcept{return size_;}
+
+  std::size_t capacity()const noexcept
+  {
+    return elements_?(groups_size_mask+1)*N:0;
+  }
+
+  hasher         hash_function()const{return h();}
+  key_equal      key_eq()const{return pred();}
+  allocator_type get_allocator()const noexcept{return al();}
+
+#if defined(BOOST_MSVC)
+/* warning: forcing value to bool 'true' or 'false' in bool(pred()...) */
+#pragma warning(push)
+#pragma warning(disable:4800)
+#endif
+
+  template<typename Key>
+  BOOST_FORCEINLINE const_iterator find(const Key& x)const
+  {
+    if(!elements_)return end();
+
+    auto   hash=hash_for(x);
+    prober pb(size_policy::position(hash,groups_size_index));
+    do{
+      auto pos=pb.get();
+      auto pg=groups_+pos;
+      auto mask=pg->match(hash);
+      if(mask){
+        auto p=elements_+pos*N;
+        BOOST_UNORDERED_PREFETCH_ELEMENTS(p,N);
+        do{
+          auto n=unchecked_countr_zero(mask);
+          if(BOOST_LIKELY(bool(pred()(x,type_policy::extract(p[n]))))){
+            return {pg,n,p+n};
+          }
+          mask&=mask-1;
+        }while(mask);
+      }
+      if(BOOST_LIKELY(pg->is_not_overflowed(hash)))return end();
+    }
+    while(BOOST_LIKELY(pb.next(groups_size_mask)));
+    return end();
+  }
+
+#if defined(BOOST_MSVC)
+#pragma warning(pop) /* C4800 */
+#endif
+
+  friend bool operator==(const frozen_table& x,const frozen_table& y)
+  {
+    if(x.size()!=y.size())return false;
+    for(const auto& v:x){
+      auto it=y.find(type_policy::extract(v));
+      if(it==y.end()||!(v==*it))return false;
+    }
+    return true;
+  }
+
+  friend bool operator!=(const frozen_table& x,const frozen_table& y)
+  {
+    return !(x==y);
+  }
+
+private:
+  Hash&            h(){return hash_base::get();}
+  const Hash&      h()const{return hash_base::get();}
+  Pred&            pred(){return pred_base::get();}
+  const Pred&      pred()const{return pred_base::get();}
+  Allocator&       al(){return allocator_base::get();}
+  const Allocator& al()const{return allocator_base::get();}
+
+  template<typename Key>
+  std::size_t hash_for(const Key& x)const
+  {
+    return stored_hash_policy_type::canonical(mix_policy::mix(h(),x));
+  }
+
+  /* Builds the table from the n elements starting at first, constructing
+   * each from get(*it). All callers are delegating constructors, so if an
+   * exception is thrown ~frozen_table destroys the elements placed so far.
+   */
+
+  template<typename Iterator,typename Get>
+  void build(Iterator first,std::size_t n,Get get)
+  {
+    using source_pointer=decltype(std::addressof(*first));
+
+    if(n==0)return;
+
+    auto num_groups=(
+      static_cast<std::size_t>(std::ceil(static_cast<float>(n)/mlf))+N-1)/N;
+    groups_size_index=size_policy::size_index(num_groups);
+    num_groups=size_policy::size(groups_size_index);
+    groups_size_mask=num_groups-1;
+    new_arrays();
+
+    /* counting sort of elements by initial group */
+
+    std::vector<source_pointer> sources(n);
+    std::vector<std::size_t>    hashes(n),order(n),offsets(num_groups+1,0);
+    for(std::size_t i=0;i<n;++i,++first){
+      sources[i]=std::addressof(*first);
+      hashes[i]=hash_for(type_policy::extract(*first));
+      ++offsets[size_policy::position(hashes[i],groups_size_index)+1];
+    }
+    for(std::size_t pos=0;pos<num_groups;++pos){
+      offsets[pos+1]+=offsets[pos];
+    }
+    {
+      std::vector<std::size_t> next(offsets.begin(),offsets.end()-1);
+      for(std::size_t i=0;i<n;++i){
+        order[next[size_policy::position(hashes[i],groups_size_index)]++]=i;
+      }
+    }
+
+    /* phase 1: groups take their own elements, overfull groups spill
+     * their excess
+     */
+
+    std::vector<unsigned char> fill(num_groups,0);
+    std::vector<std::size_t>   spilled;
+    for(std::size_t pos=0;pos<num_groups;++pos){
+      auto it0=order.begin()+static_cast<std::ptrdiff_t>(offsets[pos]),
+           it1=order.begin()+static_cast<std::ptrdiff_t>(offsets[pos+1]);
+      auto count=static_cast<std::size_t>(it1-it0);
+      if(count>N){
+        /* Lookups for a hash h not found in its initial group stop there
+         * if the overflow bit h%8 is not set. Spill the excess from as few
+         * h%8 classes as possible: taking the most populated ones first
+         * is optimal.
+         */
+
+        std::size_t quota[8]={0},classes[8]={0,1,2,3,4,5,6,7};
+        for(auto it=it0;it!=it1;++it)++quota[hashes[*it]%8];
+        std::sort(
+          classes,classes+8,
+          [&](std::size_t i,std::size_t j){return quota[i]>quota[j];});
+        auto excess=count-N;
+        for(auto c:classes){
+          if(quota[c]>excess)quota[c]=excess;
+          excess-=quota[c];
+        }
+        for(auto it=it0;it!=it1;++it){
+          auto& q=quota[hashes[*it]%8];
+          if(q){
+            --q;
+            spilled.push_back(*it);
+          }
+          else place(pos,fill[pos]++,hashes[*it],get(*sources[*it]));
+        }
+      }
+      else{
+        for(auto it=it0;it!=it1;++it){
+          place(pos,fill[pos]++,hashes[*it],get(*sources[*it]));
+        }
+      }
+    }
+
+    /* phase 2: spilled elements go to the first non-full group down their
+     * probe sequence
+     */
+
+    for(auto i:spilled){
+      prober pb(size_policy::position(hashes[i],groups_size_index));
+      for(;;){
+        auto pos=pb.get();
+        if(fill[pos]<N){
+          place(pos,fill[pos]++,hashes[i],get(*sources[i]));
+          break;
+        }
+        groups_[pos].mark_overflow(hashes[i]);
+        if(!pb.next(groups_size_mask)){
+          BOOST_ASSERT(false); /* can't happen, capacity()>=n */
+          break;
+        }
+      }
+    }
+  }
+
+  template<typename Arg>
+  void place(std::size_t pos,std::size_t n,std::size_t hash,Arg&& arg)
+  {
+    type_policy::construct(al(),elements_+pos*N+n,std::forward<Arg>(arg));
+    groups_[pos].set(n,hash);
+    ++size_;
+  }
+
+  static std::size_t round_up(std::size_t n)noexcept
+  {
+    return (n+frozen_alignment-1)/frozen_alignment*frozen_alignment;
+  }
+
+  std::size_t elements_offset()const noexcept
+  {
+    return round_up((groups_size_mask+2)*sizeof(group_type));
+  }
+
+  void new_arrays()
+  {
+    auto num_groups=groups_size_mask+1;
+    char_allocator_type cal(al());
+    storage_size_=
+      elements_offset()+num_groups*N*sizeof(element_type)+frozen_alignment-1;
+    storage_=char_alloc_traits::allocate(cal,storage_size_);
+    auto p=boost::to_address(storage_);
+    p+=(frozen_alignment-reinterpret_cast<std::uintptr_t>(p)%frozen_alignment)%
+       frozen_alignment;
+    groups_=reinterpret_cast<group_type*>(p);
+    elements_=reinterpret_cast<element_type*>(p+elements_offset());
+    for(std::size_t pos=0;pos<=num_groups;++pos)groups_[pos].initialize();
+    groups_[num_groups].set_sentinel();
+  }
+
+  void delete_arrays()noexcept
+  {
+    if(!elements_)return;
+    for(std::size_t pos=0;pos<=groups_size_mask;++pos){
+      auto mask=groups_[pos].match_occupied();
+      while(mask){
+        type_policy::destroy(
+          al(),elements_+pos*N+unchecked_countr_zero(mask));
+        mask&=mask-1;
+      }
+    }
+    char_allocator_type cal(al());
+    char_alloc_traits::deallocate(cal,storage_,storage_size_);
+    storage_=char_pointer();
+    storage_size_=0;
+    groups_=nullptr;
+    elements_=nullptr;
+    groups_size_index=0;
+    groups_size_mask=0;
+    size_=0;
+  }
+
+  void steal(frozen_table& x)noexcept
+  {
+    storage_=x.storage_;
+    storage_size_=x.storage_size_;
+    groups_=x.groups_;
+    elements_=x.elements_;
+    groups_size_index=x.groups_size_index;
+    groups_size_mask=x.groups_size_mask;
+    size_=x.size_;
+    x.storage_=char_pointer();
+    x.storage_size_=0;
+    x.groups_=nullptr;
+    x.elements_=nullptr;
+    x.groups_size_index=0;
+    x.groups_size_mask=0;
+    x.size_=0;
+  }
+
+  char_pointer   storage_=char_pointer();
+  std::size_t    storage_size_=0;
+  group_type*    groups_=nullptr;
+  element_type*  elements_=nullptr;
+  std::size_t    groups_size_index=0;
+  std::size_t    groups_size_mask=0;
+  std::size_t    size_=0;
+};
+
+} /* namespace foa */
+} /* namespace detail */
+} /* namespace unordered */
+} /* namespace boost */
+
+#endif
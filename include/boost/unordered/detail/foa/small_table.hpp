@@ -0,0 +1,813 @@
+/* Fast open-addressing hash table with inline storage for small sizes.
+ *
+ * Copyright 2026 agent.
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See https://www.boost.org/libs/unordered for library home page.
+ */
+
+#ifndef BOOST_UNORDERED_DETAIL_FOA_SMALL_TABLE_HPP
+#define BOOST_UNORDERED_DETAIL_FOA_SMALL_TABLE_HPP
+
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <boost/core/bit.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/unordered/detail/foa/table.hpp>
+#include <boost/unordered/detail/static_assert.hpp>
+#include <boost/unordered/detail/type_traits.hpp>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace boost{
+namespace unordered{
+namespace detail{
+namespace foa{
+
+/* Inline storage for up to N elements. Occupied slots are tracked with a
+ * bitmask so that erasure does not move elements around.
+ */
+
+template<typename Element,std::size_t N>
+struct small_table_storage
+{
+  BOOST_UNORDERED_STATIC_ASSERT(N>0&&N<=64);
+
+  static constexpr boost::uint64_t full_mask=
+    N==64?~boost::uint64_t(0):(boost::uint64_t(1)<<N)-1;
+
+  small_table_storage(){}
+  ~small_table_storage(){}
+
+  std::size_t size()const noexcept
+  {
+    return static_cast<std::size_t>(boost::core::popcount(mask));
+  }
+
+  bool full()const noexcept{return mask==full_mask;}
+
+  Element* first()const noexcept
+  {
+    return mask?element(unchecked_countr_zero(mask)):nullptr;
+  }
+
+  /* first occupied slot after p, which needs not be occupied itself */
+
+  Element* next(const Element* p)const noexcept
+  {
+    auto n=static_cast<std::size_t>(p-elements)+1;
+    auto m=n==64?0:(mask>>n)<<n;
+    return m?element(unchecked_countr_zero(m)):nullptr;
+  }
+
+  Element* element(std::size_t n)const noexcept
+  {
+    return const_cast<Element*>(elements+n);
+  }
+
+  boost::uint64_t mask=0;
+  union{Element elements[N];};
+};
+
+/* small_table_iterator keeps either a pointer to an element in inline
+ * storage, plus a pointer to the storage itself for traversal, or an
+ * iterator into the regular table. p=nullptr is used to mark the latter
+ * case, so end() iterators are the same in both modes.
+ */
+
+template<typename TypePolicy,typename Storage,typename Iterator,bool Const>
+class small_table_iterator
+{
+  using type_policy=TypePolicy;
+  using table_element_type=typename type_policy::element_type;
+
+public:
+  using difference_type=std::ptrdiff_t;
+  using value_type=typename type_policy::value_type;
+  using pointer=
+    typename std::conditional<Const,value_type const*,value_type*>::type;
+  using reference=
+    typename std::conditional<Const,value_type const&,value_type&>::type;
+  using iterator_category=std::forward_iterator_tag;
+  using element_type=
+    typename std::conditional<Const,value_type const,value_type>::type;
+
+  small_table_iterator()=default;
+  template<
+    typename Iterator2,bool Const2,
+    typename std::enable_if<!Const2>::type* =nullptr
+  >
+  small_table_iterator(
+    const small_table_iterator<TypePolicy,Storage,Iterator2,Const2>& x):
+    p_{x.p_},ps_{x.ps_},it_{x.it_}{}
+  template<typename Iterator2>
+  small_table_iterator(
+    const_iterator_cast_tag,
+    const small_table_iterator<TypePolicy,Storage,Iterator2,true>& x):
+    p_{x.p_},ps_{x.ps_},it_{const_iterator_cast_tag{},x.it_}{}
+
+  inline reference operator*()const noexcept
+    {return p_?type_policy::value_from(*p_):*it_;}
+  inline pointer operator->()const noexcept
+    {return std::addressof(this->operator*());}
+  inline small_table_iterator& operator++()noexcept
+    {increment();return *this;}
+  inline small_table_iterator operator++(int)noexcept
+    {auto x=*this;increment();return x;}
+  friend inline bool operator==(
+    const small_table_iterator& x,const small_table_iterator& y)
+    {return x.p_==y.p_&&x.it_==y.it_;}
+  friend inline bool operator!=(
+    const small_table_iterator& x,const small_table_iterator& y)
+    {return !(x==y);}
+
+private:
+  template<typename,typename,typename,bool> friend class small_table_iterator;
+  template<typename,typename> friend class small_table_erase_return_type;
+  template<typename,std::size_t,typename,typename,typename>
+  friend class small_table;
+
+  small_table_iterator(table_element_type* p,const Storage* ps):
+    p_{p},ps_{ps}{}
+  small_table_iterator(const Iterator& it):it_{it}{}
+
+  inline void increment()noexcept
+  {
+    if(p_){
+      p_=ps_->next(p_);
+      if(!p_)ps_=nullptr;
+    }
+    else ++it_;
+  }
+
+  table_element_type *p_=nullptr;
+  const Storage      *ps_=nullptr;
+  Iterator            it_;
+};
+
+/* Returned by small_table::erase([const_]iterator) to avoid iterator
+ * increment if discarded.
+ */
+
+template<typename Iterator,typename ConstIterator>
+class small_table_erase_return_type
+{
+  static constexpr bool is_const=std::is_same<Iterator,ConstIterator>::value;
+
+public:
+  /* can't delete it because VS in pre-C++17 mode needs to see it for RVO */
+  small_table_erase_return_type(const small_table_erase_return_type&);
+
+  operator Iterator()const noexcept
+  {
+    auto it=pos;
+    it.increment(); /* valid even if *it was erased */
+    return Iterator(const_iterator_cast_tag{},it);
+  }
+
+  template<
+    bool dependent_value=false,
+    typename std::enable_if<!is_const||dependent_value>::type* =nullptr
+  >
+  operator ConstIterator()const noexcept{return this->operator Iterator();}
+
+private:
+  template<typename,std::size_t,typename,typename,typename>
+  friend class small_table;
+
+  small_table_erase_return_type(const ConstIterator& pos_):pos{pos_}{}
+  small_table_erase_return_type& operator=(
+    const small_table_erase_return_type&)=delete;
+
+  ConstIterator pos;
+};
+
+/* small_table wraps a foa::table and additionally keeps up to N elements
+ * in inline storage, so that tables that never grow beyond N elements
+ * don't allocate any memory. While in this small mode, lookup is done by
+ * scanning the (at most N) elements with the equality predicate, without
+ * invoking the hash function at all. Inserting the (N+1)-th element moves
+ * the inline elements to the regular table (large mode), which is then used
+ * for the rest of the lifetime of the small_table, unless it is rehashed
+ * down to zero buckets while empty.
+ *
+ * In small mode, erasure does not move elements, so, as with the regular
+ * table, only insertion and rehashing invalidate iterators.
+ *
+ * Only flat type policies are supported.
+ */
+
+#include <boost/unordered/detail/foa/ignore_wshadow.hpp>
+
+#if defined(BOOST_MSVC)
+#pragma warning(push)
+#pragma warning(disable:4714) /* marked as __forceinline not inlined */
+#endif
+
+template<
+  typename TypePolicy,std::size_t N,
+  typename Hash,typename Pred,typename Allocator
+>
+class small_table
+{
+  using large_table=table<TypePolicy,Hash,Pred,Allocator>;
+  using type_policy=TypePolicy;
+
+public:
+  using key_type=typename large_table::key_type;
+  using init_type=typename large_table::init_type;
+  using value_type=typename large_table::value_type;
+  using element_type=typename large_table::element_type;
+
+private:
+  BOOST_UNORDERED_STATIC_ASSERT(
+    (std::is_same<element_type,value_type>::value));
+
+  using storage_type=small_table_storage<element_type,N>;
+  static constexpr bool has_mutable_iterator=
+    !std::is_same<key_type,value_type>::value;
+
+public:
+  using hasher=typename large_table::hasher;
+  using key_equal=typename large_table::key_equal;
+  using allocator_type=typename large_table::allocator_type;
+  using pointer=typename large_table::pointer;
+  using const_pointer=typename large_table::const_pointer;
+  using reference=typename large_table::reference;
+  using const_reference=typename large_table::const_reference;
+  using size_type=typename large_table::size_type;
+  using difference_type=typename large_table::difference_type;
+  using const_iterator=small_table_iterator<
+    type_policy,storage_type,typename large_table::const_iterator,true>;
+  using iterator=typename std::conditional<
+    has_mutable_iterator,
+    small_table_iterator<
+      type_policy,storage_type,typename large_table::iterator,false>,
+    const_iterator>::type;
+  using erase_return_type=
+    small_table_erase_return_type<iterator,const_iterator>;
+
+  small_table(
+    std::size_t n=default_bucket_count,const Hash& h_=Hash(),
+    const Pred& pred_=Pred(),const Allocator& al_=Allocator()):
+    t{n>N?n:0,h_,pred_,al_},small_{n<=N}
+    {}
+
+  small_table(const small_table& x):t{x.t},small_{x.small_}
+  {
+    copy_elements_from(x);
+  }
+
+  small_table(small_table&& x)
+    noexcept(
+      std::is_nothrow_move_constructible<large_table>::value&&
+      std::is_nothrow_move_constructible<init_type>::value):
+    t{std::move(x.t)},small_{x.small_}
+  {
+    move_elements_from(x);
+  }
+
+  small_table(const small_table& x,const Allocator& al_):
+    t{x.t,al_},small_{x.small_}
+  {
+    copy_elements_from(x);
+  }
+
+  small_table(small_table&& x,const Allocator& al_):
+    t{std::move(x.t),al_},small_{x.small_}
+  {
+    move_elements_from(x);
+  }
+
+  ~small_table(){destroy_elements();}
+
+  small_table& operator=(const small_table& x)
+  {
+    if(this!=&x){
+      destroy_elements();
+      t=x.t;
+      small_=x.small_;
+      copy_elements_from(x);
+    }
+    return *this;
+  }
+
+  small_table& operator=(small_table&& x)
+    noexcept(
+      noexcept(std::declval<large_table&>()=std::declval<large_table&&>())&&
+      std::is_nothrow_move_constructible<init_type>::value)
+  {
+    if(this!=&x){
+      destroy_elements();
+      t=std::move(x.t);
+      small_=x.small_;
+      move_elements_from(x);
+    }
+    return *this;
+  }
+
+  allocator_type get_allocator()const noexcept{return t.get_allocator();}
+
+  iterator begin()noexcept
+  {
+    if(small_){
+      auto p=storage.first();
+      return p?iterator{p,&storage}:end();
+    }
+    else return iterator{t.begin()};
+  }
+
+  const_iterator begin()const noexcept
+                   {return const_cast<small_table*>(this)->begin();}
+  iterator       end()noexcept{return {};}
+  const_iterator end()const noexcept{return const_cast<small_table*>(this)->end();}
+  const_iterator cbegin()const noexcept{return begin();}
+  const_iterator cend()const noexcept{return end();}
+
+  bool        empty()const noexcept{return size()==0;}
+  std::size_t size()const noexcept{return small_?storage.size():t.size();}
+  std::size_t max_size()const noexcept{return t.max_size();}
+
+  template<typename... Args>
+  BOOST_FORCEINLINE std::pair<iterator,bool> emplace(Args&&... args)
+  {
+    if(BOOST_UNLIKELY(!small_)){
+      return make_result(t.emplace(std::forward<Args>(args)...));
+    }
+    auto al_=t.get_allocator();
+    alloc_cted_insert_type<type_policy,Allocator,Args...> x(
+      al_,std::forward<Args>(args)...);
+    return emplace_impl(type_policy::move(x.value()));
+  }
+
+  /* Optimization for value_type and init_type, to avoid constructing twice */
+  template <typename T>
+  BOOST_FORCEINLINE typename std::enable_if<
+    detail::is_similar_to_any<T, value_type, init_type>::value,
+    std::pair<iterator, bool> >::type
+  emplace(T&& x)
+  {
+    return emplace_impl(std::forward<T>(x));
+  }
+
+  template<typename Key,typename... Args>
+  BOOST_FORCEINLINE std::pair<iterator,bool> try_emplace(
+    Key&& x,Args&&... args)
+  {
+    return emplace_impl(
+      try_emplace_args_t{},std::forward<Key>(x),std::forward<Args>(args)...);
+  }
+
+  BOOST_FORCEINLINE std::pair<iterator,bool>
+  insert(const init_type& x){return emplace_impl(x);}
+
+  BOOST_FORCEINLINE std::pair<iterator,bool>
+  insert(init_type&& x){return emplace_impl(std::move(x));}
+
+  /* template<typename=void> tilts call ambiguities in favor of init_type */
+
+  template<typename=void>
+  BOOST_FORCEINLINE std::pair<iterator,bool>
+  insert(const value_type& x){return emplace_impl(x);}
+
+  template<typename=void>
+  BOOST_FORCEINLINE std::pair<iterator,bool>
+  insert(value_type&& x){return emplace_impl(std::move(x));}
+
+  template<typename InputIterator>
+  void insert(InputIterator first,InputIterator last)
+  {
+    for(;small_&&first!=last;++first)this->emplace(*first);
+    if(first!=last)t.insert(first,last);
+  }
+
+  template<
+    bool dependent_value=false,
+    typename std::enable_if<
+      has_mutable_iterator||dependent_value>::type* =nullptr
+  >
+  erase_return_type erase(iterator pos)noexcept
+  {return erase(const_iterator(pos));}
+
+  BOOST_FORCEINLINE
+  erase_return_type erase(const_iterator pos)noexcept
+  {
+    if(pos.p_){
+      BOOST_ASSERT(small_);
+      erase_element(pos.p_);
+    }
+    else t.erase(pos.it_);
+    return {pos};
+  }
+
+  template<typename Key>
+  BOOST_FORCEINLINE
+  auto erase(Key&& x) -> typename std::enable_if<
+    !std::is_convertible<Key,iterator>::value&&
+    !std::is_convertible<Key,const_iterator>::value, std::size_t>::type
+  {
+    if(small_){
+      auto p=find_element(x);
+      if(p){
+        erase_element(p);
+        return 1;
+      }
+      else return 0;
+    }
+    else return t.erase(x);
+  }
+
+  void swap(small_table& x)
+    noexcept(
+      noexcept(std::declval<large_table&>().swap(
+        std::declval<large_table&>()))&&
+      std::is_nothrow_move_constructible<init_type>::value)
+  {
+    using std::swap;
+
+    if(this==&x)return;
+    t.swap(x.t);
+    swap(small_,x.small_);
+    if(!storage.mask&&!x.storage.mask)return;
+
+    /* exchange inline elements through a temporary storage */
+
+    storage_type tmp;
+    auto         al_=t.get_allocator();
+    transfer_elements(storage,tmp,al_);
+    transfer_elements(x.storage,storage,al_);
+    transfer_elements(tmp,x.storage,al_);
+  }
+
+  void clear()noexcept
+  {
+    if(small_)destroy_elements();
+    else t.clear();
+  }
+
+  template<typename Key>
+  BOOST_FORCEINLINE iterator find(const Key& x)
+  {
+    if(small_){
+      auto p=find_element(x);
+      return p?iterator{p,&storage}:end();
+    }
+    else return iterator{t.find(x)};
+  }
+
+  template<typename Key>
+  BOOST_FORCEINLINE const_iterator find(const Key& x)const
+  {
+    return const_cast<small_table*>(this)->find(x);
+  }
+
+  std::size_t capacity()const noexcept{return small_?N:t.capacity();}
+
+  float load_factor()const noexcept
+  {
+    return static_cast<float>(size())/static_cast<float>(capacity());
+  }
+
+  float max_load_factor()const noexcept{return t.max_load_factor();}
+  void  max_load_factor(float mlf){t.max_load_factor(mlf);}
+  std::size_t max_load()const noexcept{return small_?N:t.max_load();}
+
+  /* rehash(n) with n>N switches to large mode. Conversely, a large table
+   * with no elements that is rehashed to n<=N goes back to small mode.
+   */
+
+  void rehash(std::size_t n)
+  {
+    if(small_){
+      if(n>N)switch_to_large(n,0);
+    }
+    else if(n<=N&&t.empty()){
+      t.rehash(0);
+      small_=true;
+    }
+    else t.rehash(n);
+  }
+
+  void reserve(std::size_t n)
+  {
+    if(small_){
+      if(n>N)switch_to_large(0,n);
+    }
+    else if(n<=N&&t.empty()){
+      t.rehash(0);
+      small_=true;
+    }
+    else t.reserve(n);
+  }
+
+  hasher hash_function()const{return t.hash_function();}
+  key_equal key_eq()const{return t.key_eq();}
+
+  template<typename Predicate>
+  friend std::size_t erase_if(small_table& x,Predicate& pr)
+  {
+    if(x.small_){
+      std::size_t s=0;
+      for(auto p=x.storage.first();p;p=x.storage.next(p)){
+        if(pr(type_policy::value_from(*p))){
+          x.erase_element(p);
+          ++s;
+        }
+      }
+      return s;
+    }
+    else return erase_if(x.t,pr);
+  }
+
+  friend bool operator==(const small_table& x,const small_table& y)
+  {
+    if(x.size()!=y.size())return false;
+    for(const auto& v:x){
+      auto it=y.find(key_from(v));
+      if(it==y.end()||!(*it==v))return false;
+    }
+    return true;
+  }
+
+  friend bool operator!=(const small_table& x,const small_table& y)
+  {
+    return !(x==y);
+  }
+
+private:
+  template<typename T>
+  static inline auto key_from(const T& x)
+    ->decltype(type_policy::extract(x))
+  {
+    return type_policy::extract(x);
+  }
+
+  template<typename Key,typename... Args>
+  static inline const Key& key_from(
+    try_emplace_args_t,const Key& x,const Args&...)
+  {
+    return x;
+  }
+
+  template<typename Key>
+  BOOST_FORCEINLINE element_type* find_element(const Key& x)const
+  {
+    auto pred_=t.key_eq();
+    for(auto mask=storage.mask;mask;mask&=mask-1){
+      auto p=storage.element(unchecked_countr_zero(mask));
+      if(BOOST_LIKELY(bool(pred_(x,key_from(*p)))))return p;
+    }
+    return nullptr;
+  }
+
+  template<typename... Args>
+  BOOST_FORCEINLINE std::pair<iterator,bool> emplace_impl(Args&&... args)
+  {
+    if(BOOST_UNLIKELY(!small_)){
+      return emplace_large(std::forward<Args>(args)...);
+    }
+
+    const auto &k=key_from(std::forward<Args>(args)...);
+    if(auto p=find_element(k))return {iterator{p,&storage},false};
+    if(BOOST_LIKELY(!storage.full())){
+      auto n=unchecked_countr_zero(~storage.mask);
+      auto p=storage.element(n);
+      auto al_=t.get_allocator();
+      construct_element(al_,p,std::forward<Args>(args)...);
+      storage.mask|=boost::uint64_t(1)<<n;
+      return {iterator{p,&storage},true};
+    }
+    else{
+      switch_to_large(0,N+1);
+      return emplace_large(std::forward<Args>(args)...);
+    }
+  }
+
+  template<typename Key,typename... Args>
+  std::pair<iterator,bool> emplace_large(
+    try_emplace_args_t,Key&& x,Args&&... args)
+  {
+    return make_result(
+      t.try_emplace(std::forward<Key>(x),std::forward<Args>(args)...));
+  }
+
+  template<typename Value>
+  std::pair<iterator,bool> emplace_large(Value&& x)
+  {
+    return make_result(t.emplace(std::forward<Value>(x)));
+  }
+
+  template<typename LargeIterator>
+  static std::pair<iterator,bool> make_result(
+    const std::pair<LargeIterator,bool>& x)
+  {
+    return {iterator{x.first},x.second};
+  }
+
+  template<typename A,typename... Args>
+  static void construct_element(A& al_,element_type* p,Args&&... args)
+  {
+    type_policy::construct(al_,p,std::forward<Args>(args)...);
+  }
+
+  template<typename A,typename... Args>
+  static void construct_element(
+    A& al_,element_type* p,try_emplace_args_t,Args&&... args)
+  {
+    construct_element_from_try_emplace_args(
+      al_,p,
+      std::integral_constant<bool,std::is_same<key_type,value_type>::value>{},
+      std::forward<Args>(args)...);
+  }
+
+  template<typename A,typename Key,typename... Args>
+  static void construct_element_from_try_emplace_args(
+    A& al_,element_type* p,std::false_type,Key&& x,Args&&... args)
+  {
+    type_policy::construct(
+      al_,p,
+      std::piecewise_construct,
+      std::forward_as_tuple(std::forward<Key>(x)),
+      std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+
+  template<typename A,typename Key>
+  static void construct_element_from_try_emplace_args(
+    A& al_,element_type* p,std::true_type,Key&& x)
+  {
+    type_policy::construct(al_,p,std::forward<Key>(x));
+  }
+
+  void destroy_element(element_type* p)noexcept
+  {
+    auto al_=t.get_allocator();
+    type_policy::destroy(al_,p);
+  }
+
+  void erase_element(element_type* p)noexcept
+  {
+    destroy_element(p);
+    storage.mask&=~(boost::uint64_t(1)<<(p-storage.elements));
+  }
+
+  void destroy_elements()noexcept
+  {
+    for(auto p=storage.first();p;p=storage.next(p))destroy_element(p);
+    storage.mask=0;
+  }
+
+  /* Move elements from one storage to another (empty) one; move
+   * construction is assumed not to throw for the strong guarantee.
+   */
+
+  template<typename A>
+  static void transfer_elements(storage_type& from,storage_type& to,A& al_)
+  {
+    for(auto p=from.first();p;p=from.next(p)){
+      auto n=static_cast<std::size_t>(p-from.elements);
+      type_policy::construct(al_,to.element(n),type_policy::move(*p));
+      to.mask|=boost::uint64_t(1)<<n;
+      type_policy::destroy(al_,p);
+      from.mask&=~(boost::uint64_t(1)<<n);
+    }
+  }
+
+  void copy_elements_from(const small_table& x)
+  {
+    auto al_=t.get_allocator();
+    for(auto p=x.storage.first();p;p=x.storage.next(p)){
+      auto n=static_cast<std::size_t>(p-x.storage.elements);
+      BOOST_TRY{
+        type_policy::construct(al_,storage.element(n),*p);
+      }
+      BOOST_CATCH(...){
+        destroy_elements();
+        BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+      storage.mask|=boost::uint64_t(1)<<n;
+    }
+  }
+
+  void move_elements_from(small_table& x)
+  {
+    auto al_=t.get_allocator();
+    BOOST_TRY{
+      transfer_elements(x.storage,storage,al_);
+    }
+    BOOST_CATCH(...){
+      destroy_elements();
+      BOOST_RETHROW
+    }
+    BOOST_CATCH_END
+    x.destroy_elements();
+    x.small_=x.t.empty();
+  }
+
+  /* Moves the inline elements to the regular table, which is previously
+   * rehashed to n buckets or reserved for m elements. Strong exception
+   * guarantee: if moving can throw, elements are copied and only destroyed
+   * when all of them have been transferred; otherwise, elements moved
+   * before an exception (thrown by the hash function or the equality
+   * predicate) are moved back to inline storage.
+   */
+
+  BOOST_NOINLINE void switch_to_large(std::size_t n,std::size_t m)
+  {
+    BOOST_ASSERT(small_&&t.empty());
+
+    auto size_=storage.size();
+    if(n)t.rehash(n);
+    t.reserve(m>size_?m:size_);
+    switch_to_large(
+      std::integral_constant<
+        bool,
+        std::is_nothrow_move_constructible<init_type>::value
+      >{});
+    small_=false;
+  }
+
+  void switch_to_large(std::true_type /* move */)
+  {
+    auto al_=t.get_allocator();
+    BOOST_TRY{
+      for(auto p=storage.first();p;p=storage.next(p)){
+        transfer_element_to_large(*p);
+        type_policy::destroy(al_,p);
+        storage.mask&=~(boost::uint64_t(1)<<(p-storage.elements));
+      }
+    }
+    BOOST_CATCH(...){
+      for(auto& x:t){
+        auto n=unchecked_countr_zero(~storage.mask);
+        type_policy::construct(
+          al_,storage.element(n),
+          type_policy::move(const_cast<element_type&>(x)));
+        storage.mask|=boost::uint64_t(1)<<n;
+      }
+      t.clear();
+      BOOST_RETHROW
+    }
+    BOOST_CATCH_END
+  }
+
+  void switch_to_large(std::false_type /* copy */)
+  {
+    BOOST_TRY{
+      for(auto p=storage.first();p;p=storage.next(p)){
+        t.insert(const_cast<const element_type&>(*p));
+      }
+    }
+    BOOST_CATCH(...){
+      t.clear();
+      BOOST_RETHROW
+    }
+    BOOST_CATCH_END
+    destroy_elements();
+  }
+
+  /* try_emplace so that elements are not moved from before the hash
+   * function and the equality predicate are called.
+   */
+
+  void transfer_element_to_large(element_type& x)
+  {
+    transfer_element_to_large(
+      type_policy::move(x),
+      std::integral_constant<bool,std::is_same<key_type,value_type>::value>{});
+  }
+
+  template<typename MovedType>
+  void transfer_element_to_large(MovedType&& x,std::false_type /* map */)
+  {
+    t.try_emplace(std::move(x.first),std::move(x.second));
+  }
+
+  template<typename MovedType>
+  void transfer_element_to_large(MovedType&& x,std::true_type /* set */)
+  {
+    t.try_emplace(std::forward<MovedType>(x));
+  }
+
+  large_table  t;
+  bool         small_;
+  storage_type storage;
+};
+
+#if defined(BOOST_MSVC)
+#pragma warning(pop) /* C4714 */
+#endif
+
+#include <boost/unordered/detail/foa/restore_wshadow.hpp>
+
+} /* namespace foa */
+} /* namespace detail */
+} /* namespace unordered */
+} /* namespace boost */
+
+#endif
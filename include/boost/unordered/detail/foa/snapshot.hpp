@@ -0,0 +1,417 @@
+/* Memory-mappable snapshots of flat open-addressing tables.
+ *
+ * Copyright 2026 agent.
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See https://www.boost.org/libs/unordered for library home page.
+ */
+
+#ifndef BOOST_UNORDERED_DETAIL_FOA_SNAPSHOT_HPP
+#define BOOST_UNORDERED_DETAIL_FOA_SNAPSHOT_HPP
+
+#include <boost/config.hpp>
+#include <boost/core/empty_value.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/unordered/detail/foa/table.hpp>
+#include <boost/unordered/detail/static_assert.hpp>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace boost{
+namespace unordered{
+namespace detail{
+namespace foa{
+
+/* Snapshot image layout:
+ *
+ *   - snapshot_header, padded to snapshot_alignment.
+ *   - The groups array (groups_size_mask+1 groups, the last one holding the
+ *     sentinel) at groups_offset.
+ *   - The elements array (one slot per group position save for the sentinel,
+ *     unoccupied slots zeroed) at elements_offset.
+ *
+ * Both arrays are aligned to snapshot_alignment from the start of the image,
+ * and are exactly as they'd be found in the memory of the table, so an image
+ * loaded (or mapped) at a suitably aligned address can be queried in place.
+ * Besides a format version, the header records every setting the bit-level
+ * layout depends on (byte order, sizeof(std::size_t), group type and SIMD
+ * flavor, size policy, element size and alignment) so that an incompatible
+ * image is rejected rather than misread. As the hash function can't be
+ * identified by its type alone, hash_check combines the hash values of the
+ * first elements of the image: a view whose hash function does not reproduce
+ * them rejects the image as well.
+ */
+
+struct snapshot_header
+{
+  unsigned char   magic[8];
+  boost::uint32_t version;
+  boost::uint32_t byte_order;
+  boost::uint32_t layout;
+  boost::uint32_t size_t_size;
+  boost::uint32_t group_size;
+  boost::uint32_t element_size;
+  boost::uint32_t element_alignment;
+  boost::uint32_t reserved;
+  boost::uint64_t groups_size_index;
+  boost::uint64_t groups_size_mask;
+  boost::uint64_t size;
+  boost::uint64_t hash_check;
+  boost::uint64_t groups_offset;
+  boost::uint64_t elements_offset;
+  boost::uint64_t image_size;
+};
+
+static constexpr std::size_t     snapshot_alignment=64;
+static constexpr boost::uint32_t snapshot_version=1;
+static constexpr boost::uint32_t snapshot_byte_order=0x01020304u;
+static constexpr std::size_t     snapshot_hash_check_size=16; /* elements */
+
+static constexpr std::size_t snapshot_header_size=
+  (sizeof(snapshot_header)+snapshot_alignment-1)/
+  snapshot_alignment*snapshot_alignment;
+
+static constexpr boost::uint32_t snapshot_layout=arrays_layout;
+
+inline void set_snapshot_magic(unsigned char* p)
+{
+  std::memcpy(p,"BOOSTFOA",8);
+}
+
+inline bool check_snapshot_magic(const unsigned char* p)
+{
+  return std::memcmp(p,"BOOSTFOA",8)==0;
+}
+
+BOOST_NOINLINE BOOST_NORETURN inline void throw_bad_snapshot(
+  char const* message)
+{
+  boost::throw_exception(std::invalid_argument(message));
+}
+
+inline std::size_t snapshot_round_up(std::size_t n)
+{
+  return (n+snapshot_alignment-1)/snapshot_alignment*snapshot_alignment;
+}
+
+/* Operations on the arrays of a flat table_core with the given type policy
+ * and hash function, shared by snapshot writing and flat_view.
+ */
+
+template<typename TypePolicy,typename Hash>
+struct snapshot_traits
+{
+  using core=table_core_impl<
+    TypePolicy,Hash,std::equal_to<typename TypePolicy::key_type>,
+    std::allocator<typename TypePolicy::value_type>>;
+  using type_policy=TypePolicy;
+  using group_type=typename core::group_type;
+  static constexpr auto N=core::N;
+  using element_type=typename core::element_type;
+  using mix_policy=typename core::mix_policy;
+  using stored_hash_policy_type=typename core::stored_hash_policy_type;
+
+  BOOST_UNORDERED_STATIC_ASSERT(sizeof(group_type)<=snapshot_alignment);
+  BOOST_UNORDERED_STATIC_ASSERT(alignof(element_type)<=snapshot_alignment);
+
+  template<typename Key>
+  static std::size_t hash_for(const Hash& h,const Key& x)
+  {
+    return stored_hash_policy_type::canonical(mix_policy::mix(h,x));
+  }
+
+  /* invokes f(p) for the occupied slots of the groups in [pg,last) while f
+   * returns true
+   */
+
+  template<typename F>
+  static void for_all_elements_while(
+    group_type* pg,group_type* last,const element_type* p,F f)
+  {
+    for(;pg!=last;++pg,p+=N){
+      auto mask=core::match_really_occupied(pg,last);
+      while(mask){
+        if(!f(p+unchecked_countr_zero(mask)))return;
+        mask&=mask-1;
+      }
+    }
+  }
+
+  static boost::uint64_t hash_check(
+    const Hash& h,group_type* pg,group_type* last,const element_type* p)
+  {
+    boost::uint64_t res=0;
+    std::size_t     n=0;
+    for_all_elements_while(pg,last,p,[&](const element_type* q){
+      res=res*0x9E3779B97F4A7C15ull+
+        static_cast<boost::uint64_t>(hash_for(h,type_policy::extract(*q)));
+      return ++n<snapshot_hash_check_size;
+    });
+    return res;
+  }
+};
+
+template<typename TypePolicy,typename Hash,typename Pred,typename Allocator>
+void write_snapshot(
+  std::ostream& os,const table<TypePolicy,Hash,Pred,Allocator>& x)
+{
+  using traits=snapshot_traits<TypePolicy,Hash>;
+  using group_type=typename traits::group_type;
+  using element_type=typename traits::element_type;
+  static constexpr auto N=traits::N;
+
+  static const char zeros[snapshot_alignment]={};
+  auto write=[&os](const void* p,std::size_t n){
+    os.write(static_cast<const char*>(p),static_cast<std::streamsize>(n));
+  };
+
+  if(x.migrating()){
+    /* incremental rehash in progress: the copy has all elements in place */
+    write_snapshot(os,table<TypePolicy,Hash,Pred,Allocator>(x));
+    return;
+  }
+  const auto& arrays=x.get_arrays();
+
+  snapshot_header hd;
+  std::memset(&hd,0,sizeof(hd));
+  set_snapshot_magic(hd.magic);
+  hd.version=snapshot_version;
+  hd.byte_order=snapshot_byte_order;
+  hd.layout=snapshot_layout;
+  hd.size_t_size=sizeof(std::size_t);
+  hd.group_size=sizeof(group_type);
+  hd.element_size=sizeof(element_type);
+  hd.element_alignment=alignof(element_type);
+  hd.size=x.size();
+  hd.image_size=snapshot_header_size;
+
+  std::size_t num_groups=0;
+  if(arrays.elements()){
+    num_groups=arrays.groups_size_mask+1;
+    hd.groups_size_index=arrays.groups_size_index;
+    hd.groups_size_mask=arrays.groups_size_mask;
+    hd.hash_check=traits::hash_check(
+      x.hash_function(),arrays.groups(),arrays.groups()+num_groups,
+      arrays.elements());
+    hd.groups_offset=snapshot_header_size;
+    hd.elements_offset=snapshot_round_up(
+      snapshot_header_size+num_groups*sizeof(group_type));
+    hd.image_size=
+      hd.elements_offset+(num_groups*N-1)*sizeof(element_type);
+  }
+
+  write(&hd,sizeof(hd));
+  write(zeros,snapshot_header_size-sizeof(hd));
+  if(!num_groups)return;
+
+  write(arrays.groups(),num_groups*sizeof(group_type));
+  write(
+    zeros,
+    static_cast<std::size_t>(hd.elements_offset)-
+    snapshot_header_size-num_groups*sizeof(group_type));
+
+  /* elements are written group by group, with unoccupied slots zeroed */
+
+  std::vector<unsigned char> buf(N*sizeof(element_type));
+  auto                       pg=arrays.groups();
+  auto                       last=pg+num_groups;
+  auto                       p=arrays.elements();
+  for(;pg!=last;++pg,p+=N){
+    std::memset(buf.data(),0,buf.size());
+    auto mask=traits::core::match_really_occupied(pg,last);
+    while(mask){
+      auto n=unchecked_countr_zero(mask);
+      std::memcpy(
+        buf.data()+n*sizeof(element_type),
+        static_cast<const void*>(p+n),sizeof(element_type));
+      mask&=mask-1;
+    }
+    write(buf.data(),(pg==last-1?N-1:N)*sizeof(element_type));
+  }
+}
+
+/* Read-only table over a snapshot image, with lookup and iteration as in
+ * foa::table.
+ */
+
+template<typename TypePolicy,typename Hash,typename Pred>
+class flat_view:empty_value<Hash,0>,empty_value<Pred,1>
+{
+  using hash_base=empty_value<Hash,0>;
+  using pred_base=empty_value<Pred,1>;
+  using traits=snapshot_traits<TypePolicy,Hash>;
+  using type_policy=TypePolicy;
+  using group_type=typename traits::group_type;
+  static constexpr auto N=traits::N;
+  using prober=typename traits::core::prober;
+  using size_policy=typename traits::core::size_policy;
+  using element_type=typename traits::element_type;
+
+public:
+  using key_type=typename type_policy::key_type;
+  using value_type=typename type_policy::value_type;
+  using hasher=Hash;
+  using key_equal=Pred;
+  using size_type=std::size_t;
+  using const_iterator=table_iterator<type_policy,group_type*,true>;
+
+  flat_view(
+    const void* data,std::size_t n,const Hash& h_,const Pred& pred_):
+    hash_base{empty_init,h_},pred_base{empty_init,pred_}
+  {
+    auto p=static_cast<const unsigned char*>(data);
+    if(n<snapshot_header_size)throw_bad_snapshot("snapshot too short");
+    if(reinterpret_cast<std::uintptr_t>(p)%snapshot_alignment){
+      throw_bad_snapshot("snapshot not properly aligned");
+    }
+
+    snapshot_header hd;
+    std::memcpy(&hd,p,sizeof(hd));
+    if(!check_snapshot_magic(hd.magic))throw_bad_snapshot("not a snapshot");
+    if(hd.version!=snapshot_version){
+      throw_bad_snapshot("unsupported snapshot version");
+    }
+    if(hd.byte_order!=snapshot_byte_order||
+       hd.layout!=snapshot_layout||
+       hd.size_t_size!=sizeof(std::size_t)||
+       hd.group_size!=sizeof(group_type)||
+       hd.element_size!=sizeof(element_type)||
+       hd.element_alignment!=alignof(element_type)){
+      throw_bad_snapshot("incompatible snapshot layout");
+    }
+    if(hd.image_size>n)throw_bad_snapshot("snapshot too short");
+
+    if(!hd.groups_offset){ /* no arrays */
+      if(hd.size)throw_bad_snapshot("corrupt snapshot");
+      return;
+    }
+
+    /* Header fields are untrusted: all the arithmetic below is bounded by n
+     * so that it can't overflow, and the size index is checked against the
+     * one the size policy would pick for the capacity rather than fed
+     * directly to size_policy::size (which may not be defined for it).
+     */
+
+    if(hd.groups_offset!=snapshot_header_size||
+       hd.groups_size_mask>=
+         (n-snapshot_header_size)/sizeof(group_type)||
+       hd.elements_offset>hd.image_size){
+      throw_bad_snapshot("corrupt snapshot");
+    }
+    auto num_groups=static_cast<std::size_t>(hd.groups_size_mask)+1;
+    auto groups_end=snapshot_header_size+num_groups*sizeof(group_type);
+    auto elements_bytes=
+      static_cast<std::size_t>(hd.image_size-hd.elements_offset);
+    if(num_groups>(std::numeric_limits<std::size_t>::max)()/N||
+       hd.elements_offset%snapshot_alignment||
+       hd.elements_offset<groups_end||
+       hd.elements_offset-groups_end>=snapshot_alignment||
+       elements_bytes%sizeof(element_type)||
+       elements_bytes/sizeof(element_type)!=num_groups*N-1||
+       hd.size>num_groups*N-1||
+       hd.groups_size_index!=
+         size_index_for<group_type,size_policy>(num_groups*N-1)||
+       size_policy::size(static_cast<std::size_t>(hd.groups_size_index))!=
+         num_groups){
+      throw_bad_snapshot("corrupt snapshot");
+    }
+
+    groups_size_index=static_cast<std::size_t>(hd.groups_size_index);
+    groups_size_mask=static_cast<std::size_t>(hd.groups_size_mask);
+    groups_=reinterpret_cast<group_type*>(
+      const_cast<unsigned char*>(p+hd.groups_offset));
+    elements_=reinterpret_cast<const element_type*>(p+hd.elements_offset);
+    if(!groups_[groups_size_mask].is_sentinel(N-1)){
+      throw_bad_snapshot("corrupt snapshot");
+    }
+    size_=static_cast<std::size_t>(hd.size);
+    if(traits::hash_check(h(),groups_,groups_+num_groups,elements_)!=
+       hd.hash_check){
+      throw_bad_snapshot("snapshot hash function mismatch");
+    }
+  }
+
+  const_iterator begin()const noexcept
+  {
+    const_iterator it{groups_,0,elements_};
+    if(elements_&&!(groups_[0].match_occupied()&0x1))++it;
+    return it;
+  }
+
+  const_iterator end()const noexcept{return {};}
+
+  bool        empty()const noexcept{return size_==0;}
+  std::size_t size()const noexcept{return size_;}
+
+  std::size_t capacity()const noexcept
+  {
+    return elements_?(groups_size_mask+1)*N-1:0;
+  }
+
+  hasher    hash_function()const{return h();}
+  key_equal key_eq()const{return pred();}
+
+#if defined(BOOST_MSVC)
+/* warning: forcing value to bool 'true' or 'false' in bool(pred()...) */
+#pragma warning(push)
+#pragma warning(disable:4800)
+#endif
+
+  template<typename Key>
+  BOOST_FORCEINLINE const_iterator find(const Key& x)const
+  {
+    if(!elements_)return end();
+
+    auto   hash=traits::hash_for(h(),x);
+    prober pb(size_policy::position(hash,groups_size_index));
+    do{
+      auto pos=pb.get();
+      auto pg=groups_+pos;
+      auto mask=pg->match(hash);
+      if(mask){
+        auto p=elements_+pos*N;
+        BOOST_UNORDERED_PREFETCH_ELEMENTS(p,N);
+        do{
+          auto n=unchecked_countr_zero(mask);
+          if(BOOST_LIKELY(bool(pred()(x,type_policy::extract(p[n]))))){
+            return {pg,n,p+n};
+          }
+          mask&=mask-1;
+        }while(mask);
+      }
+      if(BOOST_LIKELY(pg->is_not_overflowed(hash)))return end();
+    }
+    while(BOOST_LIKELY(pb.next(groups_size_mask)));
+    return end();
+  }
+
+#if defined(BOOST_MSVC)
+#pragma warning(pop) /* C4800 */
+#endif
+
+private:
+  const Hash& h()const{return hash_base::get();}
+  const Pred& pred()const{return pred_base::get();}
+
+  std::size_t         groups_size_index=0;
+  std::size_t         groups_size_mask=0;
+  group_type*         groups_=nullptr;
+  const element_type* elements_=nullptr;
+  std::size_t         size_=0;
+};
+
+} /* namespace foa */
+} /* namespace detail */
+} /* namespace unordered */
+} /* namespace boost */
+
+#endif
@@ -0,0 +1,318 @@
+/* Fixed-size hash table built at compile time with a perfect hash function.
+ *
+ * Copyright 2026 agent.
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See https://www.boost.org/libs/unordered for library home page.
+ */
+
+#ifndef BOOST_UNORDERED_DETAIL_FOA_STATIC_TABLE_HPP
+#define BOOST_UNORDERED_DETAIL_FOA_STATIC_TABLE_HPP
+
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/mp11/integer_sequence.hpp>
+#include <boost/unordered/detail/static_assert.hpp>
+#include <boost/unordered/detail/throw_exception.hpp>
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+namespace boost{
+namespace unordered{
+namespace detail{
+namespace foa{
+
+/* static_table holds a fixed number N of elements known at compile time
+ * (typically, the entries of a dispatch table), and can be constructed in
+ * a constant expression from an initializer list of exactly N elements.
+ * Rather than probing a group array with SIMD metadata, which cannot be
+ * built in a constant expression, static_table searches for a perfect hash
+ * function over its elements on construction, along the lines of the
+ * hash-and-displace scheme (Belazzougui, Botelho, Dietzfelbinger,
+ * "Hash, displace, and compress", 2009):
+ *
+ *   - Elements are kept in a plain array in their original order.
+ *   - The mixed hash value of each key selects one out of B buckets.
+ *   - Buckets are processed in decreasing order of size: each is assigned
+ *     the first seed d such that mulx(hash,C+2d) maps all of its keys to
+ *     distinct, previously unused positions of a slot array of size
+ *     M=2^n>=2N, which are then set to the indices of the elements.
+ *
+ * Lookup is then branchless up to the final key comparison: one hash
+ * computation, two multiplications, three array accesses. With B~N/4
+ * buckets and a load factor of at most 0.5, seeds are found after a few
+ * attempts.
+ *
+ * Duplicate keys and distinct keys with equal hash values make construction
+ * fail with std::invalid_argument, which is reported as a compile-time
+ * error when construction happens in a constant expression.
+ */
+
+#if defined(__SIZEOF_INT128__)
+#if defined(__GNUC__)
+__extension__ typedef unsigned __int128 static_table_uint128;
+#else
+typedef unsigned __int128 static_table_uint128;
+#endif
+
+constexpr inline boost::uint64_t static_mulx64(
+  boost::uint64_t x,boost::uint64_t y)
+{
+  return (boost::uint64_t)((static_table_uint128)x*y)^
+         (boost::uint64_t)(((static_table_uint128)x*y)>>64);
+}
+#else
+BOOST_CXX14_CONSTEXPR inline boost::uint64_t static_mulx64(
+  boost::uint64_t x,boost::uint64_t y)
+{
+  /* same as detail::mulx64 portable implementation */
+
+  boost::uint64_t x1=(boost::uint32_t)x;
+  boost::uint64_t x2=x>>32;
+  boost::uint64_t y1=(boost::uint32_t)y;
+  boost::uint64_t y2=y>>32;
+  boost::uint64_t r3=x2*y2;
+  boost::uint64_t r2a=x1*y2;
+  r3+=r2a>>32;
+  boost::uint64_t r2b=x2*y1;
+  r3+=r2b>>32;
+  boost::uint64_t r1=x1*y1;
+  boost::uint64_t r2=(r1>>32)+(boost::uint32_t)r2a+(boost::uint32_t)r2b;
+  r1=(r2<<32)+(boost::uint32_t)r1;
+  r3+=r2>>32;
+  return r1^r3;
+}
+#endif
+
+constexpr std::size_t static_table_pow2_ceil(std::size_t n,std::size_t p=1)
+{
+  return p>=n?p:static_table_pow2_ceil(n,p*2);
+}
+
+constexpr std::size_t static_table_log2(std::size_t n)
+{
+  return n<=1?0:1+static_table_log2(n/2);
+}
+
+template<typename Key,typename T>
+struct static_map_types
+{
+  using key_type=Key;
+  using value_type=std::pair<const Key,T>;
+
+  static constexpr const Key& extract(const value_type& x){return x.first;}
+};
+
+template<typename Key>
+struct static_set_types
+{
+  using key_type=Key;
+  using value_type=Key;
+
+  static constexpr const Key& extract(const value_type& x){return x;}
+};
+
+template<typename TypePolicy,std::size_t N,typename Hash,typename Pred>
+class static_table
+{
+  BOOST_UNORDERED_STATIC_ASSERT(N>0);
+
+  using type_policy=TypePolicy;
+
+public:
+  using key_type=typename type_policy::key_type;
+  using value_type=typename type_policy::value_type;
+  using hasher=Hash;
+  using key_equal=Pred;
+  using const_iterator=const value_type*;
+
+  static constexpr std::size_t num_slots=static_table_pow2_ceil(2*N);
+  static constexpr std::size_t num_buckets=static_table_pow2_ceil((N+3)/4);
+
+  BOOST_CXX14_CONSTEXPR static_table(
+    std::initializer_list<value_type> il,
+    const Hash& h_=Hash(),const Pred& pred_=Pred()):
+    static_table{
+      checked_begin(il),boost::mp11::make_index_sequence<N>{},h_,pred_}
+  {}
+
+  constexpr const_iterator begin()const noexcept{return elements;}
+  constexpr const_iterator end()const noexcept{return elements+N;}
+  constexpr std::size_t    size()const noexcept{return N;}
+  constexpr std::size_t    capacity()const noexcept{return num_slots;}
+
+  constexpr const Hash& hash_function()const noexcept{return h;}
+  constexpr const Pred& key_eq()const noexcept{return pred;}
+
+  template<typename Key>
+  BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR const_iterator find(
+    const Key& x)const
+  {
+    boost::uint64_t hash=hash_for(x);
+    std::size_t     n=slots[slot_for(hash,seeds[bucket_for(hash)])];
+    return pred(x,type_policy::extract(elements[n]))?elements+n:elements+N;
+  }
+
+  friend BOOST_CXX14_CONSTEXPR bool operator==(
+    const static_table& x,const static_table& y)
+  {
+    for(const value_type& e:x){
+      const_iterator it=y.find(type_policy::extract(e));
+      if(it==y.end()||!(*it==e))return false;
+    }
+    return true;
+  }
+
+private:
+  using index_type=typename std::conditional<
+    (N<=0xFFu),boost::uint8_t,
+    typename std::conditional<
+      (N<=0xFFFFu),boost::uint16_t,boost::uint32_t
+    >::type
+  >::type;
+
+  static constexpr std::size_t slot_shift=64-static_table_log2(num_slots);
+  static constexpr std::size_t bucket_shift=
+    63-static_table_log2(num_buckets);
+  static constexpr boost::uint64_t seed_multiplier=0x9E3779B97F4A7C15ull;
+
+  static BOOST_CXX14_CONSTEXPR const value_type* checked_begin(
+    std::initializer_list<value_type> il)
+  {
+    return il.size()==N?il.begin():
+      (boost::unordered::detail::throw_invalid_argument(
+        "initializer list size does not match the number of elements"),
+      il.begin());
+  }
+
+  template<std::size_t... I>
+  BOOST_CXX14_CONSTEXPR static_table(
+    const value_type* first,boost::mp11::index_sequence<I...>,
+    const Hash& h_,const Pred& pred_):
+    elements{first[I]...},h(h_),pred(pred_)
+  {
+    build();
+  }
+
+  template<typename Key>
+  BOOST_CXX14_CONSTEXPR boost::uint64_t hash_for(const Key& x)const
+  {
+    return static_mulx64(
+      static_cast<boost::uint64_t>(h(x)),seed_multiplier);
+  }
+
+  static BOOST_CXX14_CONSTEXPR std::size_t bucket_for(boost::uint64_t hash)
+  {
+    /* two shifts so that num_buckets==1 does not shift by 64 */
+
+    return static_cast<std::size_t>((hash>>1)>>bucket_shift);
+  }
+
+  static BOOST_CXX14_CONSTEXPR std::size_t slot_for(
+    boost::uint64_t hash,boost::uint32_t seed)
+  {
+    return static_cast<std::size_t>(
+      static_mulx64(hash,seed_multiplier+2*(boost::uint64_t)seed)>>
+      slot_shift);
+  }
+
+  BOOST_CXX14_CONSTEXPR void build()
+  {
+    boost::uint64_t hashes[N]={};
+    std::size_t     bucket_first[num_buckets+1]={},
+                    bucket_members[N]={},
+                    size_first[N+2]={},
+                    bucket_order[num_buckets]={},
+                    candidate_slots[N]={};
+    bool            used[num_slots]={};
+
+    /* group element indices by bucket */
+
+    for(std::size_t i=0;i<N;++i){
+      hashes[i]=hash_for(type_policy::extract(elements[i]));
+      ++bucket_first[bucket_for(hashes[i])+1];
+    }
+    for(std::size_t b=0;b<num_buckets;++b){
+      bucket_first[b+1]+=bucket_first[b];
+    }
+    {
+      std::size_t pos[num_buckets]={};
+      for(std::size_t b=0;b<num_buckets;++b)pos[b]=bucket_first[b];
+      for(std::size_t i=0;i<N;++i){
+        bucket_members[pos[bucket_for(hashes[i])]++]=i;
+      }
+    }
+
+    /* sort buckets by decreasing size */
+
+    for(std::size_t b=0;b<num_buckets;++b){
+      ++size_first[N-(bucket_first[b+1]-bucket_first[b])+1];
+    }
+    for(std::size_t s=0;s<=N;++s)size_first[s+1]+=size_first[s];
+    for(std::size_t b=0;b<num_buckets;++b){
+      bucket_order[size_first[N-(bucket_first[b+1]-bucket_first[b])]++]=b;
+    }
+
+    for(std::size_t k=0;k<num_buckets;++k){
+      std::size_t b=bucket_order[k],
+                  first=bucket_first[b],
+                  last=bucket_first[b+1];
+      if(first==last)break; /* remaining buckets are empty */
+
+      for(std::size_t i=first;i<last;++i){
+        for(std::size_t j=first;j<i;++j){
+          std::size_t m=bucket_members[i],n=bucket_members[j];
+          if(hashes[m]!=hashes[n])continue;
+          if(pred(
+            type_policy::extract(elements[m]),
+            type_policy::extract(elements[n]))){
+            boost::unordered::detail::throw_invalid_argument(
+              "duplicate key");
+          }
+          boost::unordered::detail::throw_invalid_argument(
+            "distinct keys with equal hash values");
+        }
+      }
+
+      for(boost::uint32_t seed=0;;++seed){
+        std::size_t i=first;
+        for(;i<last;++i){
+          std::size_t s=slot_for(hashes[bucket_members[i]],seed);
+          if(used[s])break;
+          used[s]=true;
+          candidate_slots[i]=s;
+        }
+        if(i==last){
+          seeds[b]=seed;
+          for(i=first;i<last;++i){
+            slots[candidate_slots[i]]=
+              static_cast<index_type>(bucket_members[i]);
+          }
+          break;
+        }
+        while(i-->first)used[candidate_slots[i]]=false;
+        if(seed==~boost::uint32_t(0)){
+          boost::unordered::detail::throw_invalid_argument(
+            "no perfect hash function found");
+        }
+      }
+    }
+  }
+
+  value_type      elements[N];
+  Hash            h;
+  Pred            pred;
+  index_type      slots[num_slots]={};
+  boost::uint32_t seeds[num_buckets]={};
+};
+
+} /* namespace foa */
+} /* namespace detail */
+} /* namespace unordered */
+} /* namespace boost */
+
+#endif
@@ -78,12 +78,17 @@ class table;
  * addresses rather than pointers).
  * 
  * p = nullptr is conventionally used to mark end() iterators.
+ *
+ * When Linked is true, the arrays traversed are those of table_arrays, past
+ * whose groups array lies a pointer to an arrays_link: on reaching the
+ * sentinel, iteration continues into the arrays linked, if any. foa::table uses this
+ * to traverse both its old and new arrays while incrementally rehashing.
  */
 
 /* internal conversion from const_iterator to iterator */
 struct const_iterator_cast_tag{}; 
 
-template<typename TypePolicy,typename GroupPtr,bool Const>
+template<typename TypePolicy,typename GroupPtr,bool Const,bool Linked=false>
 class table_iterator
 {
   using group_pointer_traits=boost::pointer_traits<GroupPtr>;
@@ -94,6 +99,7 @@ class table_iterator
     typename group_pointer_traits::template rebind<table_element_type>;
   using char_pointer=
     typename group_pointer_traits::template rebind<unsigned char>;
+  using link_type=arrays_link<group_type,table_element_type>;
   static constexpr auto N=group_type::N;
   static constexpr auto regular_layout=group_type::regular_layout;
 
@@ -110,10 +116,11 @@ public:
 
   table_iterator():pc_{nullptr},p_{nullptr}{};
   template<bool Const2,typename std::enable_if<!Const2>::type* =nullptr>
-  table_iterator(const table_iterator<TypePolicy,GroupPtr,Const2>& x):
+  table_iterator(const table_iterator<TypePolicy,GroupPtr,Const2,Linked>& x):
     pc_{x.pc_},p_{x.p_}{}
   table_iterator(
-    const_iterator_cast_tag, const table_iterator<TypePolicy,GroupPtr,true>& x):
+    const_iterator_cast_tag,
+    const table_iterator<TypePolicy,GroupPtr,true,Linked>& x):
     pc_{x.pc_},p_{x.p_}{}
 
   inline reference operator*()const noexcept
@@ -131,9 +138,11 @@ public:
     {return !(x==y);}
 
 private:
-  template<typename,typename,bool> friend class table_iterator;
+  template<typename,typename,bool,bool> friend class table_iterator;
   template<typename> friend class table_erase_return_type;
   template<typename,typename,typename,typename> friend class table;
+  template<typename,typename,typename> friend class flat_view;
+  template<typename,typename,typename,typename> friend class frozen_table;
 
   table_iterator(group_type* pg,std::size_t n,const table_element_type* ptet):
     pc_{to_pointer<char_pointer>(
@@ -163,16 +172,18 @@ private:
       }
       ++pc_;
       if(!group_type::is_occupied(pc()))continue;
-      if(BOOST_UNLIKELY(group_type::is_sentinel(pc())))p_=nullptr;
+      if(BOOST_UNLIKELY(group_type::is_sentinel(pc()))){
+        end_of_arrays(reinterpret_cast<group_type*>(pc()-(N-1)));
+      }
       return;
     }
 
     for(;;){
-      int mask=reinterpret_cast<group_type*>(pc())->match_occupied();
+      auto mask=reinterpret_cast<group_type*>(pc())->match_occupied();
       if(mask!=0){
         auto n=unchecked_countr_zero(mask);
         if(BOOST_UNLIKELY(reinterpret_cast<group_type*>(pc())->is_sentinel(n))){
-          p_=nullptr;
+          end_of_arrays(reinterpret_cast<group_type*>(pc()));
         }
         else{
           pc_+=static_cast<diff_type>(n);
@@ -205,7 +216,7 @@ private:
 
     auto n=unchecked_countr_zero(mask);
     if(BOOST_UNLIKELY(reinterpret_cast<group_type*>(pc())->is_sentinel(n))){
-      p_=nullptr;
+      end_of_arrays(reinterpret_cast<group_type*>(pc()));
     }
     else{
       pc_+=static_cast<diff_type>(n);
@@ -214,6 +225,31 @@ private:
     }
   }
 
+  /* pg is the last group of the arrays traversed */
+
+  inline void end_of_arrays(group_type* pg)noexcept
+  {
+    end_of_arrays(pg,std::integral_constant<bool,Linked>{});
+  }
+
+  inline void end_of_arrays(group_type*,std::false_type /* no link */)noexcept
+  {
+    p_=nullptr;
+  }
+
+  BOOST_NOINLINE void end_of_arrays(group_type* pg,std::true_type)noexcept
+  {
+    auto plink=*reinterpret_cast<const link_type* const*>(pg+1);
+    if(!plink){
+      p_=nullptr;
+      return;
+    }
+    pc_=to_pointer<char_pointer>(
+      reinterpret_cast<unsigned char*>(plink->groups));
+    p_=to_pointer<table_element_pointer>(plink->elements);
+    if(!(plink->groups->match_occupied()&0x1))increment();
+  }
+
   template<typename Archive>
   friend void serialization_track(Archive& ar,const table_iterator& x)
   {
@@ -244,11 +280,12 @@ private:
 template<typename Iterator>
 class table_erase_return_type; 
 
-template<typename TypePolicy,typename GroupPtr,bool Const>
-class table_erase_return_type<table_iterator<TypePolicy,GroupPtr,Const>>
+template<typename TypePolicy,typename GroupPtr,bool Const,bool Linked>
+class table_erase_return_type<
+  table_iterator<TypePolicy,GroupPtr,Const,Linked>>
 {
-  using iterator=table_iterator<TypePolicy,GroupPtr,Const>;
-  using const_iterator=table_iterator<TypePolicy,GroupPtr,true>;
+  using iterator=table_iterator<TypePolicy,GroupPtr,Const,Linked>;
+  using const_iterator=table_iterator<TypePolicy,GroupPtr,true,Linked>;
 
 public:
   /* can't delete it because VS in pre-C++17 mode needs to see it for RVO */
@@ -289,7 +326,7 @@ private:
  *
  *   - begin() is not O(1).
  *   - No bucket API.
- *   - Load factor is fixed and can't be set by the user.
+ *   - Max load factor can only be set within [min_mlf,max_mlf].
  * 
  * For flat only:
  *
@@ -300,6 +337,14 @@ private:
  * try_emplace, erase and find support heterogeneous lookup by default,
  * that is, without checking for any ::is_transparent typedefs --the
  * checking is done by boost::unordered_(flat|node)_(map|set).
+ *
+ * When incremental rehashing is enabled, growth does not move all elements
+ * at once: the old arrays are kept alongside the new ones, lookups check
+ * both and every insertion of a new element or erasure by key transfers a
+ * few groups of the old arrays to the new ones (migration). Iterators
+ * traverse the old arrays and then the new ones (see table_iterator), and
+ * copy and comparison also visit both, so that migration is only ever
+ * done, or completed, by non-const member functions.
  */
 
 template<typename,typename,typename,typename>
@@ -307,7 +352,7 @@ class concurrent_table; /* concurrent/non-concurrent interop */
 
 template <typename TypePolicy,typename Hash,typename Pred,typename Allocator>
 using table_core_impl=
-  table_core<TypePolicy,group15<plain_integral>,table_arrays,
+  table_core<TypePolicy,default_group<plain_integral>,table_arrays,
   plain_size_control,Hash,Pred,Allocator>;
 
 #include <boost/unordered/detail/foa/ignore_wshadow.hpp>
@@ -328,6 +373,8 @@ class table:table_core_impl<TypePolicy,Hash,Pred,Allocator>
   using arrays_type=typename super::arrays_type;
   using size_ctrl_type=typename super::size_ctrl_type;
   using locator=typename super::locator;
+  using alloc_traits=typename super::alloc_traits;
+  using link_type=typename arrays_type::link_type;
   using compatible_concurrent_table=
     concurrent_table<TypePolicy,Hash,Pred,Allocator>;
   using group_type_pointer=typename boost::pointer_traits<
@@ -354,10 +401,11 @@ public:
   using const_reference=typename super::const_reference;
   using size_type=typename super::size_type;
   using difference_type=typename super::difference_type;
-  using const_iterator=table_iterator<type_policy,group_type_pointer,true>;
+  using const_iterator=
+    table_iterator<type_policy,group_type_pointer,true,true>;
   using iterator=typename std::conditional<
     has_mutable_iterator,
-    table_iterator<type_policy,group_type_pointer,false>,
+    table_iterator<type_policy,group_type_pointer,false,true>,
     const_iterator>::type;
   using erase_return_type=table_erase_return_type<iterator>;
 
@@ -371,24 +419,99 @@ public:
     super{n,h_,pred_,al_}
     {}
 
-  table(const table& x)=default;
-  table(table&& x)=default;
-  table(const table& x,const Allocator& al_):super{x,al_}{}
-  table(table&& x,const Allocator& al_):super{std::move(x),al_}{}
+  table(const table& x):
+    table{
+      x,alloc_traits::select_on_container_copy_construction(x.al())}{}
+
+  table(table&& x)
+    noexcept(std::is_nothrow_move_constructible<super>::value):
+    super{std::move(x)},incremental_{x.incremental_},
+    old_arrays{x.old_arrays},
+    migration_pos{x.migration_pos},migration_step{x.migration_step}
+  {
+    x.old_arrays=no_arrays();
+    relink();
+  }
+
+  table(const table& x,const Allocator& al_):
+    super{x,x.old_arrays,al_},incremental_{x.incremental_}{}
+
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+  template<
+    typename ExecutionPolicy,
+    typename std::enable_if<
+      is_execution_policy<ExecutionPolicy>::value>::type* =nullptr
+  >
+  table(ExecutionPolicy&& policy,const table& x):
+    super{std::forward<ExecutionPolicy>(policy),x,x.old_arrays},
+    incremental_{x.incremental_}{}
+#endif
+
+  table(table&& x,const Allocator& al_):
+    super{std::move(completed(x)),al_},incremental_{x.incremental_}{}
   table(compatible_concurrent_table&& x):
     table(std::move(x),x.exclusive_access()){}
-  ~table()=default;
 
-  table& operator=(const table& x)=default;
-  table& operator=(table&& x)=default;
+  ~table()
+  {
+    if(migrating())this->delete_old_arrays(old_arrays);
+  }
+
+  table& operator=(const table& x)
+  {
+    if(this!=&x){
+      complete_migration();
+      super::copy_assign(x,x.old_arrays);
+      incremental_=x.incremental_;
+    }
+    return *this;
+  }
+
+  table& operator=(table&& x)
+    noexcept(noexcept(std::declval<super&>()=std::declval<super&&>()))
+  {
+    static constexpr auto pocma=
+      alloc_traits::propagate_on_container_move_assignment::value;
+
+    if(this!=&x){
+      if(migrating()){
+        this->delete_old_arrays(old_arrays);
+        old_arrays=no_arrays();
+      }
+      if(pocma||this->al()==x.al()){
+        /* x's arrays are taken over, old ones go along */
+        super::operator=(std::move(x));
+        old_arrays=x.old_arrays;
+        migration_pos=x.migration_pos;
+        migration_step=x.migration_step;
+        x.old_arrays=no_arrays();
+        relink();
+      }
+      else super::operator=(std::move(completed(x)));
+      incremental_=x.incremental_;
+    }
+    return *this;
+  }
+
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+  template<typename ExecutionPolicy>
+  void assign(ExecutionPolicy&& policy,const table& x)
+  {
+    if(this!=&x){
+      complete_migration();
+      super::assign(std::forward<ExecutionPolicy>(policy),x,x.old_arrays);
+      incremental_=x.incremental_;
+    }
+  }
+#endif
 
   using super::get_allocator;
 
   iterator begin()noexcept
   {
-    iterator it{this->arrays.groups(),0,this->arrays.elements()};
-    if(this->arrays.elements()&&
-       !(this->arrays.groups()[0].match_occupied()&0x1))++it;
+    const auto& arrays_=migrating()?old_arrays:this->arrays;
+    iterator    it{arrays_.groups(),0,arrays_.elements()};
+    if(arrays_.elements()&&!(arrays_.groups()[0].match_occupied()&0x1))++it;
     return it;
   }
 
@@ -399,6 +522,18 @@ public:
   const_iterator cbegin()const noexcept{return begin();}
   const_iterator cend()const noexcept{return end();}
 
+  /* used by write_snapshot and serialize_flat_container, which resort to
+   * a copy or to element-wise saving, respectively, if migrating
+   */
+
+  bool migrating()const noexcept{return old_arrays.elements()!=nullptr;}
+
+  const arrays_type& get_arrays()const noexcept
+  {
+    BOOST_ASSERT(!migrating());
+    return this->arrays;
+  }
+
   using super::empty;
   using super::size;
   using super::max_size;
@@ -442,6 +577,15 @@ public:
       try_emplace_args_t{},std::forward<Key>(x),std::forward<Args>(args)...);
   }
 
+  template<typename Key,typename... Args>
+  BOOST_FORCEINLINE std::pair<iterator,bool> try_emplace(
+    prehashed ph,Key&& x,Args&&... args)
+  {
+    return hashed_emplace_impl(
+      this->hash_for(ph,x),
+      try_emplace_args_t{},std::forward<Key>(x),std::forward<Args>(args)...);
+  }
+
   BOOST_FORCEINLINE std::pair<iterator,bool>
   insert(const init_type& x){return emplace_impl(x);}
 
@@ -466,6 +610,40 @@ public:
   >::type
   insert(element_type&& x){return emplace_impl(std::move(x));}
 
+  /* Ranges of value_type or init_type given by forward iterators are
+   * inserted in bulk (see bulk_insert).
+   */
+
+  template<typename InputIterator>
+  void insert(InputIterator first,InputIterator last)
+  {
+    insert_range(
+      first,last,
+      std::integral_constant<
+        bool,
+        is_forward_iterator<InputIterator>::value&&
+        is_similar_to_any<decltype(*first),value_type,init_type>::value
+      >{});
+  }
+
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+  /* Ranges of value_type or init_type are inserted in parallel (see
+   * table_core::parallel_insert), other ranges sequentially.
+   */
+
+  template<typename ExecutionPolicy,typename FwdIterator>
+  void insert(ExecutionPolicy&& policy,FwdIterator first,FwdIterator last)
+  {
+    complete_migration();
+    insert_range(
+      policy,first,last,
+      std::integral_constant<
+        bool,
+        is_similar_to_any<decltype(*first),value_type,init_type>::value
+      >{});
+  }
+#endif
+
   template<
     bool dependent_value=false,
     typename std::enable_if<
@@ -474,6 +652,8 @@ public:
   erase_return_type erase(iterator pos)noexcept
   {return erase(const_iterator(pos));}
 
+  /* no migration here so that iterators stay valid in erase loops */
+
   BOOST_FORCEINLINE
   erase_return_type erase(const_iterator pos)noexcept
   {
@@ -487,6 +667,11 @@ public:
     !std::is_convertible<Key,iterator>::value&&
     !std::is_convertible<Key,const_iterator>::value, std::size_t>::type
   {
+    /* migration step done before erasing so that an exception thrown by it
+     * leaves the element in place
+     */
+
+    if(BOOST_UNLIKELY(migrating()))migrate(migration_step);
     auto it=find(x);
     if(it!=end()){
       erase(it);
@@ -498,10 +683,36 @@ public:
   void swap(table& x)
     noexcept(noexcept(std::declval<super&>().swap(std::declval<super&>())))
   {
+    using std::swap;
     super::swap(x);
+    swap(incremental_,x.incremental_);
+    swap(old_arrays,x.old_arrays);
+    swap(migration_pos,x.migration_pos);
+    swap(migration_step,x.migration_step);
+    relink();
+    x.relink();
+  }
+
+  void clear()noexcept
+  {
+    if(migrating()){
+      this->delete_old_arrays(old_arrays);
+      old_arrays=no_arrays();
+    }
+    super::clear();
   }
 
-  using super::clear;
+  bool incremental_rehash()const noexcept{return incremental_;}
+
+  void incremental_rehash(bool enable)
+  {
+    BOOST_UNORDERED_STATIC_ASSERT(
+      std::is_nothrow_move_constructible<init_type>::value||
+      !std::is_same<element_type,value_type>::value);
+
+    if(!enable)complete_migration();
+    incremental_=enable;
+  }
 
   element_type extract(const_iterator pos)
   {
@@ -515,22 +726,38 @@ public:
   template<typename Hash2,typename Pred2>
   void merge(table<TypePolicy,Hash2,Pred2,Allocator>& x)
   {
+    x.complete_migration();
     x.for_all_elements([&,this](group_type* pg,unsigned int n,element_type* p){
       erase_on_exit e{x,{pg,n,p}};
       if(!emplace_impl(type_policy::move(*p)).second)e.rollback();
     });
   }
 
+  /* x's stored hash values can be reused if its hash function, of the same
+   * type as ours, is stateless.
+   */
+
+  void merge(table& x)
+  {
+    merge(
+      x,
+      std::integral_constant<
+        bool,
+        arrays_type::stores_hash&&std::is_empty<hasher>::value
+      >{});
+  }
+
   template<typename Hash2,typename Pred2>
   void merge(table<TypePolicy,Hash2,Pred2,Allocator>&& x){merge(x);}
 
   using super::hash_function;
   using super::key_eq;
+  using super::prehash;
 
   template<typename Key>
   BOOST_FORCEINLINE iterator find(const Key& x)
   {
-    return make_iterator(super::find(x));
+    return find_impl(x,this->hash_for(x));
   }
 
   template<typename Key>
@@ -539,12 +766,122 @@ public:
     return const_cast<table*>(this)->find(x);
   }
 
+  template<typename Key>
+  BOOST_FORCEINLINE iterator find(prehashed ph,const Key& x)
+  {
+    return find_impl(x,this->hash_for(ph,x));
+  }
+
+  template<typename Key>
+  BOOST_FORCEINLINE const_iterator find(prehashed ph,const Key& x)const
+  {
+    return const_cast<table*>(this)->find(ph,x);
+  }
+
+  /* f(it) is invoked in sequence with the result of looking up each key in
+   * [first,last), lookups being pipelined in chunks of bulk_lookup_size.
+   */
+
+  using super::bulk_lookup_size;
+
+  template<typename FwdIterator,typename F>
+  BOOST_FORCEINLINE void find_many(FwdIterator first,FwdIterator last,F&& f)
+  {
+    if(BOOST_UNLIKELY(migrating())){
+      for(;first!=last;++first)f(find(*first));
+      return;
+    }
+
+    auto n=static_cast<std::size_t>(std::distance(first,last));
+    while(n){
+      auto m=n<2*bulk_lookup_size?n:bulk_lookup_size;
+      super::bulk_find(
+        first,m,[&](const locator& l){f(make_iterator(l));});
+      n-=m;
+      std::advance(
+        first,
+        static_cast<
+          typename std::iterator_traits<FwdIterator>::difference_type>(m));
+    }
+  }
+
+  template<typename FwdIterator,typename F>
+  BOOST_FORCEINLINE void find_many(
+    FwdIterator first,FwdIterator last,F&& f)const
+  {
+    const_cast<table*>(this)->find_many(
+      first,last,[&](iterator it){f(const_iterator(it));});
+  }
+
   using super::capacity;
   using super::load_factor;
   using super::max_load_factor;
+
+  void max_load_factor(float z)
+  {
+    complete_migration();
+    super::max_load_factor(z);
+  }
+
   using super::max_load;
-  using super::rehash;
-  using super::reserve;
+
+  void rehash(std::size_t n)
+  {
+    complete_migration();
+    super::rehash(n);
+  }
+
+  void reserve(std::size_t n)
+  {
+    complete_migration();
+    super::reserve(n);
+  }
+
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+  template<typename ExecutionPolicy>
+  void rehash(ExecutionPolicy&& policy,std::size_t n)
+  {
+    complete_migration();
+    super::rehash(std::forward<ExecutionPolicy>(policy),n);
+  }
+
+  template<typename ExecutionPolicy>
+  void reserve(ExecutionPolicy&& policy,std::size_t n)
+  {
+    complete_migration();
+    super::reserve(std::forward<ExecutionPolicy>(policy),n);
+  }
+#endif
+
+  void compact()
+  {
+    complete_migration();
+    super::compact();
+  }
+
+  using super::prefault;
+
+  /* used by serialize_flat_container */
+
+  using super::bulk_serializable;
+
+  template<typename Archive>
+  void save_bulk(Archive& ar)const
+  {
+    BOOST_ASSERT(!migrating());
+    super::save_bulk(ar,[&](group_type* pg,unsigned int n,element_type* p){
+      serialization_track(ar,make_iterator(locator{pg,n,p}));
+    });
+  }
+
+  template<typename Archive>
+  void load_bulk(Archive& ar)
+  {
+    clear();
+    super::load_bulk(ar,[&](group_type* pg,unsigned int n,element_type* p){
+      serialization_track(ar,make_iterator(locator{pg,n,p}));
+    });
+  }
 
 #if defined(BOOST_UNORDERED_ENABLE_STATS)
   using super::get_stats;
@@ -560,6 +897,7 @@ public:
       reference
     >::type;
 
+    x.complete_migration();
     std::size_t s=x.size();
     x.for_all_elements(
       [&](group_type* pg,unsigned int n,element_type* p){
@@ -572,7 +910,19 @@ public:
 
   friend bool operator==(const table& x,const table& y)
   {
-    return static_cast<const super&>(x)==static_cast<const super&>(y);
+    if(BOOST_LIKELY(!x.migrating()&&!y.migrating())){
+      return static_cast<const super&>(x)==static_cast<const super&>(y);
+    }
+
+    auto pred=[&](element_type* p){
+      auto it=y.find(x.key_from(*p));
+      return it!=y.end()&&
+        const_cast<const value_type&>(type_policy::value_from(*p))==*it;
+    };
+    return
+      x.size()==y.size()&&
+      super::for_all_elements_while(x.old_arrays,pred)&&
+      super::for_all_elements_while(x.arrays,pred);
   }
 
   friend bool operator!=(const table& x,const table& y){return !(x==y);}
@@ -589,6 +939,7 @@ private:
         x.arrays.elements_};},
       size_ctrl_type{x.size_ctrl.ml,x.size_ctrl.size}}
   {
+    this->mlf_=x.mlf_;
     compatible_concurrent_table::arrays_type::delete_group_access(x.al(),x.arrays);
     x.arrays=ah.release();
     x.size_ctrl.ml=x.initial_max_load();
@@ -598,7 +949,7 @@ private:
 
   template<typename ExclusiveLockGuard>
   table(compatible_concurrent_table&& x,ExclusiveLockGuard):
-    table(std::move(x),x.make_empty_arrays())
+    table(std::move(x),(x.complete_migration(),x.make_empty_arrays()))
   {}
 
   struct erase_on_exit
@@ -618,17 +969,172 @@ private:
     return {l.pg,l.n,l.p};
   }
 
+  void merge(table& x,std::false_type /* hash values not reusable */)
+  {
+    merge<Hash,Pred>(x);
+  }
+
+  void merge(table& x,std::true_type /* reuse stored hash values */)
+  {
+    x.complete_migration();
+    x.for_all_elements([&,this](group_type* pg,unsigned int n,element_type* p){
+      erase_on_exit e{x,{pg,n,p}};
+      auto hash=this->hash_for_element(x.arrays,p);
+      auto pos0=this->position_for(hash);
+      if(super::find(this->key_from(*p),pos0,hash)){
+        e.rollback();
+      }
+      else if(BOOST_UNLIKELY(migrating())){
+        if(!emplace_while_migrating(1,hash,type_policy::move(*p)).second){
+          e.rollback();
+        }
+      }
+      else if(BOOST_LIKELY(this->size_ctrl.size<this->size_ctrl.ml)){
+        this->unchecked_emplace_at(pos0,hash,type_policy::move(*p));
+      }
+      else{
+        grow_and_emplace(1,hash,type_policy::move(*p));
+      }
+    });
+  }
+
+  template<typename InputIterator>
+  void insert_range(
+    InputIterator first,InputIterator last,std::false_type /* no bulk */)
+  {
+    for(;first!=last;++first)emplace(*first);
+  }
+
+  template<typename FwdIterator>
+  void insert_range(
+    FwdIterator first,FwdIterator last,std::true_type /* bulk */)
+  {
+    bulk_insert(first,static_cast<std::size_t>(std::distance(first,last)));
+  }
+
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+  template<typename ExecutionPolicy,typename FwdIterator>
+  void insert_range(
+    ExecutionPolicy&&,FwdIterator first,FwdIterator last,
+    std::false_type /* sequential */)
+  {
+    insert(first,last);
+  }
+
+  template<typename ExecutionPolicy,typename FwdIterator>
+  void insert_range(
+    ExecutionPolicy&& policy,FwdIterator first,FwdIterator last,
+    std::true_type /* parallel */)
+  {
+    this->parallel_insert(
+      policy,first,static_cast<std::size_t>(std::distance(first,last)));
+  }
+#endif
+
+  /* Insertion proceeds in chunks of bulk_lookup_size: hash values for the
+   * whole chunk are computed and the corresponding groups and element slots
+   * prefetched before each element is looked up and, if not present,
+   * emplaced. When growth is needed, the table is resized to accommodate the
+   * remaining elements of the range, but no more than bulk_growth_factor
+   * times its current size (see bulk_growth_hint).
+   */
+
+  template<typename FwdIterator>
+  void bulk_insert(FwdIterator first,std::size_t n)
+  {
+    while(n){
+      auto m=n<2*bulk_lookup_size?n:bulk_lookup_size;
+      bulk_insert_chunk(first,m,n);
+      n-=m;
+      std::advance(
+        first,
+        static_cast<
+          typename std::iterator_traits<FwdIterator>::difference_type>(m));
+    }
+  }
+
+  template<typename FwdIterator>
+  BOOST_FORCEINLINE void bulk_insert_chunk(
+    FwdIterator first,std::size_t m,std::size_t n)
+  {
+    BOOST_ASSERT(m<2*bulk_lookup_size);
+
+    std::size_t hashes[2*bulk_lookup_size-1];
+    auto        it=first;
+
+    for(std::size_t i=0;i<m;++i,++it){
+      auto hash=hashes[i]=this->hash_for(this->key_from(*it));
+      auto pos=this->position_for(hash);
+      BOOST_UNORDERED_PREFETCH(this->arrays.groups()+pos);
+      if(this->arrays.elements()){
+        BOOST_UNORDERED_PREFETCH(this->arrays.elements()+pos*N);
+      }
+    }
+
+    it=first;
+    for(std::size_t i=0;i<m;++i,++it){
+      /* position recalculated as the table may have been rehashed */
+
+      auto hash=hashes[i];
+      auto pos0=this->position_for(hash);
+      if(super::find(this->key_from(*it),pos0,hash))continue;
+      if(BOOST_UNLIKELY(migrating())){
+        emplace_while_migrating(bulk_growth_hint(n-i),hash,*it);
+      }
+      else if(BOOST_LIKELY(this->size_ctrl.size<this->size_ctrl.ml)){
+        this->unchecked_emplace_at(pos0,hash,*it);
+      }
+      else{
+        grow_and_emplace(bulk_growth_hint(n-i),hash,*it);
+      }
+    }
+  }
+
+  /* The remaining elements of the range may well be duplicates, so growth
+   * is not presized for all of them: arrays are at most bulk_growth_factor
+   * times as large as needed for the current size, and grow again if the
+   * range turns out to be longer. This bounds the memory wasted by ranges
+   * of repeated keys while growing only once for ranges of up to
+   * (bulk_growth_factor-1)*size() new elements.
+   */
+
+  static constexpr std::size_t bulk_growth_factor=4;
+
+  std::size_t bulk_growth_hint(std::size_t remaining)const noexcept
+  {
+    auto m=(bulk_growth_factor-1)*this->size();
+    return remaining<m?remaining:m?m:1;
+  }
+
+  template<typename Key>
+  BOOST_FORCEINLINE iterator find_impl(const Key& x,std::size_t hash)
+  {
+    auto loc=super::find(x,this->position_for(hash),hash);
+    if(BOOST_UNLIKELY(!loc&&migrating()))loc=find_in_old_arrays(x,hash);
+    return make_iterator(loc);
+  }
+
   template<typename... Args>
   BOOST_FORCEINLINE std::pair<iterator,bool> emplace_impl(Args&&... args)
   {
     const auto &k=this->key_from(std::forward<Args>(args)...);
-    auto        hash=this->hash_for(k);
+    return hashed_emplace_impl(this->hash_for(k),std::forward<Args>(args)...);
+  }
+
+  template<typename... Args>
+  BOOST_FORCEINLINE std::pair<iterator,bool> hashed_emplace_impl(
+    std::size_t hash,Args&&... args)
+  {
+    const auto &k=this->key_from(std::forward<Args>(args)...);
     auto        pos0=this->position_for(hash);
     auto        loc=super::find(k,pos0,hash);
 
     if(loc){
       return {make_iterator(loc),false};
     }
+    if(BOOST_UNLIKELY(migrating())){
+      return emplace_while_migrating(1,hash,std::forward<Args>(args)...);
+    }
     if(BOOST_LIKELY(this->size_ctrl.size<this->size_ctrl.ml)){
       return {
         make_iterator(
@@ -638,13 +1144,131 @@ private:
     }
     else{
       return {
-        make_iterator(
-          this->unchecked_emplace_with_rehash(
-            hash,std::forward<Args>(args)...)),
+        make_iterator(grow_and_emplace(1,hash,std::forward<Args>(args)...)),
         true
       };  
     }
   }
+
+  /* n is the number of elements expected to be inserted, as in
+   * table_core::unchecked_emplace_with_rehash_n.
+   */
+
+  template<typename... Args>
+  BOOST_FORCEINLINE locator grow_and_emplace(
+    std::size_t n,std::size_t hash,Args&&... args)
+  {
+    if(BOOST_LIKELY(!incremental_)){
+      return this->unchecked_emplace_with_rehash_n(
+        n,hash,std::forward<Args>(args)...);
+    }
+    else{
+      return unchecked_emplace_with_incremental_rehash(
+        n,hash,std::forward<Args>(args)...);
+    }
+  }
+
+  template<typename... Args>
+  BOOST_NOINLINE locator unchecked_emplace_with_incremental_rehash(
+    std::size_t n,std::size_t hash,Args&&... args)
+  {
+    complete_migration();
+    auto loc=this->unchecked_emplace_with_incremental_rehash_n(
+      old_arrays,n,hash,std::forward<Args>(args)...);
+    if(migrating()){ /* old arrays may be the initial, unallocated ones */
+      relink();
+
+      /* Transfer enough groups per operation to be done before the new
+       * arrays fill up (otherwise, the remaining migration is completed
+       * synchronously on next growth).
+       */
+      auto slack=this->size_ctrl.ml>this->size_ctrl.size?
+        this->size_ctrl.ml-this->size_ctrl.size:0;
+      migration_pos=0;
+      migration_step=(old_arrays.groups_size_mask+1)/(slack+1)+1;
+    }
+    return loc;
+  }
+
+  /* Insertion of an element not found in arrays while migrating. The
+   * migration step is done after emplacing, which leaves the returned
+   * locator valid as the element lives in arrays.
+   */
+
+  template<typename... Args>
+  BOOST_NOINLINE std::pair<iterator,bool> emplace_while_migrating(
+    std::size_t n,std::size_t hash,Args&&... args)
+  {
+    BOOST_ASSERT(incremental_);
+
+    auto loc=find_in_old_arrays(this->key_from(args...),hash);
+    if(loc){
+      return {make_iterator(loc),false};
+    }
+    if(BOOST_LIKELY(this->size_ctrl.size<this->size_ctrl.ml)){
+      loc=this->unchecked_emplace_at(
+        this->position_for(hash),hash,std::forward<Args>(args)...);
+    }
+    else{
+      loc=grow_and_emplace(n,hash,std::forward<Args>(args)...);
+    }
+    if(migrating())migrate(migration_step);
+    return {make_iterator(loc),true};
+  }
+
+  template<typename Key>
+  BOOST_NOINLINE locator find_in_old_arrays(
+    const Key& x,std::size_t hash)const
+  {
+    return super::find(
+      old_arrays,x,this->position_for(hash,old_arrays),hash);
+  }
+
+  static arrays_type no_arrays()noexcept{return {0,0,nullptr,nullptr};}
+
+  /* points old_arrays to the current ones so that iterators can traverse
+   * both (see table_iterator)
+   */
+
+  void relink()noexcept
+  {
+    if(migrating()){
+      link={this->arrays.groups(),this->arrays.elements()};
+      old_arrays.link()=&link;
+    }
+  }
+
+  static table& completed(table& x)
+  {
+    x.complete_migration();
+    return x;
+  }
+
+  void complete_migration()
+  {
+    if(BOOST_UNLIKELY(migrating()))migrate(old_arrays.groups_size_mask+1);
+  }
+
+  /* transfers the next n groups of old_arrays */
+
+  BOOST_NOINLINE void migrate(std::size_t n)
+  {
+    auto last=old_arrays.groups_size_mask+1,
+         first=migration_pos,
+         next=last-first>n?first+n:last;
+    this->transfer_groups(old_arrays,first,next);
+    migration_pos=next;
+    if(next==last){
+      this->delete_old_arrays(old_arrays);
+      old_arrays=no_arrays();
+    }
+  }
+
+  bool        incremental_=false;
+  arrays_type old_arrays=no_arrays();
+  std::size_t migration_pos=0,
+              migration_step=0;
+  link_type   link={nullptr,nullptr};
 };
 
 #if defined(BOOST_MSVC)
@@ -118,6 +118,57 @@ inline std::size_t mulx( std::size_t x ) noexcept
 #endif
 }
 
+// High word of the full-width product of two words, used for range
+// reduction: mulhi(x, n) maps x uniformly into [0, n)
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64)) && !defined(__clang__)
+
+__forceinline boost::uint64_t mulhi64( boost::uint64_t x, boost::uint64_t y )
+{
+    return __umulh( x, y );
+}
+
+#elif defined(__SIZEOF_INT128__)
+
+inline boost::uint64_t mulhi64( boost::uint64_t x, boost::uint64_t y )
+{
+    return (boost::uint64_t)( ( (__uint128_t)x * y ) >> 64 );
+}
+
+#else
+
+inline boost::uint64_t mulhi64( boost::uint64_t x, boost::uint64_t y )
+{
+    boost::uint64_t x1 = (boost::uint32_t)x;
+    boost::uint64_t x2 = x >> 32;
+
+    boost::uint64_t y1 = (boost::uint32_t)y;
+    boost::uint64_t y2 = y >> 32;
+
+    boost::uint64_t r2a = x1 * y2;
+    boost::uint64_t r2b = x2 * y1;
+    boost::uint64_t r1 = x1 * y1;
+
+    boost::uint64_t r2 = (r1 >> 32) + (boost::uint32_t)r2a + (boost::uint32_t)r2b;
+
+    return x2 * y2 + ( r2a >> 32 ) + ( r2b >> 32 ) + ( r2 >> 32 );
+}
+
+#endif
+
+inline std::size_t mulhi( std::size_t x, std::size_t y ) noexcept
+{
+#if defined(BOOST_UNORDERED_64B_ARCHITECTURE)
+
+    return (std::size_t)mulhi64( (boost::uint64_t)x, (boost::uint64_t)y );
+
+#else /* 32 bits assumed */
+
+    return (std::size_t)( ( (boost::uint64_t)x * y ) >> 32 );
+
+#endif
+}
+
 #ifdef BOOST_UNORDERED_64B_ARCHITECTURE
 #undef BOOST_UNORDERED_64B_ARCHITECTURE
 #endif
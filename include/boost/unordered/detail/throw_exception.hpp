@@ -23,6 +23,12 @@ namespace boost {
         boost::throw_exception(std::out_of_range(message));
       }
 
+      BOOST_NOINLINE BOOST_NORETURN inline void throw_invalid_argument(
+        char const* message)
+      {
+        boost::throw_exception(std::invalid_argument(message));
+      }
+
     } // namespace detail
   } // namespace unordered
 } // namespace boost
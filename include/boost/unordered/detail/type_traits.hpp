@@ -13,6 +13,7 @@
 #endif
 
 #include <boost/config/workaround.hpp>
+#include <boost/unordered/prehashed.hpp>
 
 #if !defined(BOOST_NO_CXX17_DEDUCTION_GUIDES)
 #include <iterator>
@@ -143,10 +144,15 @@ namespace boost {
       {
       };
 
-      template <class, class Hash, class KeyEqual> struct are_transparent
+      template <class Key, class Hash, class KeyEqual> struct are_transparent
       {
+        // prehashed is excluded so that transparent overloads don't compete
+        // with those taking a precomputed hash as their first argument
         static bool const value =
-          is_transparent<Hash>::value && is_transparent<KeyEqual>::value;
+          is_transparent<Hash>::value && is_transparent<KeyEqual>::value &&
+          !std::is_same<typename std::remove_cv<typename std::remove_reference<
+                          Key>::type>::type,
+            boost::unordered::prehashed>::value;
       };
 
       template <class Key, class UnorderedMap> struct transparent_non_iterable
@@ -0,0 +1,315 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNORDERED_FROZEN_FLAT_MAP_HPP_INCLUDED
+#define BOOST_UNORDERED_FROZEN_FLAT_MAP_HPP_INCLUDED
+
+#include <boost/config.hpp>
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#pragma once
+#endif
+
+#include <boost/unordered/detail/foa/flat_map_types.hpp>
+#include <boost/unordered/detail/foa/frozen_table.hpp>
+#include <boost/unordered/detail/throw_exception.hpp>
+#include <boost/unordered/detail/type_traits.hpp>
+#include <boost/unordered/frozen_flat_map_fwd.hpp>
+#include <boost/unordered/unordered_flat_map.hpp>
+
+#include <boost/core/allocator_access.hpp>
+#include <boost/container_hash/hash.hpp>
+
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+namespace boost {
+  namespace unordered {
+
+#if defined(BOOST_MSVC)
+#pragma warning(push)
+#pragma warning(disable : 4714) /* marked as __forceinline not inlined */
+#endif
+
+    template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+    class frozen_flat_map
+    {
+      using map_types = detail::foa::flat_map_types<Key, T>;
+
+      using table_type = detail::foa::frozen_table<map_types, Hash, KeyEqual,
+        typename boost::allocator_rebind<Allocator,
+          typename map_types::value_type>::type>;
+
+      using source_type =
+        unordered_flat_map<Key, T, Hash, KeyEqual, Allocator>;
+
+      table_type table_;
+
+      template <class K, class V, class H, class KE, class A>
+      bool friend operator==(frozen_flat_map<K, V, H, KE, A> const& lhs,
+        frozen_flat_map<K, V, H, KE, A> const& rhs);
+
+    public:
+      using key_type = Key;
+      using mapped_type = T;
+      using value_type = typename map_types::value_type;
+      using size_type = std::size_t;
+      using difference_type = std::ptrdiff_t;
+      using hasher = typename boost::unordered::detail::type_identity<Hash>::type;
+      using key_equal = typename boost::unordered::detail::type_identity<KeyEqual>::type;
+      using allocator_type = typename boost::unordered::detail::type_identity<Allocator>::type;
+      using reference = value_type const&;
+      using const_reference = value_type const&;
+      using pointer =
+        typename boost::allocator_const_pointer<allocator_type>::type;
+      using const_pointer =
+        typename boost::allocator_const_pointer<allocator_type>::type;
+      using iterator = typename table_type::const_iterator;
+      using const_iterator = typename table_type::const_iterator;
+
+      frozen_flat_map() : frozen_flat_map(hasher()) {}
+
+      explicit frozen_flat_map(hasher const& h,
+        key_equal const& pred = key_equal(),
+        allocator_type const& a = allocator_type())
+          : table_(h, pred, a)
+      {
+      }
+
+      explicit frozen_flat_map(allocator_type const& a)
+          : frozen_flat_map(hasher(), key_equal(), a)
+      {
+      }
+
+      explicit frozen_flat_map(source_type const& x) : table_(x.table_) {}
+
+      explicit frozen_flat_map(source_type&& x)
+          : table_(std::move(x.table_))
+      {
+        x.clear();
+      }
+
+      template <class InputIterator>
+      frozen_flat_map(InputIterator first, InputIterator last,
+        hasher const& h = hasher(), key_equal const& pred = key_equal(),
+        allocator_type const& a = allocator_type())
+          : frozen_flat_map(source_type(first, last, 0, h, pred, a))
+      {
+      }
+
+      template <class InputIterator>
+      frozen_flat_map(
+        InputIterator first, InputIterator last, allocator_type const& a)
+          : frozen_flat_map(first, last, hasher(), key_equal(), a)
+      {
+      }
+
+      frozen_flat_map(std::initializer_list<value_type> ilist,
+        hasher const& h = hasher(), key_equal const& pred = key_equal(),
+        allocator_type const& a = allocator_type())
+          : frozen_flat_map(ilist.begin(), ilist.end(), h, pred, a)
+      {
+      }
+
+      frozen_flat_map(
+        std::initializer_list<value_type> ilist, allocator_type const& a)
+          : frozen_flat_map(ilist.begin(), ilist.end(), a)
+      {
+      }
+
+      frozen_flat_map(frozen_flat_map const& other) = default;
+
+      frozen_flat_map(frozen_flat_map&& other) noexcept = default;
+
+      ~frozen_flat_map() = default;
+
+      frozen_flat_map& operator=(frozen_flat_map const& other)
+      {
+        table_ = other.table_;
+        return *this;
+      }
+
+      frozen_flat_map& operator=(frozen_flat_map&& other) noexcept
+      {
+        table_ = std::move(other.table_);
+        return *this;
+      }
+
+      allocator_type get_allocator() const noexcept
+      {
+        return allocator_type(table_.get_allocator());
+      }
+
+      /// Iterators
+      ///
+
+      const_iterator begin() const noexcept { return table_.begin(); }
+      const_iterator end() const noexcept { return table_.end(); }
+      const_iterator cbegin() const noexcept { return table_.begin(); }
+      const_iterator cend() const noexcept { return table_.end(); }
+
+      /// Capacity
+      ///
+
+      BOOST_ATTRIBUTE_NODISCARD bool empty() const noexcept
+      {
+        return table_.empty();
+      }
+
+      size_type size() const noexcept { return table_.size(); }
+
+      /// Modifiers
+      ///
+
+      void swap(frozen_flat_map& rhs) noexcept { table_.swap(rhs.table_); }
+
+      /// Lookup
+      ///
+
+      mapped_type const& at(key_type const& key) const
+      {
+        auto pos = table_.find(key);
+        if (pos != table_.end()) {
+          return pos->second;
+        }
+        boost::unordered::detail::throw_out_of_range(
+          "key was not found in frozen_flat_map");
+      }
+
+      template <class K>
+      typename std::enable_if<
+        boost::unordered::detail::are_transparent<K, hasher, key_equal>::value,
+        mapped_type const&>::type
+      at(K const& key) const
+      {
+        auto pos = table_.find(key);
+        if (pos != table_.end()) {
+          return pos->second;
+        }
+        boost::unordered::detail::throw_out_of_range(
+          "key was not found in frozen_flat_map");
+      }
+
+      BOOST_FORCEINLINE size_type count(key_type const& key) const
+      {
+        return table_.find(key) != table_.end() ? 1 : 0;
+      }
+
+      template <class K>
+      BOOST_FORCEINLINE typename std::enable_if<
+        detail::are_transparent<K, hasher, key_equal>::value, size_type>::type
+      count(K const& key) const
+      {
+        return table_.find(key) != table_.end() ? 1 : 0;
+      }
+
+      BOOST_FORCEINLINE const_iterator find(key_type const& key) const
+      {
+        return table_.find(key);
+      }
+
+      template <class K>
+      BOOST_FORCEINLINE typename std::enable_if<
+        boost::unordered::detail::are_transparent<K, hasher, key_equal>::value,
+        const_iterator>::type
+      find(K const& key) const
+      {
+        return table_.find(key);
+      }
+
+      BOOST_FORCEINLINE bool contains(key_type const& key) const
+      {
+        return table_.find(key) != table_.end();
+      }
+
+      template <class K>
+      BOOST_FORCEINLINE typename std::enable_if<
+        boost::unordered::detail::are_transparent<K, hasher, key_equal>::value,
+        bool>::type
+      contains(K const& key) const
+      {
+        return table_.find(key) != table_.end();
+      }
+
+      std::pair<const_iterator, const_iterator> equal_range(
+        key_type const& key) const
+      {
+        auto pos = table_.find(key);
+        if (pos == table_.end()) {
+          return {pos, pos};
+        }
+
+        auto next = pos;
+        ++next;
+        return {pos, next};
+      }
+
+      template <class K>
+      typename std::enable_if<
+        detail::are_transparent<K, hasher, key_equal>::value,
+        std::pair<const_iterator, const_iterator> >::type
+      equal_range(K const& key) const
+      {
+        auto pos = table_.find(key);
+        if (pos == table_.end()) {
+          return {pos, pos};
+        }
+
+        auto next = pos;
+        ++next;
+        return {pos, next};
+      }
+
+      /// Hash Policy
+      ///
+
+      size_type bucket_count() const noexcept { return table_.capacity(); }
+
+      float load_factor() const noexcept
+      {
+        return table_.capacity() == 0
+                 ? 0.0f
+                 : float(table_.size()) / float(table_.capacity());
+      }
+
+      /// Observers
+      ///
+
+      hasher hash_function() const { return table_.hash_function(); }
+
+      key_equal key_eq() const { return table_.key_eq(); }
+    };
+
+    template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+    bool operator==(
+      frozen_flat_map<Key, T, Hash, KeyEqual, Allocator> const& lhs,
+      frozen_flat_map<Key, T, Hash, KeyEqual, Allocator> const& rhs)
+    {
+      return lhs.table_ == rhs.table_;
+    }
+
+    template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+    bool operator!=(
+      frozen_flat_map<Key, T, Hash, KeyEqual, Allocator> const& lhs,
+      frozen_flat_map<Key, T, Hash, KeyEqual, Allocator> const& rhs)
+    {
+      return !(lhs == rhs);
+    }
+
+    template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+    void swap(frozen_flat_map<Key, T, Hash, KeyEqual, Allocator>& lhs,
+      frozen_flat_map<Key, T, Hash, KeyEqual, Allocator>& rhs)
+      noexcept(noexcept(lhs.swap(rhs)))
+    {
+      lhs.swap(rhs);
+    }
+
+#if defined(BOOST_MSVC)
+#pragma warning(pop) /* C4714 */
+#endif
+
+  } // namespace unordered
+} // namespace boost
+
+#endif
@@ -48,6 +48,21 @@ struct hash_is_avalanching_impl<
   typename std::enable_if<((void)Hash::is_avalanching,true)>::type
 >{}; /* Hash::is_avalanching is not a type: compile error downstream */
 
+template<typename Hash,typename=void>
+struct stored_hash_type_impl
+{
+  using type=void;
+};
+
+template<typename Hash>
+struct stored_hash_type_impl<
+  Hash,
+  boost::unordered::detail::void_t<typename Hash::stored_hash_type>
+>
+{
+  using type=typename Hash::stored_hash_type;
+};
+
 } /* namespace detail */
 
 /* Each trait can be partially specialized by users for concrete hash functions
@@ -64,6 +79,17 @@ struct hash_is_avalanching_impl<
 template<typename Hash>
 struct hash_is_avalanching: detail::hash_is_avalanching_impl<Hash>::type{};
 
+/* stored_hash_type<Hash>::type is:
+ *   - void if Hash::stored_hash_type is not present.
+ *   - Hash::stored_hash_type otherwise.
+ * Open-addressing containers store, alongside each element, its hash value
+ * (if std::size_t) or a 32-bit reduction of it (if boost::uint32_t), which
+ * is then used instead of calling Hash again on rehashing, copying and
+ * merging. void means no storage, other types are not allowed.
+ */
+template<typename Hash>
+struct stored_hash_type: detail::stored_hash_type_impl<Hash>{};
+
 } /* namespace unordered */
 } /* namespace boost */
 
@@ -0,0 +1,142 @@
+/* Allocator backing large blocks with huge pages.
+ *
+ * Copyright 2026 agent.
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See https://www.boost.org/libs/unordered for library home page.
+ */
+
+#ifndef BOOST_UNORDERED_HUGE_PAGE_ALLOCATOR_HPP
+#define BOOST_UNORDERED_HUGE_PAGE_ALLOCATOR_HPP
+
+#include <boost/config.hpp>
+#include <boost/throw_exception.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#define BOOST_UNORDERED_HAS_HUGE_PAGES
+#endif
+
+namespace boost{
+namespace unordered{
+
+/* huge_page_allocator<T> obtains blocks of at least huge_page_size bytes
+ * directly from the OS, aligned to huge_page_size and flagged as eligible
+ * for transparent huge pages (madvise(MADV_HUGEPAGE)) so that, once the
+ * kernel backs them with 2MB pages, random accesses to large bucket arrays
+ * incur far fewer TLB misses. Smaller blocks, as well as all blocks on
+ * platforms other than Linux, are allocated with std::allocator<T>.
+ */
+
+template<typename T>
+class huge_page_allocator
+{
+public:
+  using value_type=T;
+  using size_type=std::size_t;
+  using difference_type=std::ptrdiff_t;
+  using propagate_on_container_copy_assignment=std::false_type;
+  using propagate_on_container_move_assignment=std::true_type;
+  using propagate_on_container_swap=std::false_type;
+  using is_always_equal=std::true_type;
+
+  template<typename U>
+  struct rebind{using other=huge_page_allocator<U>;};
+
+  static constexpr std::size_t huge_page_size=std::size_t(2)*1024*1024;
+
+  huge_page_allocator()=default;
+  huge_page_allocator(const huge_page_allocator&)=default;
+  template<typename U>
+  huge_page_allocator(const huge_page_allocator<U>&)noexcept{}
+
+  T* allocate(std::size_t n)
+  {
+    if(n>max_size())boost::throw_exception(std::bad_alloc());
+#if defined(BOOST_UNORDERED_HAS_HUGE_PAGES)
+    if(is_large(n))return allocate_huge(n*sizeof(T));
+#endif
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T* p,std::size_t n)noexcept
+  {
+#if defined(BOOST_UNORDERED_HAS_HUGE_PAGES)
+    if(is_large(n)){
+      ::munmap(p,round_up(n*sizeof(T)));
+      return;
+    }
+#endif
+    std::allocator<T>().deallocate(p,n);
+  }
+
+  std::size_t max_size()const noexcept
+  {
+    return (std::numeric_limits<std::size_t>::max)()/2/sizeof(T);
+  }
+
+  friend bool operator==(
+    const huge_page_allocator&,const huge_page_allocator&)noexcept
+  {
+    return true;
+  }
+
+  friend bool operator!=(
+    const huge_page_allocator&,const huge_page_allocator&)noexcept
+  {
+    return false;
+  }
+
+private:
+  static bool is_large(std::size_t n)noexcept
+  {
+    return n>=huge_page_size/sizeof(T);
+  }
+
+  static std::size_t round_up(std::size_t size)noexcept
+  {
+    return (size+huge_page_size-1)&~(huge_page_size-1);
+  }
+
+#if defined(BOOST_UNORDERED_HAS_HUGE_PAGES)
+  static T* allocate_huge(std::size_t size)
+  {
+    /* mmap only guarantees page alignment: we map an extra huge page and
+     * trim the unaligned head and the excess tail.
+     */
+
+    auto len=round_up(size);
+    void* raw=::mmap(
+      nullptr,len+huge_page_size,PROT_READ|PROT_WRITE,
+      MAP_PRIVATE|MAP_ANONYMOUS,-1,0);
+    if(raw==MAP_FAILED)boost::throw_exception(std::bad_alloc());
+
+    auto p0=reinterpret_cast<std::uintptr_t>(raw);
+    auto p=(p0+huge_page_size-1)&~std::uintptr_t(huge_page_size-1);
+    if(p!=p0)::munmap(raw,p-p0);
+    ::munmap(reinterpret_cast<void*>(p+len),p0+huge_page_size-p);
+#if defined(MADV_HUGEPAGE)
+    ::madvise(reinterpret_cast<void*>(p),len,MADV_HUGEPAGE);
+#endif
+    return reinterpret_cast<T*>(p);
+  }
+#endif
+};
+
+template<typename T>
+constexpr std::size_t huge_page_allocator<T>::huge_page_size;
+
+} /* namespace unordered */
+
+using unordered::huge_page_allocator;
+
+} /* namespace boost */
+
+#endif
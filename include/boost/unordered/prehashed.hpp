@@ -0,0 +1,41 @@
+/* Precomputed hash values.
+ *
+ * Copyright 2026 agent.
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See https://www.boost.org/libs/unordered for library home page.
+ */
+
+#ifndef BOOST_UNORDERED_PREHASHED_HPP
+#define BOOST_UNORDERED_PREHASHED_HPP
+
+#include <boost/config.hpp>
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#pragma once
+#endif
+
+#include <cstddef>
+
+namespace boost{
+namespace unordered{
+
+/* Result of invoking a container's hash function on some key, passed along
+ * with the key to lookup and insertion operations of open-addressing and
+ * concurrent containers so that the key is not hashed again. This is useful
+ * when the same key is used with several containers having equivalent
+ * hash functions.
+ */
+
+struct prehashed
+{
+  explicit prehashed(std::size_t hash_)noexcept:hash{hash_}{}
+
+  std::size_t hash;
+};
+
+} /* namespace unordered */
+} /* namespace boost */
+
+#endif
@@ -0,0 +1,47 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNORDERED_SMALL_FLAT_MAP_FWD_HPP_INCLUDED
+#define BOOST_UNORDERED_SMALL_FLAT_MAP_FWD_HPP_INCLUDED
+
+#include <boost/config.hpp>
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#pragma once
+#endif
+
+#include <boost/container_hash/hash_fwd.hpp>
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+namespace boost {
+  namespace unordered {
+    template <class Key, class T, std::size_t N, class Hash = boost::hash<Key>,
+      class KeyEqual = std::equal_to<Key>,
+      class Allocator = std::allocator<std::pair<const Key, T> > >
+    class small_flat_map;
+
+    template <class Key, class T, std::size_t N, class Hash, class KeyEqual,
+      class Allocator>
+    bool operator==(
+      small_flat_map<Key, T, N, Hash, KeyEqual, Allocator> const& lhs,
+      small_flat_map<Key, T, N, Hash, KeyEqual, Allocator> const& rhs);
+
+    template <class Key, class T, std::size_t N, class Hash, class KeyEqual,
+      class Allocator>
+    bool operator!=(
+      small_flat_map<Key, T, N, Hash, KeyEqual, Allocator> const& lhs,
+      small_flat_map<Key, T, N, Hash, KeyEqual, Allocator> const& rhs);
+
+    template <class Key, class T, std::size_t N, class Hash, class KeyEqual,
+      class Allocator>
+    void swap(small_flat_map<Key, T, N, Hash, KeyEqual, Allocator>& lhs,
+      small_flat_map<Key, T, N, Hash, KeyEqual, Allocator>& rhs)
+      noexcept(noexcept(lhs.swap(rhs)));
+  } // namespace unordered
+
+  using boost::unordered::small_flat_map;
+} // namespace boost
+
+#endif
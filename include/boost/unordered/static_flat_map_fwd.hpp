@@ -0,0 +1,38 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNORDERED_STATIC_FLAT_MAP_FWD_HPP_INCLUDED
+#define BOOST_UNORDERED_STATIC_FLAT_MAP_FWD_HPP_INCLUDED
+
+#include <boost/config.hpp>
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#pragma once
+#endif
+
+#include <boost/unordered/static_hash.hpp>
+#include <cstddef>
+#include <functional>
+
+namespace boost {
+  namespace unordered {
+    template <class Key, class T, std::size_t N,
+      class Hash = boost::unordered::static_hash<Key>,
+      class KeyEqual = std::equal_to<Key> >
+    class static_flat_map;
+
+    template <class Key, class T, std::size_t N, class Hash, class KeyEqual>
+    BOOST_CXX14_CONSTEXPR bool operator==(
+      static_flat_map<Key, T, N, Hash, KeyEqual> const& lhs,
+      static_flat_map<Key, T, N, Hash, KeyEqual> const& rhs);
+
+    template <class Key, class T, std::size_t N, class Hash, class KeyEqual>
+    BOOST_CXX14_CONSTEXPR bool operator!=(
+      static_flat_map<Key, T, N, Hash, KeyEqual> const& lhs,
+      static_flat_map<Key, T, N, Hash, KeyEqual> const& rhs);
+  } // namespace unordered
+
+  using boost::unordered::static_flat_map;
+} // namespace boost
+
+#endif
@@ -0,0 +1,208 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNORDERED_STATIC_FLAT_SET_HPP_INCLUDED
+#define BOOST_UNORDERED_STATIC_FLAT_SET_HPP_INCLUDED
+
+#include <boost/config.hpp>
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#pragma once
+#endif
+
+#include <boost/unordered/detail/foa/static_table.hpp>
+#include <boost/unordered/detail/type_traits.hpp>
+#include <boost/unordered/static_flat_set_fwd.hpp>
+
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+namespace boost {
+  namespace unordered {
+
+#if defined(BOOST_MSVC)
+#pragma warning(push)
+#pragma warning(disable : 4714) /* marked as __forceinline not inlined */
+#endif
+
+    template <class Key, std::size_t N, class Hash, class KeyEqual>
+    class static_flat_set
+    {
+      using set_types = detail::foa::static_set_types<Key>;
+
+      using table_type =
+        detail::foa::static_table<set_types, N, Hash, KeyEqual>;
+
+      table_type table_;
+
+      template <class K, std::size_t M, class H, class KE>
+      BOOST_CXX14_CONSTEXPR bool friend operator==(
+        static_flat_set<K, M, H, KE> const& lhs,
+        static_flat_set<K, M, H, KE> const& rhs);
+
+    public:
+      using key_type = Key;
+      using value_type = typename set_types::value_type;
+      using size_type = std::size_t;
+      using difference_type = std::ptrdiff_t;
+      using hasher = typename boost::unordered::detail::type_identity<Hash>::type;
+      using key_equal = typename boost::unordered::detail::type_identity<KeyEqual>::type;
+      using reference = value_type const&;
+      using const_reference = value_type const&;
+      using pointer = value_type const*;
+      using const_pointer = value_type const*;
+      using iterator = typename table_type::const_iterator;
+      using const_iterator = typename table_type::const_iterator;
+
+      BOOST_CXX14_CONSTEXPR static_flat_set(
+        std::initializer_list<value_type> il, hasher const& h = hasher(),
+        key_equal const& pred = key_equal())
+          : table_(il, h, pred)
+      {
+      }
+
+      /// Iterators
+      ///
+
+      constexpr const_iterator begin() const noexcept
+      {
+        return table_.begin();
+      }
+
+      constexpr const_iterator end() const noexcept { return table_.end(); }
+
+      constexpr const_iterator cbegin() const noexcept
+      {
+        return table_.begin();
+      }
+
+      constexpr const_iterator cend() const noexcept { return table_.end(); }
+
+      /// Capacity
+      ///
+
+      BOOST_ATTRIBUTE_NODISCARD constexpr bool empty() const noexcept
+      {
+        return false;
+      }
+
+      constexpr size_type size() const noexcept { return N; }
+
+      constexpr size_type max_size() const noexcept { return N; }
+
+      /// Lookup
+      ///
+
+      BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR size_type count(
+        key_type const& key) const
+      {
+        return table_.find(key) != table_.end() ? 1 : 0;
+      }
+
+      template <class K>
+      BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR typename std::enable_if<
+        detail::are_transparent<K, hasher, key_equal>::value, size_type>::type
+      count(K const& key) const
+      {
+        return table_.find(key) != table_.end() ? 1 : 0;
+      }
+
+      BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR const_iterator find(
+        key_type const& key) const
+      {
+        return table_.find(key);
+      }
+
+      template <class K>
+      BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR typename std::enable_if<
+        boost::unordered::detail::are_transparent<K, hasher, key_equal>::value,
+        const_iterator>::type
+      find(K const& key) const
+      {
+        return table_.find(key);
+      }
+
+      BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR bool contains(
+        key_type const& key) const
+      {
+        return table_.find(key) != table_.end();
+      }
+
+      template <class K>
+      BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR typename std::enable_if<
+        boost::unordered::detail::are_transparent<K, hasher, key_equal>::value,
+        bool>::type
+      contains(K const& key) const
+      {
+        return table_.find(key) != table_.end();
+      }
+
+      BOOST_CXX14_CONSTEXPR std::pair<const_iterator, const_iterator>
+      equal_range(key_type const& key) const
+      {
+        auto pos = table_.find(key);
+        if (pos == table_.end()) {
+          return {pos, pos};
+        }
+        return {pos, pos + 1};
+      }
+
+      template <class K>
+      BOOST_CXX14_CONSTEXPR typename std::enable_if<
+        detail::are_transparent<K, hasher, key_equal>::value,
+        std::pair<const_iterator, const_iterator> >::type
+      equal_range(K const& key) const
+      {
+        auto pos = table_.find(key);
+        if (pos == table_.end()) {
+          return {pos, pos};
+        }
+        return {pos, pos + 1};
+      }
+
+      /// Hash Policy
+      ///
+
+      constexpr size_type bucket_count() const noexcept
+      {
+        return table_.capacity();
+      }
+
+      constexpr float load_factor() const noexcept
+      {
+        return float(N) / float(table_.capacity());
+      }
+
+      /// Observers
+      ///
+
+      constexpr hasher hash_function() const { return table_.hash_function(); }
+
+      constexpr key_equal key_eq() const { return table_.key_eq(); }
+    };
+
+    template <class Key, std::size_t N, class Hash, class KeyEqual>
+    BOOST_CXX14_CONSTEXPR bool operator==(
+      static_flat_set<Key, N, Hash, KeyEqual> const& lhs,
+      static_flat_set<Key, N, Hash, KeyEqual> const& rhs)
+    {
+      return lhs.table_ == rhs.table_;
+    }
+
+    template <class Key, std::size_t N, class Hash, class KeyEqual>
+    BOOST_CXX14_CONSTEXPR bool operator!=(
+      static_flat_set<Key, N, Hash, KeyEqual> const& lhs,
+      static_flat_set<Key, N, Hash, KeyEqual> const& rhs)
+    {
+      return !(lhs == rhs);
+    }
+
+#if defined(BOOST_MSVC)
+#pragma warning(pop) /* C4714 */
+#endif
+
+  } // namespace unordered
+} // namespace boost
+
+#endif
@@ -0,0 +1,79 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNORDERED_STATIC_HASH_HPP_INCLUDED
+#define BOOST_UNORDERED_STATIC_HASH_HPP_INCLUDED
+
+#include <boost/config.hpp>
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#pragma once
+#endif
+
+#include <cstddef>
+#include <type_traits>
+
+#if !defined(BOOST_NO_CXX17_HDR_STRING_VIEW)
+#include <string_view>
+#endif
+
+namespace boost {
+  namespace unordered {
+    namespace detail {
+      template <class Key, class = void> struct static_hash_impl
+      {
+      };
+
+      /* integral and enumeration types hash to their own value, as
+       * static_flat_map and static_flat_set mix hash values anyway
+       */
+
+      template <class Key>
+      struct static_hash_impl<Key,
+        typename std::enable_if<std::is_integral<Key>::value ||
+                                std::is_enum<Key>::value>::type>
+      {
+        constexpr std::size_t operator()(Key x) const noexcept
+        {
+          return sizeof(Key) <= sizeof(std::size_t)
+                   ? static_cast<std::size_t>(x)
+                   : static_cast<std::size_t>(
+                       static_cast<unsigned long long>(x) ^
+                       (static_cast<unsigned long long>(x) >> 32));
+        }
+      };
+
+#if !defined(BOOST_NO_CXX17_HDR_STRING_VIEW)
+      /* 64-bit FNV-1a */
+
+      template <class Ch, class Traits>
+      struct static_hash_impl<std::basic_string_view<Ch, Traits> >
+      {
+        constexpr std::size_t operator()(
+          std::basic_string_view<Ch, Traits> x) const noexcept
+        {
+          unsigned long long h = 0xCBF29CE484222325ull;
+          for (Ch c : x) {
+            h ^= static_cast<unsigned long long>(
+              static_cast<typename std::make_unsigned<Ch>::type>(c));
+            h *= 0x100000001B3ull;
+          }
+          return static_cast<std::size_t>(h ^ (h >> 32));
+        }
+      };
+#endif
+    } // namespace detail
+
+    /* Default hash function of static_flat_map and static_flat_set, usable
+     * in constant expressions. Supports integral and enumeration types and,
+     * in C++17, std::basic_string_view.
+     */
+
+    template <class Key>
+    struct static_hash : detail::static_hash_impl<Key>
+    {
+    };
+  } // namespace unordered
+} // namespace boost
+
+#endif
@@ -12,17 +12,21 @@
 #endif
 
 #include <boost/unordered/concurrent_flat_map_fwd.hpp>
+#include <boost/unordered/detail/concurrent_static_asserts.hpp>
+#include <boost/unordered/detail/foa/bulk_serialization.hpp>
 #include <boost/unordered/detail/foa/flat_map_types.hpp>
 #include <boost/unordered/detail/foa/table.hpp>
 #include <boost/unordered/detail/serialize_container.hpp>
 #include <boost/unordered/detail/throw_exception.hpp>
 #include <boost/unordered/detail/type_traits.hpp>
+#include <boost/unordered/frozen_flat_map_fwd.hpp>
 #include <boost/unordered/unordered_flat_map_fwd.hpp>
 
 #include <boost/core/allocator_access.hpp>
 #include <boost/container_hash/hash.hpp>
 
 #include <initializer_list>
+#include <iosfwd>
 #include <iterator>
 #include <stdexcept>
 #include <type_traits>
@@ -43,6 +47,10 @@ namespace boost {
         class Allocator2>
       friend class concurrent_flat_map;
 
+      template <class Key2, class T2, class Hash2, class Pred2,
+        class Allocator2>
+      friend class frozen_flat_map;
+
       using map_types = detail::foa::flat_map_types<Key, T>;
 
       using table_type = detail::foa::table<map_types, Hash, KeyEqual,
@@ -59,6 +67,14 @@ namespace boost {
       typename unordered_flat_map<K, V, H, KE, A>::size_type friend erase_if(
         unordered_flat_map<K, V, H, KE, A>& set, Pred pred);
 
+      template <class K, class V, class H, class KE, class A>
+      friend void write_snapshot(
+        std::ostream& os, unordered_flat_map<K, V, H, KE, A> const& x);
+
+      template <class Archive, class K, class V, class H, class KE, class A>
+      friend void serialize(
+        Archive& ar, unordered_flat_map<K, V, H, KE, A>& map, unsigned int version);
+
     public:
       using key_type = Key;
       using mapped_type = T;
@@ -121,6 +137,21 @@ namespace boost {
         this->insert(first, last);
       }
 
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+      template <class ExecPolicy, class FwdIterator,
+        class = typename std::enable_if<
+          detail::is_execution_policy<ExecPolicy>::value>::type>
+      unordered_flat_map(ExecPolicy&& p, FwdIterator first, FwdIterator last,
+        size_type n = 0, hasher const& h = hasher(),
+        key_equal const& pred = key_equal(),
+        allocator_type const& a = allocator_type())
+          : unordered_flat_map(n, h, pred, a)
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_EXEC_POLICY(ExecPolicy)
+        table_.insert(p, first, last);
+      }
+#endif
+
       template <class Iterator>
       unordered_flat_map(
         Iterator first, Iterator last, size_type n, allocator_type const& a)
@@ -145,6 +176,17 @@ namespace boost {
       {
       }
 
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+      template <class ExecPolicy,
+        class = typename std::enable_if<
+          detail::is_execution_policy<ExecPolicy>::value>::type>
+      unordered_flat_map(ExecPolicy&& p, unordered_flat_map const& other)
+          : table_(p, other.table_)
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_EXEC_POLICY(ExecPolicy)
+      }
+#endif
+
       unordered_flat_map(unordered_flat_map&& other)
         noexcept(std::is_nothrow_move_constructible<table_type>::value)
           : table_(std::move(other.table_))
@@ -210,6 +252,17 @@ namespace boost {
         return *this;
       }
 
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+      template <class ExecPolicy>
+      typename std::enable_if<detail::is_execution_policy<ExecPolicy>::value,
+        void>::type
+      assign(ExecPolicy&& p, unordered_flat_map const& other)
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_EXEC_POLICY(ExecPolicy)
+        table_.assign(p, other.table_);
+      }
+#endif
+
       allocator_type get_allocator() const noexcept
       {
         return table_.get_allocator();
@@ -270,11 +323,20 @@ namespace boost {
       template <class InputIterator>
       BOOST_FORCEINLINE void insert(InputIterator first, InputIterator last)
       {
-        for (auto pos = first; pos != last; ++pos) {
-          table_.emplace(*pos);
-        }
+        table_.insert(first, last);
       }
 
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+      template <class ExecPolicy, class FwdIterator>
+      typename std::enable_if<detail::is_execution_policy<ExecPolicy>::value,
+        void>::type
+      insert(ExecPolicy&& p, FwdIterator first, FwdIterator last)
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_EXEC_POLICY(ExecPolicy)
+        table_.insert(p, first, last);
+      }
+#endif
+
       void insert(std::initializer_list<value_type> ilist)
       {
         this->insert(ilist.begin(), ilist.end());
@@ -376,6 +438,31 @@ namespace boost {
           std::forward<K>(key), std::forward<Args>(args)...);
       }
 
+      template <class... Args>
+      BOOST_FORCEINLINE std::pair<iterator, bool> try_emplace(
+        prehashed ph, key_type const& key, Args&&... args)
+      {
+        return table_.try_emplace(ph, key, std::forward<Args>(args)...);
+      }
+
+      template <class... Args>
+      BOOST_FORCEINLINE std::pair<iterator, bool> try_emplace(
+        prehashed ph, key_type&& key, Args&&... args)
+      {
+        return table_.try_emplace(
+          ph, std::move(key), std::forward<Args>(args)...);
+      }
+
+      template <class K, class... Args>
+      BOOST_FORCEINLINE typename std::enable_if<
+        boost::unordered::detail::are_transparent<K, hasher, key_equal>::value,
+        std::pair<iterator, bool> >::type
+      try_emplace(prehashed ph, K&& key, Args&&... args)
+      {
+        return table_.try_emplace(
+          ph, std::forward<K>(key), std::forward<Args>(args)...);
+      }
+
       template <class... Args>
       BOOST_FORCEINLINE iterator try_emplace(
         const_iterator, key_type const& key, Args&&... args)
@@ -589,6 +676,117 @@ namespace boost {
         return this->find(key) != this->end();
       }
 
+      BOOST_FORCEINLINE iterator find(prehashed ph, key_type const& key)
+      {
+        return table_.find(ph, key);
+      }
+
+      BOOST_FORCEINLINE const_iterator find(
+        prehashed ph, key_type const& key) const
+      {
+        return table_.find(ph, key);
+      }
+
+      template <class K>
+      BOOST_FORCEINLINE typename std::enable_if<
+        boost::unordered::detail::are_transparent<K, hasher, key_equal>::value,
+        iterator>::type
+      find(prehashed ph, K const& key)
+      {
+        return table_.find(ph, key);
+      }
+
+      template <class K>
+      BOOST_FORCEINLINE typename std::enable_if<
+        boost::unordered::detail::are_transparent<K, hasher, key_equal>::value,
+        const_iterator>::type
+      find(prehashed ph, K const& key) const
+      {
+        return table_.find(ph, key);
+      }
+
+      BOOST_FORCEINLINE bool contains(prehashed ph, key_type const& key) const
+      {
+        return this->find(ph, key) != this->end();
+      }
+
+      template <class K>
+      BOOST_FORCEINLINE typename std::enable_if<
+        boost::unordered::detail::are_transparent<K, hasher, key_equal>::value,
+        bool>::type
+      contains(prehashed ph, K const& key) const
+      {
+        return this->find(ph, key) != this->end();
+      }
+
+      template <class FwdIterator, class OutputIterator>
+      BOOST_FORCEINLINE OutputIterator find_many(
+        FwdIterator first, FwdIterator last, OutputIterator out)
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_BULK_VISIT_ITERATOR(FwdIterator)
+        table_.find_many(first, last, [&](iterator it) { *out++ = it; });
+        return out;
+      }
+
+      template <class FwdIterator, class OutputIterator>
+      BOOST_FORCEINLINE OutputIterator find_many(
+        FwdIterator first, FwdIterator last, OutputIterator out) const
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_BULK_VISIT_ITERATOR(FwdIterator)
+        table_.find_many(
+          first, last, [&](const_iterator it) { *out++ = it; });
+        return out;
+      }
+
+      template <class FwdIterator, class OutputIterator>
+      BOOST_FORCEINLINE OutputIterator contains_many(
+        FwdIterator first, FwdIterator last, OutputIterator out) const
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_BULK_VISIT_ITERATOR(FwdIterator)
+        table_.find_many(first, last,
+          [&](const_iterator it) { *out++ = (it != this->end()); });
+        return out;
+      }
+
+      template <class FwdIterator, class F>
+      BOOST_FORCEINLINE size_type visit(
+        FwdIterator first, FwdIterator last, F f)
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_BULK_VISIT_ITERATOR(FwdIterator)
+        BOOST_UNORDERED_STATIC_ASSERT_INVOCABLE(F)
+        size_type res = 0;
+        table_.find_many(first, last, [&](iterator it) {
+          if (it != this->end()) {
+            f(*it);
+            ++res;
+          }
+        });
+        return res;
+      }
+
+      template <class FwdIterator, class F>
+      BOOST_FORCEINLINE size_type visit(
+        FwdIterator first, FwdIterator last, F f) const
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_BULK_VISIT_ITERATOR(FwdIterator)
+        BOOST_UNORDERED_STATIC_ASSERT_CONST_INVOCABLE(F)
+        size_type res = 0;
+        table_.find_many(first, last, [&](const_iterator it) {
+          if (it != this->end()) {
+            f(*it);
+            ++res;
+          }
+        });
+        return res;
+      }
+
+      template <class FwdIterator, class F>
+      BOOST_FORCEINLINE size_type cvisit(
+        FwdIterator first, FwdIterator last, F f) const
+      {
+        return this->visit(first, last, f);
+      }
+
       std::pair<iterator, iterator> equal_range(key_type const& key)
       {
         auto pos = table_.find(key);
@@ -658,7 +856,7 @@ namespace boost {
         return table_.max_load_factor();
       }
 
-      void max_load_factor(float) {}
+      void max_load_factor(float z) { table_.max_load_factor(z); }
 
       size_type max_load() const noexcept { return table_.max_load(); }
 
@@ -666,6 +864,40 @@ namespace boost {
 
       void reserve(size_type n) { table_.reserve(n); }
 
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+      template <class ExecPolicy>
+      typename std::enable_if<detail::is_execution_policy<ExecPolicy>::value,
+        void>::type
+      rehash(ExecPolicy&& p, size_type n)
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_EXEC_POLICY(ExecPolicy)
+        table_.rehash(p, n);
+      }
+
+      template <class ExecPolicy>
+      typename std::enable_if<detail::is_execution_policy<ExecPolicy>::value,
+        void>::type
+      reserve(ExecPolicy&& p, size_type n)
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_EXEC_POLICY(ExecPolicy)
+        table_.reserve(p, n);
+      }
+#endif
+
+      void compact() { table_.compact(); }
+
+      void prefault() { table_.prefault(); }
+
+      bool incremental_rehash() const noexcept
+      {
+        return table_.incremental_rehash();
+      }
+
+      void incremental_rehash(bool enable)
+      {
+        table_.incremental_rehash(enable);
+      }
+
 #if defined(BOOST_UNORDERED_ENABLE_STATS)
       /// Stats
       ///
@@ -679,6 +911,20 @@ namespace boost {
 
       hasher hash_function() const { return table_.hash_function(); }
 
+      prehashed prehash(key_type const& key) const
+      {
+        return table_.prehash(key);
+      }
+
+      template <class K>
+      typename std::enable_if<
+        boost::unordered::detail::are_transparent<K, hasher, key_equal>::value,
+        prehashed>::type
+      prehash(K const& key) const
+      {
+        return table_.prehash(key);
+      }
+
       key_equal key_eq() const { return table_.key_eq(); }
     };
 
@@ -721,7 +967,7 @@ namespace boost {
       unordered_flat_map<Key, T, Hash, KeyEqual, Allocator>& map,
       unsigned int version)
     {
-      detail::serialize_container(ar, map, version);
+      detail::foa::serialize_flat_container(ar, map, map.table_, version);
     }
 
 #if defined(BOOST_MSVC)
@@ -815,6 +1061,16 @@ namespace boost {
 #endif
 
   } // namespace unordered
+
+  namespace serialization {
+    template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+    struct version<
+      boost::unordered::unordered_flat_map<Key, T, Hash, KeyEqual, Allocator> >
+    {
+      BOOST_STATIC_CONSTANT(int,
+        value = boost::unordered::detail::foa::bulk_serialization_version);
+    };
+  } // namespace serialization
 } // namespace boost
 
 #endif
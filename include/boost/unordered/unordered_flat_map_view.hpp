@@ -0,0 +1,185 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNORDERED_UNORDERED_FLAT_MAP_VIEW_HPP_INCLUDED
+#define BOOST_UNORDERED_UNORDERED_FLAT_MAP_VIEW_HPP_INCLUDED
+
+#include <boost/config.hpp>
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#pragma once
+#endif
+
+#include <boost/unordered/detail/foa/flat_map_types.hpp>
+#include <boost/unordered/detail/foa/snapshot.hpp>
+#include <boost/unordered/detail/static_assert.hpp>
+#include <boost/unordered/detail/throw_exception.hpp>
+#include <boost/unordered/detail/type_traits.hpp>
+#include <boost/unordered/unordered_flat_map.hpp>
+
+#include <boost/container_hash/hash.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <type_traits>
+
+namespace boost {
+  namespace unordered {
+
+    template <class Key, class T, class Hash = boost::hash<Key>,
+      class KeyEqual = std::equal_to<Key> >
+    class unordered_flat_map_view
+    {
+      BOOST_UNORDERED_STATIC_ASSERT(std::is_trivially_copyable<Key>::value &&
+                                    std::is_trivially_copyable<T>::value);
+
+      using map_types = detail::foa::flat_map_types<Key, T>;
+
+      using view_type = detail::foa::flat_view<map_types, Hash, KeyEqual>;
+
+      view_type view_;
+
+    public:
+      using key_type = Key;
+      using mapped_type = T;
+      using value_type = typename map_types::value_type;
+      using size_type = std::size_t;
+      using difference_type = std::ptrdiff_t;
+      using hasher = typename boost::unordered::detail::type_identity<Hash>::type;
+      using key_equal = typename boost::unordered::detail::type_identity<KeyEqual>::type;
+      using reference = value_type const&;
+      using const_reference = value_type const&;
+      using pointer = value_type const*;
+      using const_pointer = value_type const*;
+      using iterator = typename view_type::const_iterator;
+      using const_iterator = typename view_type::const_iterator;
+
+      unordered_flat_map_view(void const* data, size_type n,
+        hasher const& h = hasher(), key_equal const& pred = key_equal())
+          : view_(data, n, h, pred)
+      {
+      }
+
+      /// Iterators
+      ///
+
+      const_iterator begin() const noexcept { return view_.begin(); }
+      const_iterator end() const noexcept { return view_.end(); }
+      const_iterator cbegin() const noexcept { return view_.begin(); }
+      const_iterator cend() const noexcept { return view_.end(); }
+
+      /// Capacity
+      ///
+
+      BOOST_ATTRIBUTE_NODISCARD bool empty() const noexcept
+      {
+        return view_.empty();
+      }
+
+      size_type size() const noexcept { return view_.size(); }
+
+      /// Lookup
+      ///
+
+      mapped_type const& at(key_type const& key) const
+      {
+        auto pos = view_.find(key);
+        if (pos != view_.end()) {
+          return pos->second;
+        }
+        boost::unordered::detail::throw_out_of_range(
+          "key was not found in unordered_flat_map_view");
+      }
+
+      template <class K>
+      typename std::enable_if<
+        boost::unordered::detail::are_transparent<K, hasher, key_equal>::value,
+        mapped_type const&>::type
+      at(K const& key) const
+      {
+        auto pos = view_.find(key);
+        if (pos != view_.end()) {
+          return pos->second;
+        }
+        boost::unordered::detail::throw_out_of_range(
+          "key was not found in unordered_flat_map_view");
+      }
+
+      BOOST_FORCEINLINE size_type count(key_type const& key) const
+      {
+        return view_.find(key) != view_.end() ? 1 : 0;
+      }
+
+      template <class K>
+      BOOST_FORCEINLINE typename std::enable_if<
+        detail::are_transparent<K, hasher, key_equal>::value, size_type>::type
+      count(K const& key) const
+      {
+        return view_.find(key) != view_.end() ? 1 : 0;
+      }
+
+      BOOST_FORCEINLINE const_iterator find(key_type const& key) const
+      {
+        return view_.find(key);
+      }
+
+      template <class K>
+      BOOST_FORCEINLINE typename std::enable_if<
+        boost::unordered::detail::are_transparent<K, hasher, key_equal>::value,
+        const_iterator>::type
+      find(K const& key) const
+      {
+        return view_.find(key);
+      }
+
+      BOOST_FORCEINLINE bool contains(key_type const& key) const
+      {
+        return view_.find(key) != view_.end();
+      }
+
+      template <class K>
+      BOOST_FORCEINLINE typename std::enable_if<
+        boost::unordered::detail::are_transparent<K, hasher, key_equal>::value,
+        bool>::type
+      contains(K const& key) const
+      {
+        return view_.find(key) != view_.end();
+      }
+
+      /// Hash Policy
+      ///
+
+      size_type bucket_count() const noexcept { return view_.capacity(); }
+
+      float load_factor() const noexcept
+      {
+        return view_.capacity() == 0
+                 ? 0.0f
+                 : float(view_.size()) / float(view_.capacity());
+      }
+
+      /// Observers
+      ///
+
+      hasher hash_function() const { return view_.hash_function(); }
+
+      key_equal key_eq() const { return view_.key_eq(); }
+    };
+
+    template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+    void write_snapshot(std::ostream& os,
+      unordered_flat_map<Key, T, Hash, KeyEqual, Allocator> const& x)
+    {
+      BOOST_UNORDERED_STATIC_ASSERT(std::is_trivially_copyable<Key>::value &&
+                                    std::is_trivially_copyable<T>::value);
+
+      detail::foa::write_snapshot(os, x.table_);
+    }
+
+  } // namespace unordered
+
+  using unordered::unordered_flat_map_view;
+} // namespace boost
+
+#endif
@@ -12,6 +12,7 @@
 #endif
 
 #include <boost/unordered/concurrent_node_map_fwd.hpp>
+#include <boost/unordered/detail/concurrent_static_asserts.hpp>
 #include <boost/unordered/detail/foa/node_map_handle.hpp>
 #include <boost/unordered/detail/foa/node_map_types.hpp>
 #include <boost/unordered/detail/foa/table.hpp>
@@ -128,6 +129,21 @@ namespace boost {
         this->insert(first, last);
       }
 
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+      template <class ExecPolicy, class FwdIterator,
+        class = typename std::enable_if<
+          detail::is_execution_policy<ExecPolicy>::value>::type>
+      unordered_node_map(ExecPolicy&& p, FwdIterator first, FwdIterator last,
+        size_type n = 0, hasher const& h = hasher(),
+        key_equal const& pred = key_equal(),
+        allocator_type const& a = allocator_type())
+          : unordered_node_map(n, h, pred, a)
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_EXEC_POLICY(ExecPolicy)
+        table_.insert(p, first, last);
+      }
+#endif
+
       template <class Iterator>
       unordered_node_map(
         Iterator first, Iterator last, size_type n, allocator_type const& a)
@@ -152,6 +168,17 @@ namespace boost {
       {
       }
 
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+      template <class ExecPolicy,
+        class = typename std::enable_if<
+          detail::is_execution_policy<ExecPolicy>::value>::type>
+      unordered_node_map(ExecPolicy&& p, unordered_node_map const& other)
+          : table_(p, other.table_)
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_EXEC_POLICY(ExecPolicy)
+      }
+#endif
+
       unordered_node_map(unordered_node_map&& other)
         noexcept(std::is_nothrow_move_constructible<table_type>::value)
           : table_(std::move(other.table_))
@@ -217,6 +244,17 @@ namespace boost {
         return *this;
       }
 
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+      template <class ExecPolicy>
+      typename std::enable_if<detail::is_execution_policy<ExecPolicy>::value,
+        void>::type
+      assign(ExecPolicy&& p, unordered_node_map const& other)
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_EXEC_POLICY(ExecPolicy)
+        table_.assign(p, other.table_);
+      }
+#endif
+
       allocator_type get_allocator() const noexcept
       {
         return table_.get_allocator();
@@ -277,11 +315,20 @@ namespace boost {
       template <class InputIterator>
       BOOST_FORCEINLINE void insert(InputIterator first, InputIterator last)
       {
-        for (auto pos = first; pos != last; ++pos) {
-          table_.emplace(*pos);
-        }
+        table_.insert(first, last);
       }
 
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+      template <class ExecPolicy, class FwdIterator>
+      typename std::enable_if<detail::is_execution_policy<ExecPolicy>::value,
+        void>::type
+      insert(ExecPolicy&& p, FwdIterator first, FwdIterator last)
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_EXEC_POLICY(ExecPolicy)
+        table_.insert(p, first, last);
+      }
+#endif
+
       void insert(std::initializer_list<value_type> ilist)
       {
         this->insert(ilist.begin(), ilist.end());
@@ -421,6 +468,31 @@ namespace boost {
           std::forward<K>(key), std::forward<Args>(args)...);
       }
 
+      template <class... Args>
+      BOOST_FORCEINLINE std::pair<iterator, bool> try_emplace(
+        prehashed ph, key_type const& key, Args&&... args)
+      {
+        return table_.try_emplace(ph, key, std::forward<Args>(args)...);
+      }
+
+      template <class... Args>
+      BOOST_FORCEINLINE std::pair<iterator, bool> try_emplace(
+        prehashed ph, key_type&& key, Args&&... args)
+      {
+        return table_.try_emplace(
+          ph, std::move(key), std::forward<Args>(args)...);
+      }
+
+      template <class K, class... Args>
+      BOOST_FORCEINLINE typename std::enable_if<
+        boost::unordered::detail::are_transparent<K, hasher, key_equal>::value,
+        std::pair<iterator, bool> >::type
+      try_emplace(prehashed ph, K&& key, Args&&... args)
+      {
+        return table_.try_emplace(
+          ph, std::forward<K>(key), std::forward<Args>(args)...);
+      }
+
       template <class... Args>
       BOOST_FORCEINLINE iterator try_emplace(
         const_iterator, key_type const& key, Args&&... args)
@@ -663,6 +735,117 @@ namespace boost {
         return this->find(key) != this->end();
       }
 
+      BOOST_FORCEINLINE iterator find(prehashed ph, key_type const& key)
+      {
+        return table_.find(ph, key);
+      }
+
+      BOOST_FORCEINLINE const_iterator find(
+        prehashed ph, key_type const& key) const
+      {
+        return table_.find(ph, key);
+      }
+
+      template <class K>
+      BOOST_FORCEINLINE typename std::enable_if<
+        boost::unordered::detail::are_transparent<K, hasher, key_equal>::value,
+        iterator>::type
+      find(prehashed ph, K const& key)
+      {
+        return table_.find(ph, key);
+      }
+
+      template <class K>
+      BOOST_FORCEINLINE typename std::enable_if<
+        boost::unordered::detail::are_transparent<K, hasher, key_equal>::value,
+        const_iterator>::type
+      find(prehashed ph, K const& key) const
+      {
+        return table_.find(ph, key);
+      }
+
+      BOOST_FORCEINLINE bool contains(prehashed ph, key_type const& key) const
+      {
+        return this->find(ph, key) != this->end();
+      }
+
+      template <class K>
+      BOOST_FORCEINLINE typename std::enable_if<
+        boost::unordered::detail::are_transparent<K, hasher, key_equal>::value,
+        bool>::type
+      contains(prehashed ph, K const& key) const
+      {
+        return this->find(ph, key) != this->end();
+      }
+
+      template <class FwdIterator, class OutputIterator>
+      BOOST_FORCEINLINE OutputIterator find_many(
+        FwdIterator first, FwdIterator last, OutputIterator out)
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_BULK_VISIT_ITERATOR(FwdIterator)
+        table_.find_many(first, last, [&](iterator it) { *out++ = it; });
+        return out;
+      }
+
+      template <class FwdIterator, class OutputIterator>
+      BOOST_FORCEINLINE OutputIterator find_many(
+        FwdIterator first, FwdIterator last, OutputIterator out) const
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_BULK_VISIT_ITERATOR(FwdIterator)
+        table_.find_many(
+          first, last, [&](const_iterator it) { *out++ = it; });
+        return out;
+      }
+
+      template <class FwdIterator, class OutputIterator>
+      BOOST_FORCEINLINE OutputIterator contains_many(
+        FwdIterator first, FwdIterator last, OutputIterator out) const
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_BULK_VISIT_ITERATOR(FwdIterator)
+        table_.find_many(first, last,
+          [&](const_iterator it) { *out++ = (it != this->end()); });
+        return out;
+      }
+
+      template <class FwdIterator, class F>
+      BOOST_FORCEINLINE size_type visit(
+        FwdIterator first, FwdIterator last, F f)
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_BULK_VISIT_ITERATOR(FwdIterator)
+        BOOST_UNORDERED_STATIC_ASSERT_INVOCABLE(F)
+        size_type res = 0;
+        table_.find_many(first, last, [&](iterator it) {
+          if (it != this->end()) {
+            f(*it);
+            ++res;
+          }
+        });
+        return res;
+      }
+
+      template <class FwdIterator, class F>
+      BOOST_FORCEINLINE size_type visit(
+        FwdIterator first, FwdIterator last, F f) const
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_BULK_VISIT_ITERATOR(FwdIterator)
+        BOOST_UNORDERED_STATIC_ASSERT_CONST_INVOCABLE(F)
+        size_type res = 0;
+        table_.find_many(first, last, [&](const_iterator it) {
+          if (it != this->end()) {
+            f(*it);
+            ++res;
+          }
+        });
+        return res;
+      }
+
+      template <class FwdIterator, class F>
+      BOOST_FORCEINLINE size_type cvisit(
+        FwdIterator first, FwdIterator last, F f) const
+      {
+        return this->visit(first, last, f);
+      }
+
       std::pair<iterator, iterator> equal_range(key_type const& key)
       {
         auto pos = table_.find(key);
@@ -732,7 +915,7 @@ namespace boost {
         return table_.max_load_factor();
       }
 
-      void max_load_factor(float) {}
+      void max_load_factor(float z) { table_.max_load_factor(z); }
 
       size_type max_load() const noexcept { return table_.max_load(); }
 
@@ -740,6 +923,40 @@ namespace boost {
 
       void reserve(size_type n) { table_.reserve(n); }
 
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+      template <class ExecPolicy>
+      typename std::enable_if<detail::is_execution_policy<ExecPolicy>::value,
+        void>::type
+      rehash(ExecPolicy&& p, size_type n)
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_EXEC_POLICY(ExecPolicy)
+        table_.rehash(p, n);
+      }
+
+      template <class ExecPolicy>
+      typename std::enable_if<detail::is_execution_policy<ExecPolicy>::value,
+        void>::type
+      reserve(ExecPolicy&& p, size_type n)
+      {
+        BOOST_UNORDERED_STATIC_ASSERT_EXEC_POLICY(ExecPolicy)
+        table_.reserve(p, n);
+      }
+#endif
+
+      void compact() { table_.compact(); }
+
+      void prefault() { table_.prefault(); }
+
+      bool incremental_rehash() const noexcept
+      {
+        return table_.incremental_rehash();
+      }
+
+      void incremental_rehash(bool enable)
+      {
+        table_.incremental_rehash(enable);
+      }
+
 #if defined(BOOST_UNORDERED_ENABLE_STATS)
       /// Stats
       ///
@@ -753,6 +970,20 @@ namespace boost {
 
       hasher hash_function() const { return table_.hash_function(); }
 
+      prehashed prehash(key_type const& key) const
+      {
+        return table_.prehash(key);
+      }
+
+      template <class K>
+      typename std::enable_if<
+        boost::unordered::detail::are_transparent<K, hasher, key_equal>::value,
+        prehashed>::type
+      prehash(K const& key) const
+      {
+        return table_.prehash(key);
+      }
+
       key_equal key_eq() const { return table_.key_eq(); }
     };
 
@@ -2,7 +2,7 @@
 // Distributed under the Boost Software License, Version 1.0.
 // https://www.boost.org/LICENSE_1_0.txt
 
-// Generated on 2024-08-25T17:48:54
+// Generated on 2026-10-17T12:00:00
 
 #ifndef BOOST_UNORDERED_UNORDERED_PRINTERS_HPP
 #define BOOST_UNORDERED_UNORDERED_PRINTERS_HPP
@@ -214,22 +214,15 @@ __asm__(".pushsection \".debug_gdb_scripts\", \"MS\",@progbits,1\n"
         ".ascii \"    def children(self):\\n\"\n"
         ".ascii \"        def generator():\\n\"\n"
         ".ascii \"            table = self.val[\\\"table_\\\"]\\n\"\n"
-        ".ascii \"            groups = self.cpo.to_address(table[\\\"arrays\\\"][\\\"groups_\\\"])\\n\"\n"
-        ".ascii \"            elements = self.cpo.to_address(table[\\\"arrays\\\"][\\\"elements_\\\"])\\n\"\n"
 
-        ".ascii \"            pc_ = groups.cast(gdb.lookup_type(\\\"unsigned char\\\").pointer())\\n\"\n"
-        ".ascii \"            p_ = elements\\n\"\n"
-        ".ascii \"            first_time = True\\n\"\n"
-        ".ascii \"            mask = 0\\n\"\n"
-        ".ascii \"            n0 = 0\\n\"\n"
-        ".ascii \"            n = 0\\n\"\n"
+        ".ascii \"            # Elements not yet transferred by an incremental rehash are in old_arrays\\n\"\n"
+        ".ascii \"            all_arrays = [table[\\\"arrays\\\"]]\\n\"\n"
+        ".ascii \"            if self.cpo.to_address(table[\\\"old_arrays\\\"][\\\"elements_\\\"]) != 0:\\n\"\n"
+        ".ascii \"                all_arrays.insert(0, table[\\\"old_arrays\\\"])\\n\"\n"
 
         ".ascii \"            count = 0\\n\"\n"
-        ".ascii \"            while p_ != 0:\\n\"\n"
-        ".ascii \"                # This if block mirrors the condition in the begin() call\\n\"\n"
-        ".ascii \"                if (not first_time) or (self.match_occupied(groups.dereference()) & 1):\\n\"\n"
-        ".ascii \"                    pointer = BoostUnorderedHelpers.maybe_unwrap_foa_element(p_)\\n\"\n"
-        ".ascii \"                    value = self.cpo.to_address(pointer).dereference()\\n\"\n"
+        ".ascii \"            for arrays in all_arrays:\\n\"\n"
+        ".ascii \"                for value in self.elements(arrays):\\n\"\n"
         ".ascii \"                    if self.is_map:\\n\"\n"
         ".ascii \"                        first = value[\\\"first\\\"]\\n\"\n"
         ".ascii \"                        second = value[\\\"second\\\"]\\n\"\n"
@@ -239,6 +232,26 @@ __asm__(".pushsection \".debug_gdb_scripts\", \"MS\",@progbits,1\n"
         ".ascii \"                        yield \\\"\\\", count\\n\"\n"
         ".ascii \"                        yield \\\"\\\", value\\n\"\n"
         ".ascii \"                    count += 1\\n\"\n"
+
+        ".ascii \"        return generator()\\n\"\n"
+
+        ".ascii \"    def elements(self, arrays):\\n\"\n"
+        ".ascii \"        def generator():\\n\"\n"
+        ".ascii \"            groups = self.cpo.to_address(arrays[\\\"groups_\\\"])\\n\"\n"
+        ".ascii \"            elements = self.cpo.to_address(arrays[\\\"elements_\\\"])\\n\"\n"
+
+        ".ascii \"            pc_ = groups.cast(gdb.lookup_type(\\\"unsigned char\\\").pointer())\\n\"\n"
+        ".ascii \"            p_ = elements\\n\"\n"
+        ".ascii \"            first_time = True\\n\"\n"
+        ".ascii \"            mask = 0\\n\"\n"
+        ".ascii \"            n0 = 0\\n\"\n"
+        ".ascii \"            n = 0\\n\"\n"
+
+        ".ascii \"            while p_ != 0:\\n\"\n"
+        ".ascii \"                # This if block mirrors the condition in the begin() call\\n\"\n"
+        ".ascii \"                if (not first_time) or (self.match_occupied(groups.dereference()) & 1):\\n\"\n"
+        ".ascii \"                    pointer = BoostUnorderedHelpers.maybe_unwrap_foa_element(p_)\\n\"\n"
+        ".ascii \"                    yield self.cpo.to_address(pointer).dereference()\\n\"\n"
         ".ascii \"                first_time = False\\n\"\n"
 
         ".ascii \"                n0 = pc_.cast(gdb.lookup_type(\\\"uintptr_t\\\")) % groups.dereference().type.sizeof\\n\"\n"
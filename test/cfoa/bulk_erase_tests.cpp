@@ -0,0 +1,201 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "helpers.hpp"
+
+#include "../helpers/int_keys.hpp"
+
+#include <boost/unordered/concurrent_flat_map.hpp>
+#include <boost/unordered/concurrent_flat_set.hpp>
+#include <boost/unordered/concurrent_node_map.hpp>
+#include <boost/unordered/concurrent_node_set.hpp>
+
+#include <atomic>
+#include <list>
+#include <thread>
+#include <vector>
+
+namespace {
+  using test::insert_key;
+
+  template <class X> void fill(X& x, int n)
+  {
+    for (int i = 0; i < n; ++i) {
+      insert_key(x, i);
+    }
+  }
+
+  template <class V> int key_of(V const& x) { return x.first; }
+  int key_of(int x) { return x; }
+
+  std::vector<int> keys(int first, int last, int step = 1)
+  {
+    std::vector<int> res;
+    for (int k = first; k < last; k += step) {
+      res.push_back(k);
+    }
+    return res;
+  }
+
+  template <class X> std::size_t count_all(X const& x)
+  {
+    std::size_t n = 0;
+    x.cvisit_all([&](typename X::value_type const&) { ++n; });
+    return n;
+  }
+
+  template <class X> void sequential_tests()
+  {
+    using value_type = typename X::value_type;
+
+    {
+      // empty ranges, ranges shorter and longer than bulk_visit_size
+
+      X x;
+      fill(x, 1000);
+      auto v = keys(0, 0);
+      BOOST_TEST_EQ(x.erase(v.begin(), v.end()), 0u);
+      int first = 0;
+      for (int n : {1, 5, 16, 31, 32, 33, 100}) {
+        v = keys(first, first + n);
+        BOOST_TEST_EQ(
+          x.erase(v.begin(), v.end()), static_cast<std::size_t>(n));
+        BOOST_TEST_EQ(x.erase(v.begin(), v.end()), 0u);
+        for (int i = first; i < first + n; ++i) {
+          BOOST_TEST(!x.contains(i));
+        }
+        first += n;
+      }
+      BOOST_TEST_EQ(x.size(), static_cast<std::size_t>(1000 - first));
+      BOOST_TEST_EQ(count_all(x), x.size());
+      for (int i = first; i < 1000; ++i) {
+        BOOST_TEST(x.contains(i));
+      }
+    }
+    {
+      // absent keys and repeated keys are erased at most once
+
+      X x;
+      fill(x, 1000);
+      auto v = keys(0, 2000, 2);
+      auto w = keys(0, 2000, 2);
+      v.insert(v.end(), w.begin(), w.end());
+      BOOST_TEST_EQ(x.erase(v.begin(), v.end()), 500u);
+      BOOST_TEST_EQ(x.size(), 500u);
+      BOOST_TEST_EQ(count_all(x), 500u);
+      for (int i = 0; i < 1000; ++i) {
+        BOOST_TEST_EQ(x.contains(i), i % 2 != 0);
+      }
+    }
+    {
+      // predicate is invoked on each element found
+
+      X x;
+      fill(x, 1000);
+      auto v = keys(0, 1000);
+      std::size_t num_invocations = 0;
+      BOOST_TEST_EQ(x.erase_if(v.begin(), v.end(),
+                      [&](value_type const& y) {
+                        ++num_invocations;
+                        return key_of(y) % 3 == 0;
+                      }),
+        334u);
+      BOOST_TEST_EQ(num_invocations, 1000u);
+      BOOST_TEST_EQ(x.size(), 666u);
+      for (int i = 0; i < 1000; ++i) {
+        BOOST_TEST_EQ(x.contains(i), i % 3 != 0);
+      }
+    }
+    {
+      // non-random access iterators
+
+      X x;
+      fill(x, 100);
+      std::list<int> l;
+      for (int i = 0; i < 200; ++i) {
+        l.push_back(i);
+      }
+      BOOST_TEST_EQ(x.erase(l.begin(), l.end()), 100u);
+      BOOST_TEST(x.empty());
+    }
+    {
+      // erasure while an incremental rehash is in progress
+
+      X x;
+      x.incremental_rehash(true);
+      int n = 0;
+      for (auto capacity = x.bucket_count();
+           x.bucket_count() == capacity || n < 1000; ++n) {
+        insert_key(x, n);
+      }
+      for (auto capacity = x.bucket_count(); x.bucket_count() == capacity;
+           ++n) {
+        insert_key(x, n);
+      }
+      insert_key(x, n++);
+      auto v = keys(0, n, 2);
+      BOOST_TEST_EQ(x.erase(v.begin(), v.end()), v.size());
+      BOOST_TEST_EQ(x.size(), static_cast<std::size_t>(n) - v.size());
+      BOOST_TEST_EQ(count_all(x), x.size());
+      for (int i = 0; i < n; ++i) {
+        BOOST_TEST_EQ(x.contains(i), i % 2 != 0);
+      }
+    }
+  }
+
+  // Threads erase overlapping ranges: each key is erased exactly once.
+
+  template <class X> void concurrent_tests()
+  {
+    for (int n : {64, 100000}) {
+      std::size_t const nt = num_threads;
+      auto v = keys(0, n);
+
+      X x;
+      fill(x, n);
+      std::atomic<std::size_t> erased{0};
+      std::vector<std::thread> threads;
+      for (std::size_t t = 0; t < nt; ++t) {
+        threads.emplace_back([&, t] {
+          // start at different points so that threads meet
+
+          auto mid = v.begin() + static_cast<std::ptrdiff_t>(
+                                   t * v.size() / nt);
+          erased += x.erase(mid, v.end());
+          erased += x.erase(v.begin(), mid);
+        });
+      }
+      for (auto& th : threads) {
+        th.join();
+      }
+
+      BOOST_TEST_EQ(erased.load(), static_cast<std::size_t>(n));
+      BOOST_TEST_EQ(x.size(), 0u);
+      BOOST_TEST_EQ(count_all(x), 0u);
+    }
+  }
+
+  using flat_map_type = boost::concurrent_flat_map<int, int>;
+  using flat_set_type = boost::concurrent_flat_set<int>;
+  using node_map_type = boost::concurrent_node_map<int, int>;
+  using node_set_type = boost::concurrent_node_set<int>;
+} // namespace
+
+// clang-format off
+UNORDERED_AUTO_TEST (bulk_erase) {
+  sequential_tests<flat_map_type>();
+  sequential_tests<flat_set_type>();
+  sequential_tests<node_map_type>();
+  sequential_tests<node_set_type>();
+}
+
+UNORDERED_AUTO_TEST (bulk_erase_concurrent) {
+  concurrent_tests<flat_map_type>();
+  concurrent_tests<flat_set_type>();
+  concurrent_tests<node_map_type>();
+  concurrent_tests<node_set_type>();
+}
+// clang-format on
+
+RUN_TESTS()
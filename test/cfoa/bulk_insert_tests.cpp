@@ -0,0 +1,212 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "helpers.hpp"
+
+#include <boost/unordered/concurrent_flat_map.hpp>
+#include <boost/unordered/concurrent_flat_set.hpp>
+#include <boost/unordered/concurrent_node_map.hpp>
+#include <boost/unordered/concurrent_node_set.hpp>
+
+#include <atomic>
+#include <list>
+#include <thread>
+#include <vector>
+
+namespace {
+  template <class X> struct values_of
+  {
+    using value_type = typename X::value_type;
+    using init_type = typename X::init_type;
+
+    static init_type make(int k, std::true_type /* map */)
+    {
+      return {k, k};
+    }
+
+    static init_type make(int k, std::false_type /* set */) { return k; }
+
+    static init_type make(int k)
+    {
+      return make(k, std::integral_constant<bool,
+                       !std::is_same<typename X::key_type,
+                         typename X::value_type>::value>{});
+    }
+
+    static std::vector<init_type> range(int first, int last, int step = 1)
+    {
+      std::vector<init_type> res;
+      for (int k = first; k < last; k += step) {
+        res.push_back(make(k));
+      }
+      return res;
+    }
+  };
+
+  template <class V> int key_of(V const& x) { return x.first; }
+  int key_of(int x) { return x; }
+
+  template <class X> std::size_t count_all(X const& x)
+  {
+    std::size_t n = 0;
+    x.cvisit_all([&](typename X::value_type const&) { ++n; });
+    return n;
+  }
+
+  template <class X> void sequential_tests()
+  {
+    using value_type = typename X::value_type;
+    using values = values_of<X>;
+
+    {
+      // empty ranges, ranges shorter and longer than bulk_visit_size
+
+      X x;
+      auto v = values::range(0, 0);
+      BOOST_TEST_EQ(x.insert(v.begin(), v.end()), 0u);
+      for (int n : {1, 5, 16, 31, 32, 33, 1000}) {
+        X y;
+        v = values::range(0, n);
+        BOOST_TEST_EQ(
+          y.insert(v.begin(), v.end()), static_cast<std::size_t>(n));
+        BOOST_TEST_EQ(y.size(), static_cast<std::size_t>(n));
+        BOOST_TEST_EQ(count_all(y), static_cast<std::size_t>(n));
+        for (int i = 0; i < n; ++i) {
+          BOOST_TEST(y.contains(i));
+        }
+      }
+    }
+    {
+      // keys already present are visited, duplicates within a batch inserted
+      // once
+
+      X x;
+      auto v = values::range(0, 1000, 2);
+      BOOST_TEST_EQ(x.insert(v.begin(), v.end()), 500u);
+
+      v = values::range(0, 1000);
+      auto w = values::range(0, 1000);
+      v.insert(v.end(), w.begin(), w.end());
+
+      std::vector<int> visited(1000, 0);
+      auto inserted = x.insert_or_visit(v.begin(), v.end(),
+        [&](value_type const& y) { ++visited[key_of(y)]; });
+      BOOST_TEST_EQ(inserted, 500u);
+      BOOST_TEST_EQ(x.size(), 1000u);
+      for (int i = 0; i < 1000; ++i) {
+        BOOST_TEST_EQ(visited[i], i % 2 ? 1 : 2);
+      }
+
+      std::size_t num_visits = 0;
+      BOOST_TEST_EQ(x.insert_or_cvisit(v.begin(), v.end(),
+                      [&](value_type const&) { ++num_visits; }),
+        0u);
+      BOOST_TEST_EQ(num_visits, v.size());
+      BOOST_TEST_EQ(count_all(x), 1000u);
+    }
+    {
+      // value_type elements
+
+      X x;
+      std::vector<value_type> v;
+      for (int i = 0; i < 100; ++i) {
+        v.push_back(values::make(i % 50));
+      }
+      BOOST_TEST_EQ(x.insert(v.begin(), v.end()), 50u);
+      BOOST_TEST_EQ(x.size(), 50u);
+    }
+    {
+      // non-random access iterators
+
+      X x;
+      std::list<typename X::init_type> l;
+      for (int i = 0; i < 100; ++i) {
+        l.push_back(values::make(i));
+      }
+      BOOST_TEST_EQ(x.insert(l.begin(), l.end()), 100u);
+      BOOST_TEST_EQ(x.insert(l.begin(), l.end()), 0u);
+      BOOST_TEST_EQ(x.size(), 100u);
+    }
+    {
+      // growth and incremental rehashing in the middle of a range
+
+      for (bool incremental : {false, true}) {
+        X x;
+        x.incremental_rehash(incremental);
+        auto v = values::range(0, 50000);
+        BOOST_TEST_EQ(x.insert(v.begin(), v.end()), v.size());
+        auto w = values::range(25000, 100000);
+        BOOST_TEST_EQ(x.insert(w.begin(), w.end()), 50000u);
+        BOOST_TEST_EQ(x.size(), 100000u);
+        BOOST_TEST_EQ(count_all(x), 100000u);
+        for (int i = 0; i < 100000; ++i) {
+          BOOST_TEST(x.contains(i));
+        }
+      }
+    }
+  }
+
+  // Threads insert overlapping ranges into small and large tables: each key
+  // is inserted exactly once, and visited by all the other threads.
+
+  template <class X> void concurrent_tests()
+  {
+    using value_type = typename X::value_type;
+    using values = values_of<X>;
+
+    for (int n : {64, 100000}) {
+      std::size_t const nt = num_threads;
+      auto v = values::range(0, n);
+
+      X x;
+      std::atomic<std::size_t> inserted{0}, visited{0};
+      std::vector<std::thread> threads;
+      for (std::size_t t = 0; t < nt; ++t) {
+        threads.emplace_back([&, t] {
+          // start at different points so that threads meet
+
+          auto mid = v.begin() + static_cast<std::ptrdiff_t>(
+                                   t * v.size() / nt);
+          auto f = [&](value_type const&) { ++visited; };
+          inserted += x.insert_or_cvisit(mid, v.end(), f);
+          inserted += x.insert_or_cvisit(v.begin(), mid, f);
+        });
+      }
+      for (auto& th : threads) {
+        th.join();
+      }
+
+      BOOST_TEST_EQ(inserted.load(), static_cast<std::size_t>(n));
+      BOOST_TEST_EQ(visited.load(), (nt - 1) * static_cast<std::size_t>(n));
+      BOOST_TEST_EQ(x.size(), static_cast<std::size_t>(n));
+      BOOST_TEST_EQ(count_all(x), static_cast<std::size_t>(n));
+      for (int i = 0; i < n; ++i) {
+        BOOST_TEST(x.contains(i));
+      }
+    }
+  }
+
+  using flat_map_type = boost::concurrent_flat_map<int, int>;
+  using flat_set_type = boost::concurrent_flat_set<int>;
+  using node_map_type = boost::concurrent_node_map<int, int>;
+  using node_set_type = boost::concurrent_node_set<int>;
+} // namespace
+
+// clang-format off
+UNORDERED_AUTO_TEST (bulk_insert) {
+  sequential_tests<flat_map_type>();
+  sequential_tests<flat_set_type>();
+  sequential_tests<node_map_type>();
+  sequential_tests<node_set_type>();
+}
+
+UNORDERED_AUTO_TEST (bulk_insert_concurrent) {
+  concurrent_tests<flat_map_type>();
+  concurrent_tests<flat_set_type>();
+  concurrent_tests<node_map_type>();
+  concurrent_tests<node_set_type>();
+}
+// clang-format on
+
+RUN_TESTS()
@@ -5,6 +5,8 @@
 
 #include "helpers.hpp"
 
+#include "../helpers/counting_allocator.hpp"
+
 #include <boost/unordered/concurrent_flat_map.hpp>
 #include <boost/unordered/concurrent_flat_set.hpp>
 #include <boost/unordered/concurrent_node_map.hpp>
@@ -36,6 +38,11 @@ node_map_type* test_node_map;
 set_type* test_set;
 node_set_type* test_node_set;
 
+using counting_map_type = boost::unordered::concurrent_flat_map<raii, raii,
+  hasher, key_equal, test::counting_allocator<std::pair<raii const, raii> > >;
+
+counting_map_type* test_counting_map;
+
 namespace {
   template <class X, class GF>
   void clear_tests(X*, GF gen_factory, test::random_generator rg)
@@ -135,6 +142,28 @@ namespace {
     check_raii_counts();
   }
 
+  // arrays preallocated for the next growth are released on clear
+
+  template <class X> void clear_next_arrays(X*)
+  {
+    using allocator_type = typename X::allocator_type;
+
+    auto live_allocations = [] {
+      return test::counted_allocations - test::counted_deallocations;
+    };
+
+    X x(0, hasher(1), key_equal(2), allocator_type());
+    x.reserve(1000);
+    auto const n = live_allocations();
+
+    // the insertion taking the size to 7/8 of the max load preallocates
+    for (int i = 0; x.size() < x.max_load(); ++i) x.insert({i, i});
+    BOOST_TEST_GT(live_allocations(), n);
+
+    x.clear();
+    BOOST_TEST_EQ(live_allocations(), n);
+  }
+
 } // namespace
 
 // clang-format off
@@ -148,6 +177,9 @@ UNORDERED_TEST(insert_and_clear,
   ((test_map)(test_node_map)(test_set)(test_node_set))
   ((value_type_generator_factory))
   ((default_generator)(sequential)(limited_range)))
+
+UNORDERED_TEST(clear_next_arrays,
+  ((test_counting_map)))
 // clang-format on
 
 RUN_TESTS()
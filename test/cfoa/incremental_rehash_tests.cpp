@@ -0,0 +1,287 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "helpers.hpp"
+
+#include "../helpers/int_keys.hpp"
+
+#include <boost/unordered/concurrent_flat_map.hpp>
+#include <boost/unordered/concurrent_flat_set.hpp>
+#include <boost/unordered/concurrent_node_map.hpp>
+#include <boost/unordered/concurrent_node_set.hpp>
+
+#include <atomic>
+#include <climits>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+  struct counting_hash
+  {
+    static std::atomic<std::size_t> calls;
+    static std::atomic<int> throw_below;
+
+    std::size_t operator()(int x) const
+    {
+      ++calls;
+      if (x < throw_below) throw std::runtime_error("counting_hash");
+      return boost::hash<int>()(x);
+    }
+  };
+
+  std::atomic<std::size_t> counting_hash::calls{0};
+  std::atomic<int> counting_hash::throw_below{INT_MIN};
+
+  using test::insert_key;
+
+  template <class X> std::size_t count_all(X const& x)
+  {
+    std::size_t n = 0;
+    x.cvisit_all([&](typename X::value_type const&) { ++n; });
+    return n;
+  }
+
+  template <class X> void latency_tests()
+  {
+    int const n = 100000;
+
+    X x;
+    x.incremental_rehash(true);
+    BOOST_TEST(x.incremental_rehash());
+
+    std::size_t max_calls = 0;
+    std::size_t num_growths = 0;
+    std::size_t capacity = x.bucket_count();
+    for (int i = 0; i < n; ++i) {
+      counting_hash::calls = 0;
+      insert_key(x, i);
+      if (counting_hash::calls > max_calls) max_calls = counting_hash::calls;
+      if (x.bucket_count() != capacity) {
+        ++num_growths;
+        capacity = x.bucket_count();
+      }
+    }
+    BOOST_TEST_GT(num_growths, 10u);
+    BOOST_TEST_LT(max_calls, 200u); // as opposed to ~n/2 on last growth
+    BOOST_TEST_EQ(x.size(), static_cast<std::size_t>(n));
+
+    for (int i = 0; i < n; ++i) {
+      BOOST_TEST(x.contains(i));
+    }
+
+    x.incremental_rehash(false);
+    BOOST_TEST(!x.incremental_rehash());
+    counting_hash::calls = 0;
+    for (int i = n; i < 4 * n; ++i) {
+      insert_key(x, i);
+    }
+    BOOST_TEST_GE(counting_hash::calls, static_cast<std::size_t>(4 * n));
+  }
+
+  // grows the container and leaves it in the middle of a migration
+
+  template <class X> void migrating(X& x, int n)
+  {
+    x.incremental_rehash(true);
+    auto capacity = x.bucket_count();
+    int i = 0;
+    for (; x.bucket_count() == capacity || i < n; ++i) {
+      insert_key(x, i);
+    }
+    capacity = x.bucket_count();
+    for (;; ++i) {
+      insert_key(x, i);
+      if (x.bucket_count() != capacity) break;
+    }
+    insert_key(x, ++i);
+  }
+
+  template <class X> void operation_tests()
+  {
+    {
+      X x;
+      migrating(x, 1000);
+      auto s = x.size();
+      BOOST_TEST_EQ(count_all(x), s);
+
+      // erasure by key finds elements not yet migrated
+
+      std::size_t erased = 0;
+      for (int i = 0; i < static_cast<int>(s); i += 2) {
+        erased += x.erase(i);
+      }
+      BOOST_TEST_EQ(x.size(), s - erased);
+      for (int i = 0; i < static_cast<int>(s); ++i) {
+        BOOST_TEST_EQ(x.contains(i), i % 2 != 0);
+      }
+      BOOST_TEST_EQ(count_all(x), x.size());
+    }
+    {
+      X x;
+      migrating(x, 1000);
+      auto s = x.size();
+      X y(x);
+      BOOST_TEST(x == y);
+      BOOST_TEST_EQ(y.size(), s);
+      BOOST_TEST(y.incremental_rehash());
+
+      X z;
+      migrating(z, 500);
+      auto sz = z.size();
+      z.swap(x);
+      BOOST_TEST_EQ(x.size(), sz);
+      BOOST_TEST_EQ(z.size(), s);
+      BOOST_TEST(z == y);
+      BOOST_TEST_EQ(count_all(x), sz);
+
+      z = x;
+      BOOST_TEST(z == x);
+
+      X w(std::move(y));
+      BOOST_TEST_EQ(w.size(), s);
+      BOOST_TEST_EQ(count_all(w), s);
+    }
+    {
+      X x;
+      migrating(x, 1000);
+      x.rehash(0);
+      BOOST_TEST_EQ(count_all(x), x.size());
+      migrating(x, 4000);
+      x.clear();
+      BOOST_TEST_EQ(x.size(), 0u);
+      BOOST_TEST_EQ(count_all(x), 0u);
+      migrating(x, 1000);
+      BOOST_TEST_EQ(count_all(x), x.size());
+    }
+    {
+      // leave migration pending on destruction
+
+      X x;
+      migrating(x, 1000);
+    }
+  }
+
+  template <class X> void exception_tests()
+  {
+    X x;
+    migrating(x, 1000);
+    auto s = x.size();
+
+    // hashing the elements to migrate throws, they're left in the old arrays
+
+    int i = static_cast<int>(s) + 1;
+    counting_hash::throw_below = i;
+    BOOST_TEST_THROWS(insert_key(x, i), std::runtime_error);
+    counting_hash::throw_below = INT_MIN;
+
+    BOOST_TEST_EQ(x.size(), s);
+    for (int j = 0; j < static_cast<int>(s); ++j) {
+      BOOST_TEST(x.contains(j));
+    }
+    BOOST_TEST_EQ(count_all(x), s);
+
+    for (int j = 0; j < static_cast<int>(s); ++j) {
+      insert_key(x, i + j);
+    }
+    BOOST_TEST_EQ(x.size(), 2 * s);
+    BOOST_TEST_EQ(count_all(x), 2 * s);
+  }
+
+  // Writers insert disjoint ranges of keys and publish how far they got;
+  // readers check that published keys are always found, also while their
+  // elements are being migrated.
+
+  template <class X> void concurrent_tests()
+  {
+    int const n = 100000;
+
+    X x;
+    x.incremental_rehash(true);
+
+    std::size_t const num_writers = (num_threads + 1) / 2;
+    std::size_t const num_readers = num_threads - num_writers;
+
+    std::vector<std::atomic<int> > progress(num_writers);
+    for (auto& p : progress) p = 0;
+    std::atomic<std::size_t> writers_done{0};
+    std::atomic<std::size_t> missing{0};
+    std::vector<std::thread> threads;
+
+    for (std::size_t t = 0; t < num_writers; ++t) {
+      threads.emplace_back([&, t] {
+        for (int i = 0; i < n; ++i) {
+          insert_key(x, static_cast<int>(t) * n + i);
+          progress[t].store(i + 1);
+
+          // erase some keys already published to have erasures migrate too
+
+          if (i % 8 == 7) x.erase(static_cast<int>(t) * n + i - 7);
+        }
+        ++writers_done;
+      });
+    }
+
+    for (std::size_t t = 0; t < num_readers; ++t) {
+      threads.emplace_back([&, t] {
+        std::size_t w = t % num_writers;
+        while (writers_done.load() != num_writers) {
+          int m = progress[w].load();
+          for (int i = m > 64 ? m - 64 : 0; i < m; ++i) {
+            if (i % 8 == 0) continue; // may be erased
+            if (!x.contains(static_cast<int>(w) * n + i)) ++missing;
+          }
+          w = (w + 1) % num_writers;
+        }
+      });
+    }
+
+    for (auto& th : threads) {
+      th.join();
+    }
+
+    BOOST_TEST_EQ(missing.load(), 0u);
+
+    std::size_t const expected = num_writers * static_cast<std::size_t>(n) -
+                                 num_writers * static_cast<std::size_t>(n / 8);
+    BOOST_TEST_EQ(x.size(), expected);
+    BOOST_TEST_EQ(count_all(x), expected);
+    for (std::size_t t = 0; t < num_writers; ++t) {
+      for (int i = 0; i < n; ++i) {
+        BOOST_TEST_EQ(x.contains(static_cast<int>(t) * n + i), i % 8 != 0);
+      }
+    }
+  }
+
+  using flat_map_type = boost::concurrent_flat_map<int, int, counting_hash>;
+  using flat_set_type = boost::concurrent_flat_set<int, counting_hash>;
+  using node_map_type = boost::concurrent_node_map<int, int, counting_hash>;
+  using node_set_type = boost::concurrent_node_set<int, counting_hash>;
+} // namespace
+
+// clang-format off
+UNORDERED_AUTO_TEST (incremental_rehash_latency) {
+  latency_tests<flat_map_type>();
+  latency_tests<node_set_type>();
+}
+
+UNORDERED_AUTO_TEST (incremental_rehash_operations) {
+  operation_tests<flat_map_type>();
+  operation_tests<flat_set_type>();
+  operation_tests<node_map_type>();
+  operation_tests<node_set_type>();
+}
+
+UNORDERED_AUTO_TEST (incremental_rehash_exceptions) {
+  exception_tests<flat_map_type>();
+  exception_tests<node_set_type>();
+}
+
+UNORDERED_AUTO_TEST (incremental_rehash_concurrent) {
+  concurrent_tests<flat_map_type>();
+  concurrent_tests<node_map_type>();
+}
+// clang-format on
+
+RUN_TESTS()
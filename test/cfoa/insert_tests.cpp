@@ -33,6 +33,14 @@ struct raii_convertible
 };
 
 namespace {
+  // tables of up to two groups are allowed 100% usage, so a table filled
+  // from empty only rehashes (moving its elements) past that size
+
+  template <class X> bool rehashes_on_insertion(X const& x)
+  {
+    return x.size() > 2 * BOOST_UNORDERED_GROUP_SIZE - 1;
+  }
+
   test::seed_t initialize_seed(78937);
 
   struct lvalue_inserter_type
@@ -185,9 +193,11 @@ namespace {
       if (is_container_node_based<X>::value) {
         BOOST_TEST_EQ(raii::move_constructor, 0u);
       }
-      else{
-        // don't check move construction count here because of rehashing
-        BOOST_TEST_GT(raii::move_constructor, 0u);
+      else if (rehashes_on_insertion(x)) {
+        BOOST_TEST_GT(raii::move_constructor, 0u); // rehashing
+      }
+      else {
+        BOOST_TEST_EQ(raii::move_constructor, 0u);
       }
 
       BOOST_TEST_EQ(raii::copy_assignment, values.size() - x.size());
@@ -211,9 +221,12 @@ namespace {
       if (is_container_node_based<X>::value) {
         BOOST_TEST_EQ(raii::move_constructor, x.size());
       }
-      else{
+      else if (rehashes_on_insertion(x)) {
         BOOST_TEST_GT(raii::move_constructor, x.size()); // rehashing
       }
+      else {
+        BOOST_TEST_EQ(raii::move_constructor, x.size());
+      }
 
       BOOST_TEST_EQ(raii::copy_assignment, 0u);
       BOOST_TEST_EQ(raii::move_assignment, values.size() - x.size());
@@ -236,9 +249,12 @@ namespace {
       if (is_container_node_based<X>::value) {
         BOOST_TEST_EQ(raii::move_constructor, x.size());
       }
-      else{
+      else if (rehashes_on_insertion(x)) {
         BOOST_TEST_GT(raii::move_constructor, x.size()); // rehashing
       }
+      else {
+        BOOST_TEST_EQ(raii::move_constructor, x.size());
+      }
 
       BOOST_TEST_EQ(raii::copy_assignment, values.size() - x.size());
       BOOST_TEST_EQ(raii::move_assignment, 0u);
@@ -261,9 +277,12 @@ namespace {
       if (is_container_node_based<X>::value) {
         BOOST_TEST_EQ(raii::move_constructor, 2 * x.size());
       }
-      else{
+      else if (rehashes_on_insertion(x)) {
         BOOST_TEST_GE(raii::move_constructor, 2 * x.size()); // rehashing
       }
+      else {
+        BOOST_TEST_EQ(raii::move_constructor, 2 * x.size());
+      }
 
       BOOST_TEST_EQ(raii::copy_assignment, 0u);
       BOOST_TEST_EQ(raii::move_assignment, values.size() - x.size());
@@ -294,9 +313,12 @@ namespace {
       if (is_container_node_based<X>::value) {
         BOOST_TEST_EQ(raii::move_constructor, 0u);
       }
-      else{
+      else if (rehashes_on_insertion(x)) {
         BOOST_TEST_GT(raii::move_constructor, 0u); // rehashing
       }
+      else {
+        BOOST_TEST_EQ(raii::move_constructor, 0u);
+      }
 
       BOOST_TEST_EQ(raii::copy_assignment, values.size() - x.size());
       BOOST_TEST_EQ(raii::move_assignment, 0u);
@@ -325,9 +347,12 @@ namespace {
       if (is_container_node_based<X>::value) {
         BOOST_TEST_EQ(raii::move_constructor, x.size());
       }
-      else{
+      else if (rehashes_on_insertion(x)) {
         BOOST_TEST_GT(raii::move_constructor, x.size()); // rehashing
       }
+      else {
+        BOOST_TEST_EQ(raii::move_constructor, x.size());
+      }
 
       BOOST_TEST_EQ(raii::copy_assignment, 0u);
       BOOST_TEST_EQ(raii::move_assignment, values.size() - x.size());
@@ -367,9 +392,11 @@ namespace {
       if (is_container_node_based<X>::value) {
         BOOST_TEST_EQ(raii::move_constructor, 0u);
       }
-      else{
-        // don't check move construction count here because of rehashing
-        BOOST_TEST_GT(raii::move_constructor, 0u);
+      else if (rehashes_on_insertion(x)) {
+        BOOST_TEST_GT(raii::move_constructor, 0u); // rehashing
+      }
+      else {
+        BOOST_TEST_EQ(raii::move_constructor, 0u);
       }
 
       BOOST_TEST_EQ(raii::move_assignment, 0u);
@@ -415,9 +442,11 @@ namespace {
       if (is_container_node_based<X>::value) {
         BOOST_TEST_EQ(raii::move_constructor, 0u);
       }
-      else{
-        // don't check move construction count here because of rehashing
-        BOOST_TEST_GT(raii::move_constructor, 0u);
+      else if (rehashes_on_insertion(x)) {
+        BOOST_TEST_GT(raii::move_constructor, 0u); // rehashing
+      }
+      else {
+        BOOST_TEST_EQ(raii::move_constructor, 0u);
       }
 
       BOOST_TEST_EQ(raii::move_assignment, 0u);
@@ -0,0 +1,207 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_UNORDERED_OPTIMISTIC_READS
+
+#include "helpers.hpp"
+
+#include <boost/unordered/concurrent_flat_map.hpp>
+#include <boost/unordered/concurrent_flat_set.hpp>
+#include <boost/unordered/concurrent_node_map.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+  // written as a whole by writers, so readers must never see a mix of values
+
+  struct quad
+  {
+    std::uint64_t a, b, c, d;
+
+    bool consistent() const { return a == b && b == c && c == d; }
+  };
+
+  template <class Map> void lookup_tests(Map& m)
+  {
+    using value_type = typename Map::value_type;
+
+    for (int i = 0; i < 10000; ++i) {
+      m.emplace(i, i);
+    }
+
+    Map const& cm = m;
+    for (int i = 0; i < 20000; ++i) {
+      int n = 0;
+      auto r = cm.cvisit(i, [&](value_type const& x) {
+        BOOST_TEST_EQ(x.first, i);
+        BOOST_TEST(x.second == typename Map::mapped_type(i));
+        ++n;
+      });
+      BOOST_TEST_EQ(r, i < 10000 ? 1u : 0u);
+      BOOST_TEST_EQ(n, i < 10000 ? 1 : 0);
+      BOOST_TEST_EQ(cm.contains(i), i < 10000);
+      BOOST_TEST_EQ(cm.count(i), i < 10000 ? 1u : 0u);
+    }
+
+    // lookups see mutations made through exclusive visitation
+
+    for (int i = 0; i < 10000; ++i) {
+      m.visit(i, [](value_type& x) { x.second = x.second + 1; });
+    }
+    for (int i = 0; i < 10000; ++i) {
+      BOOST_TEST_EQ(cm.cvisit(i,
+                      [&](value_type const& x) {
+                        BOOST_TEST(
+                          x.second == typename Map::mapped_type(i + 1));
+                      }),
+        1u);
+    }
+
+    // and erasures
+
+    for (int i = 0; i < 10000; i += 2) {
+      m.erase(i);
+    }
+    for (int i = 0; i < 10000; ++i) {
+      BOOST_TEST_EQ(cm.contains(i), i % 2 != 0);
+    }
+
+    int n = 0;
+    BOOST_TEST(!m.insert_or_cvisit(
+      value_type(1, 0), [&](value_type const& x) {
+        BOOST_TEST_EQ(x.first, 1);
+        ++n;
+      }));
+    BOOST_TEST_EQ(n, 1);
+  }
+
+  void lookup_tests()
+  {
+    {
+      boost::concurrent_flat_map<int, int> m;
+      lookup_tests(m);
+    }
+    {
+      boost::concurrent_flat_map<int, double> m;
+      lookup_tests(m);
+    }
+    {
+      // not trivially copyable: locked lookup
+
+      boost::concurrent_flat_map<int, std::string> m;
+      m.emplace(1, "one");
+      m.emplace(2, "two");
+      BOOST_TEST_EQ(
+        m.cvisit(2, [](std::pair<int const, std::string> const& x) {
+          BOOST_TEST_EQ(x.second, "two");
+        }),
+        1u);
+      BOOST_TEST(!m.contains(3));
+    }
+    {
+      // node-based: locked lookup
+
+      boost::concurrent_node_map<int, int> m;
+      lookup_tests(m);
+    }
+    {
+      boost::concurrent_flat_set<int> s;
+      for (int i = 0; i < 1000; ++i) {
+        s.insert(i);
+      }
+      for (int i = 0; i < 2000; ++i) {
+        BOOST_TEST_EQ(s.contains(i), i < 1000);
+      }
+    }
+  }
+
+  void concurrent_tests()
+  {
+    using map_type = boost::concurrent_flat_map<int, quad>;
+
+    int const num_keys = 1024;
+    int const num_writes = 20000;
+
+    map_type m;
+    for (int i = 0; i < num_keys; ++i) {
+      m.emplace(i, quad{0, 0, 0, 0});
+    }
+
+    std::size_t const num_writers = num_threads / 2;
+    std::size_t const num_readers = num_threads - num_writers;
+
+    std::atomic<std::size_t> writers_done{0};
+    std::atomic<std::size_t> inconsistent{0};
+    std::vector<std::thread> threads;
+
+    for (std::size_t t = 0; t < num_writers; ++t) {
+      threads.emplace_back([&, t] {
+        for (int i = 0; i < num_writes; ++i) {
+          int k = static_cast<int>(
+            (t * 7919 + static_cast<std::size_t>(i) * 31) % num_keys);
+          m.visit(k, [&](map_type::value_type& x) {
+            auto v = x.second.a + 1;
+            x.second.a = v;
+            x.second.b = v;
+
+            // widen the window for readers to observe a half-written value
+
+            if (i % 64 == 0) std::this_thread::yield();
+            x.second.c = v;
+            x.second.d = v;
+          });
+
+          // churn on other keys in the same groups
+
+          int k2 = num_keys + static_cast<int>(t) * num_writes + i;
+          m.emplace(k2, quad{1, 1, 1, 1});
+          m.erase(k2);
+        }
+        ++writers_done;
+      });
+    }
+
+    for (std::size_t t = 0; t < num_readers; ++t) {
+      threads.emplace_back([&, t] {
+        auto k = static_cast<int>(t);
+        while (writers_done.load() != num_writers) {
+          k = (k + 1) % num_keys;
+          m.cvisit(k, [&](map_type::value_type const& x) {
+            if (!x.second.consistent()) ++inconsistent;
+          });
+        }
+      });
+    }
+
+    for (auto& th : threads) {
+      th.join();
+    }
+
+    BOOST_TEST_EQ(inconsistent.load(), 0u);
+    BOOST_TEST_EQ(m.size(), static_cast<std::size_t>(num_keys));
+
+    std::uint64_t total = 0;
+    m.cvisit_all([&](map_type::value_type const& x) {
+      BOOST_TEST(x.second.consistent());
+      total += x.second.a;
+    });
+    BOOST_TEST_EQ(total, num_writers * static_cast<std::size_t>(num_writes));
+  }
+} // namespace
+
+// clang-format off
+UNORDERED_AUTO_TEST (optimistic_lookup) {
+  lookup_tests();
+}
+
+UNORDERED_AUTO_TEST (optimistic_concurrent_lookup) {
+  concurrent_tests();
+}
+// clang-format on
+
+RUN_TESTS()
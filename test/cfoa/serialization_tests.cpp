@@ -5,6 +5,8 @@
 #include "../objects/test.hpp"
 #include "../helpers/random_values.hpp"
 
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
 #include <boost/archive/xml_oarchive.hpp>
@@ -69,6 +71,9 @@ namespace {
   std::pair<
     boost::archive::xml_oarchive, boost::archive::xml_iarchive>*
     xml_archive;
+  std::pair<
+    boost::archive::binary_oarchive, boost::archive::binary_iarchive>*
+    binary_archive;
 
   boost::concurrent_flat_map<
     test::object, test::object, test::hash, test::equal_to>* test_flat_map;
@@ -81,7 +86,7 @@ namespace {
 
   UNORDERED_TEST(serialization_tests,
     ((test_flat_map)(test_node_map)(test_flat_set)(test_node_set))
-    ((text_archive)(xml_archive))
+    ((text_archive)(xml_archive)(binary_archive))
     ((default_generator)))
 }
 
@@ -0,0 +1,180 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "helpers.hpp"
+
+#include "../helpers/int_keys.hpp"
+
+#include <boost/unordered/concurrent_flat_map.hpp>
+#include <boost/unordered/concurrent_flat_set.hpp>
+#include <boost/unordered/concurrent_node_map.hpp>
+
+#include <thread>
+#include <vector>
+
+namespace {
+  // more threads than cores, so that many size stripes are used
+
+  std::size_t const num_size_threads = 16;
+
+  template <class F> void run_threads(F f)
+  {
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < num_size_threads; ++t) {
+      threads.emplace_back([&f, t] { f(static_cast<int>(t)); });
+    }
+    for (auto& th : threads) {
+      th.join();
+    }
+  }
+
+  using test::insert_key;
+
+  // growth happens exactly when the maximum load is reached, regardless of
+  // how many threads insert
+
+  template <class X> void growth_tests()
+  {
+    int const n = 10000;
+
+    X x;
+    x.reserve(n);
+    auto const bucket_count = x.bucket_count();
+    auto const ml = static_cast<int>(x.max_load());
+    BOOST_TEST_GE(ml, n);
+
+    run_threads([&](int t) {
+      for (int i = t; i < ml; i += static_cast<int>(num_size_threads)) {
+        insert_key(x, i);
+      }
+    });
+    BOOST_TEST_EQ(x.size(), static_cast<std::size_t>(ml));
+    BOOST_TEST_EQ(x.bucket_count(), bucket_count);
+
+    insert_key(x, ml);
+    BOOST_TEST_EQ(x.size(), static_cast<std::size_t>(ml) + 1);
+    BOOST_TEST_GT(x.bucket_count(), bucket_count);
+
+    // same capacity as if filled by a single thread
+
+    X y;
+    X z;
+    run_threads([&](int t) {
+      for (int i = t; i < 4 * n; i += static_cast<int>(num_size_threads)) {
+        insert_key(y, i);
+      }
+    });
+    for (int i = 0; i < 4 * n; ++i) {
+      insert_key(z, i);
+    }
+    BOOST_TEST_EQ(y.size(), z.size());
+    BOOST_TEST_EQ(y.bucket_count(), z.bucket_count());
+    BOOST_TEST_LE(y.load_factor(), y.max_load_factor());
+  }
+
+  // elements erased through threads other than those inserting them
+
+  template <class X> void churn_tests()
+  {
+    int const n = 20000;
+
+    X x;
+    run_threads([&](int t) {
+      for (int i = 0; i < n; ++i) {
+        insert_key(x, t * n + i);
+        if (i % 2) {
+          auto u = (t + 1) % static_cast<int>(num_size_threads);
+          x.erase(u * n + i - 1); // may or may not have been inserted yet
+        }
+      }
+    });
+
+    std::size_t count = 0;
+    x.cvisit_all([&](typename X::value_type const&) { ++count; });
+    BOOST_TEST_EQ(x.size(), count);
+    BOOST_TEST_LE(x.load_factor(), x.max_load_factor());
+
+    x.erase_if([](typename X::value_type const&) { return true; });
+    BOOST_TEST_EQ(x.size(), 0u);
+    BOOST_TEST(x.empty());
+
+    // stripes balance out
+
+    run_threads([&](int t) {
+      for (int i = 0; i < n; ++i) {
+        insert_key(x, t * n + i);
+      }
+    });
+    BOOST_TEST_EQ(x.size(), num_size_threads * static_cast<std::size_t>(n));
+
+    X y(x);
+    BOOST_TEST_EQ(y.size(), x.size());
+    x.clear();
+    BOOST_TEST_EQ(x.size(), 0u);
+    x.swap(y);
+    BOOST_TEST_EQ(x.size(), num_size_threads * static_cast<std::size_t>(n));
+    BOOST_TEST_EQ(y.size(), 0u);
+  }
+
+  // slots reserved against the former maximum load don't allow insertion
+  // past the new one
+
+  template <class X> void max_load_factor_tests()
+  {
+    X x;
+    x.reserve(10000);
+    auto const bucket_count = x.bucket_count();
+    for (int i = 0; i < 100; ++i) {
+      insert_key(x, i);
+    }
+    auto ml = x.max_load();
+    x.max_load_factor(x.max_load_factor());
+    BOOST_TEST_EQ(x.max_load(), ml);
+
+    x.max_load_factor(105.5f / static_cast<float>(bucket_count));
+    BOOST_TEST_GE(x.max_load(), 100u);
+    BOOST_TEST_LT(x.max_load(), 110u);
+    BOOST_TEST_EQ(x.bucket_count(), bucket_count);
+    for (int i = 100; i < 110; ++i) {
+      insert_key(x, i);
+    }
+    BOOST_TEST_EQ(x.size(), 110u);
+    BOOST_TEST_GT(x.bucket_count(), bucket_count);
+    BOOST_TEST_LE(x.load_factor(), x.max_load_factor());
+
+    // lowering the max load factor below the current load rehashes
+
+    auto bucket_count2 = x.bucket_count();
+    x.max_load_factor(0.001f);
+    BOOST_TEST_EQ(x.size(), 110u);
+    BOOST_TEST_GE(x.max_load(), x.size());
+    BOOST_TEST_GT(x.bucket_count(), bucket_count2);
+  }
+
+  using flat_map_type = boost::concurrent_flat_map<int, int>;
+  using flat_set_type = boost::concurrent_flat_set<int>;
+  using node_map_type = boost::concurrent_node_map<int, int>;
+} // namespace
+
+// clang-format off
+UNORDERED_AUTO_TEST (striped_size_growth) {
+  growth_tests<flat_map_type>();
+  growth_tests<flat_set_type>();
+  growth_tests<node_map_type>();
+}
+
+UNORDERED_AUTO_TEST (striped_size_churn) {
+  churn_tests<flat_map_type>();
+  churn_tests<flat_set_type>();
+  churn_tests<node_map_type>();
+}
+
+UNORDERED_AUTO_TEST (striped_size_max_load_factor) {
+  max_load_factor_tests<flat_map_type>();
+  max_load_factor_tests<flat_set_type>();
+  max_load_factor_tests<node_map_type>();
+}
+// clang-format on
+
+RUN_TESTS()
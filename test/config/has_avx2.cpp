@@ -0,0 +1,18 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Builds and runs only if the compiler targets AVX2 and the host executes it.
+
+#if !defined(__AVX2__)
+#error "AVX2 not enabled"
+#endif
+
+#include <immintrin.h>
+
+int main()
+{
+  volatile char a = 1, b = 1;
+  __m256i x = _mm256_set1_epi8(a), y = _mm256_set1_epi8(b);
+  return _mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)) == -1 ? 0 : 1;
+}
@@ -0,0 +1,19 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Builds and runs only if the compiler targets AVX-512BW and the host
+// executes it.
+
+#if !defined(__AVX512BW__)
+#error "AVX-512BW not enabled"
+#endif
+
+#include <immintrin.h>
+
+int main()
+{
+  volatile char a = 1, b = 1;
+  __m512i x = _mm512_set1_epi8(a), y = _mm512_set1_epi8(b);
+  return _mm512_cmpeq_epi8_mask(x, y) == ~__mmask64(0) ? 0 : 1;
+}
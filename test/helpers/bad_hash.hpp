@@ -0,0 +1,29 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_UNORDERED_TEST_HELPERS_BAD_HASH_HEADER)
+#define BOOST_UNORDERED_TEST_HELPERS_BAD_HASH_HEADER
+
+#include <climits>
+#include <cstddef>
+#include <type_traits>
+
+namespace test {
+  // Hash concentrating the positions of int keys on at most M groups of an
+  // open-addressing container: the hash value only has its high bits set,
+  // and it's marked as avalanching so that it's not mixed.
+
+  template <int M> struct bad_hash
+  {
+    using is_avalanching = std::true_type;
+
+    std::size_t operator()(int x) const
+    {
+      return static_cast<std::size_t>(x % M) *
+             (std::size_t(1) << (sizeof(std::size_t) * CHAR_BIT - 8));
+    }
+  };
+} // namespace test
+
+#endif
@@ -0,0 +1,45 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_UNORDERED_TEST_HELPERS_COUNTING_ALLOCATOR_HEADER)
+#define BOOST_UNORDERED_TEST_HELPERS_COUNTING_ALLOCATOR_HEADER
+
+#include <cstddef>
+#include <memory>
+
+namespace test {
+  // number of allocations and deallocations done by all counting_allocators
+
+  std::size_t counted_allocations = 0;
+  std::size_t counted_deallocations = 0;
+
+  template <class T> struct counting_allocator
+  {
+    using value_type = T;
+
+    counting_allocator() = default;
+
+    template <class U>
+    counting_allocator(counting_allocator<U> const&) noexcept
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+      ++counted_allocations;
+      return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+      ++counted_deallocations;
+      std::allocator<T>().deallocate(p, n);
+    }
+
+    bool operator==(counting_allocator const&) const noexcept { return true; }
+    bool operator!=(counting_allocator const&) const noexcept { return false; }
+  };
+} // namespace test
+
+#endif
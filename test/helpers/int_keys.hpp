@@ -0,0 +1,41 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_UNORDERED_TEST_HELPERS_INT_KEYS_HEADER)
+#define BOOST_UNORDERED_TEST_HELPERS_INT_KEYS_HEADER
+
+#include <type_traits>
+#include <utility>
+
+namespace test {
+  // Insertion and key extraction for containers with int keys, either sets
+  // or maps from int to int (mapping each key to itself).
+
+  template <class X> int get_key(X const&, int const& x) { return x; }
+
+  template <class X>
+  int get_key(X const&, std::pair<int const, int> const& x)
+  {
+    return x.first;
+  }
+
+  template <class X> void insert_key(X& x, int k, std::true_type /* map */)
+  {
+    x.emplace(k, k);
+  }
+
+  template <class X> void insert_key(X& x, int k, std::false_type /* set */)
+  {
+    x.insert(k);
+  }
+
+  template <class X> void insert_key(X& x, int k)
+  {
+    test::insert_key(x, k,
+      std::integral_constant<bool,
+        !std::is_same<typename X::key_type, typename X::value_type>::value>{});
+  }
+} // namespace test
+
+#endif
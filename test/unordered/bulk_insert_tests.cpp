@@ -0,0 +1,294 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_UNORDERED_FOA_TESTS)
+#error "bulk_insert_tests is currently only supported by open-addressed containers"
+#else
+
+#include "../helpers/unordered.hpp"
+
+#include "../helpers/input_iterator.hpp"
+#include "../helpers/int_keys.hpp"
+#include "../helpers/test.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+struct counting_hash
+{
+  static std::size_t calls;
+  static std::size_t throw_at; // 0: never
+
+  std::size_t operator()(int x) const
+  {
+    if (++calls == throw_at) throw std::runtime_error("");
+    return boost::hash<int>()(x);
+  }
+};
+
+std::size_t counting_hash::calls = 0;
+std::size_t counting_hash::throw_at = 0;
+
+// int wrapper whose construction from another object can be made to throw
+
+struct throwing_int
+{
+  static std::size_t copies;
+  static std::size_t throw_at; // 0: never
+
+  throwing_int(int n_) : n{n_} {}
+  throwing_int(throwing_int const& x) : n{x.n}
+  {
+    if (++copies == throw_at) throw std::runtime_error("");
+  }
+  throwing_int(throwing_int&& x) noexcept : n{x.n} {}
+  throwing_int& operator=(throwing_int const&) = default;
+
+  friend bool operator==(throwing_int const& x, throwing_int const& y)
+  {
+    return x.n == y.n;
+  }
+
+  int n;
+};
+
+std::size_t throwing_int::copies = 0;
+std::size_t throwing_int::throw_at = 0;
+
+struct throwing_int_hash
+{
+  std::size_t operator()(throwing_int const& x) const
+  {
+    return boost::hash<int>()(x.n);
+  }
+};
+
+using test::get_key;
+
+template <class X>
+typename X::value_type make_value(int k, std::true_type /* map */)
+{
+  return {k, k};
+}
+
+template <class X>
+typename X::value_type make_value(int k, std::false_type /* set */)
+{
+  return k;
+}
+
+template <class X> typename X::value_type make_value(int k)
+{
+  return make_value<X>(k,
+    std::integral_constant<bool,
+      !std::is_same<typename X::key_type, typename X::value_type>::value>{});
+}
+
+template <class X> std::vector<typename X::value_type> make_range(
+  std::vector<int> const& keys)
+{
+  std::vector<typename X::value_type> v;
+  for (int k : keys) {
+    v.push_back(make_value<X>(k));
+  }
+  return v;
+}
+
+template <class X> void fill_to_max_load(X& x)
+{
+  // leaves x full, so that the next insertion of a new element grows it
+
+  int k = 0;
+  while (x.size() < 1000) x.insert(make_value<X>(k++));
+  while (x.size() < x.max_load()) x.insert(make_value<X>(k++));
+}
+
+template <class X> void duplicates_tests()
+{
+  // a range of copies of the same key grows the container as much as
+  // inserting the key once
+
+  {
+    X x, y;
+    auto v = make_range<X>(std::vector<int>(100000, 1));
+    x.insert(v.begin(), v.end());
+    y.insert(v.front());
+    BOOST_TEST_EQ(x.size(), 1u);
+    BOOST_TEST_EQ(x.bucket_count(), y.bucket_count());
+  }
+
+  // many duplicates, also of elements already in the container: the
+  // result is that of elementwise insertion, with memory growth bounded by
+  // the container's size at the time of growth
+
+  {
+    std::vector<int> keys;
+    for (int i = 0; i < 100000; ++i) keys.push_back(i % 500);
+    for (int i = 0; i < 100000; ++i) keys.push_back(i % 3000);
+    auto v = make_range<X>(keys);
+
+    X x, y;
+    for (int i = 0; i < 200; ++i) {
+      x.insert(make_value<X>(i * 7));
+      y.insert(make_value<X>(i * 7));
+    }
+    x.insert(v.begin(), v.end());
+    for (auto const& value : v) y.insert(value);
+    BOOST_TEST(x == y);
+    BOOST_TEST_LE(x.bucket_count(), 4 * y.bucket_count());
+    for (auto const& value : v) {
+      BOOST_TEST(x.contains(get_key(x, value)));
+    }
+  }
+}
+
+template <class X> void single_growth_tests()
+{
+  // a range of new elements no larger than the container's contents grows
+  // it exactly once, each element of x being rehashed a single time
+
+  for (std::size_t m : {1u, 2u, 3u}) {
+    X x;
+    fill_to_max_load(x);
+    auto n = x.size();
+    auto bucket_count = x.bucket_count();
+
+    std::vector<int> keys;
+    for (std::size_t i = 0; i < m * n; ++i) {
+      keys.push_back(-1 - static_cast<int>(i));
+    }
+    auto v = make_range<X>(keys);
+
+    counting_hash::calls = 0;
+    x.insert(v.begin(), v.end());
+    BOOST_TEST_EQ(x.size(), n + v.size());
+    BOOST_TEST_GT(x.bucket_count(), bucket_count);
+    BOOST_TEST_EQ(counting_hash::calls, v.size() + n);
+  }
+}
+
+template <class X> void hash_exception_tests()
+{
+  // a throwing hash function leaves the container as it was before
+  // inserting the element being hashed
+
+  X x;
+  fill_to_max_load(x);
+  X const y(x);
+
+  std::vector<int> keys;
+  for (int i = 0; i < 1000; ++i) keys.push_back(-1 - i);
+  auto v = make_range<X>(keys);
+
+  counting_hash::calls = 0;
+  counting_hash::throw_at = 1;
+  BOOST_TEST_THROWS(x.insert(v.begin(), v.end()), std::runtime_error);
+  counting_hash::throw_at = 0;
+  BOOST_TEST(x == y);
+  BOOST_TEST_EQ(x.bucket_count(), y.bucket_count());
+
+  // throwing after growth: elements already inserted stay
+
+  counting_hash::calls = 0;
+  counting_hash::throw_at = x.size() + v.size() / 2;
+  BOOST_TEST_THROWS(x.insert(v.begin(), v.end()), std::runtime_error);
+  counting_hash::throw_at = 0;
+  BOOST_TEST_GT(x.bucket_count(), y.bucket_count());
+  BOOST_TEST_GE(x.size(), y.size());
+  BOOST_TEST_LT(x.size(), y.size() + v.size());
+  std::size_t n = 0;
+  for (auto const& value : x) {
+    BOOST_TEST(get_key(x, value) < 0 || y.contains(get_key(x, value)));
+    ++n;
+  }
+  BOOST_TEST_EQ(n, x.size());
+  for (auto const& value : y) {
+    BOOST_TEST(x.contains(get_key(y, value)));
+  }
+}
+
+template <class X> void constructor_exception_tests()
+{
+  // the element whose construction throws at growth is not inserted and
+  // the container keeps its previous arrays (strong guarantee)
+
+  X x;
+  int k = 0;
+  while (x.size() < 1000) x.emplace(throwing_int(k++), 0);
+  while (x.size() < x.max_load()) x.emplace(throwing_int(k++), 0);
+  X const y(x);
+
+  std::vector<std::pair<throwing_int const, int> > v;
+  for (int i = 0; i < 1000; ++i) v.emplace_back(throwing_int(-1 - i), 0);
+
+  throwing_int::copies = 0;
+  throwing_int::throw_at = 1;
+  BOOST_TEST_THROWS(x.insert(v.begin(), v.end()), std::runtime_error);
+  throwing_int::throw_at = 0;
+  BOOST_TEST(x == y);
+  BOOST_TEST_EQ(x.bucket_count(), y.bucket_count());
+
+  x.insert(v.begin(), v.end());
+  BOOST_TEST_EQ(x.size(), y.size() + v.size());
+}
+
+template <class X> void input_iterator_tests()
+{
+  // input iterators can't be traversed twice as bulk insertion does:
+  // elements are inserted one at a time instead
+
+  std::vector<int> keys;
+  for (int i = 0; i < 1000; ++i) keys.push_back(i % 300);
+  auto v = make_range<X>(keys);
+
+  X x;
+  auto first = v.begin(), last = v.end();
+  x.insert(test::input_iterator(first), test::input_iterator(last));
+  BOOST_TEST_EQ(x.size(), 300u);
+
+  X y;
+  for (auto const& value : v) y.insert(value);
+  BOOST_TEST(x == y);
+  BOOST_TEST_EQ(x.bucket_count(), y.bucket_count());
+}
+
+using flat_map_type = boost::unordered_flat_map<int, int, counting_hash>;
+using flat_set_type = boost::unordered_flat_set<int, counting_hash>;
+using node_map_type = boost::unordered_node_map<int, int, counting_hash>;
+using node_set_type = boost::unordered_node_set<int, counting_hash>;
+
+UNORDERED_AUTO_TEST (bulk_insert_duplicates) {
+  duplicates_tests<flat_map_type>();
+  duplicates_tests<flat_set_type>();
+  duplicates_tests<node_map_type>();
+  duplicates_tests<node_set_type>();
+}
+
+UNORDERED_AUTO_TEST (bulk_insert_single_growth) {
+  single_growth_tests<flat_map_type>();
+  single_growth_tests<flat_set_type>();
+  single_growth_tests<node_map_type>();
+  single_growth_tests<node_set_type>();
+}
+
+UNORDERED_AUTO_TEST (bulk_insert_exceptions) {
+  hash_exception_tests<flat_map_type>();
+  hash_exception_tests<flat_set_type>();
+  hash_exception_tests<node_map_type>();
+  hash_exception_tests<node_set_type>();
+  constructor_exception_tests<
+    boost::unordered_flat_map<throwing_int, int, throwing_int_hash> >();
+  constructor_exception_tests<
+    boost::unordered_node_map<throwing_int, int, throwing_int_hash> >();
+}
+
+UNORDERED_AUTO_TEST (bulk_insert_input_iterators) {
+  input_iterator_tests<flat_map_type>();
+  input_iterator_tests<flat_set_type>();
+  input_iterator_tests<node_map_type>();
+  input_iterator_tests<node_set_type>();
+}
+#endif
+
+RUN_TESTS()
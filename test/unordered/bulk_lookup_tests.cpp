@@ -0,0 +1,160 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_UNORDERED_FOA_TESTS)
+#error "bulk_lookup_tests is currently only supported by open-addressed containers"
+#else
+
+#include "../helpers/unordered.hpp"
+
+#include "../helpers/helpers.hpp"
+#include "../helpers/random_values.hpp"
+#include "../helpers/test.hpp"
+#include "../objects/test.hpp"
+
+#include <vector>
+
+template <class X>
+void bulk_lookup_tests(X*, test::random_generator generator)
+{
+  typedef typename X::key_type key_type;
+  typedef typename X::iterator iterator;
+  typedef typename X::const_iterator const_iterator;
+  typedef typename X::value_type value_type;
+
+  test::reset_sequence();
+
+  for (std::size_t n : {0u, 1u, 15u, 16u, 17u, 31u, 32u, 100u, 1000u}) {
+    test::random_values<X> v(n, generator);
+    X x;
+    X const& cx = x;
+
+    std::vector<key_type> keys;
+    std::size_t i = 0;
+    for (auto const& value : v) {
+      keys.push_back(test::get_key<X>(value));
+      if (i++ % 2) x.insert(value);
+    }
+
+    std::vector<iterator> its;
+    x.find_many(keys.begin(), keys.end(), std::back_inserter(its));
+    BOOST_TEST_EQ(its.size(), keys.size());
+
+    std::vector<const_iterator> cits;
+    cx.find_many(keys.begin(), keys.end(), std::back_inserter(cits));
+    BOOST_TEST_EQ(cits.size(), keys.size());
+
+    std::vector<bool> hits;
+    cx.contains_many(keys.begin(), keys.end(), std::back_inserter(hits));
+    BOOST_TEST_EQ(hits.size(), keys.size());
+
+    std::size_t num_found = 0;
+    for (std::size_t j = 0; j < keys.size(); ++j) {
+      BOOST_TEST(its[j] == x.find(keys[j]));
+      BOOST_TEST(cits[j] == cx.find(keys[j]));
+      BOOST_TEST_EQ(hits[j], x.contains(keys[j]));
+      if (hits[j]) ++num_found;
+    }
+
+    std::size_t num_visited = 0;
+    BOOST_TEST_EQ(
+      x.visit(keys.begin(), keys.end(),
+        [&](value_type const& value) {
+          BOOST_TEST(x.contains(test::get_key<X>(value)));
+          ++num_visited;
+        }),
+      num_found);
+    BOOST_TEST_EQ(num_visited, num_found);
+
+    num_visited = 0;
+    BOOST_TEST_EQ(
+      cx.visit(keys.begin(), keys.end(),
+        [&](value_type const&) { ++num_visited; }),
+      num_found);
+    BOOST_TEST_EQ(num_visited, num_found);
+
+    num_visited = 0;
+    BOOST_TEST_EQ(
+      x.cvisit(keys.begin(), keys.end(),
+        [&](value_type const&) { ++num_visited; }),
+      num_found);
+    BOOST_TEST_EQ(num_visited, num_found);
+  }
+}
+
+struct transparent_hash
+{
+  typedef void is_transparent;
+
+  std::size_t operator()(int x) const { return boost::hash<int>()(x); }
+  std::size_t operator()(long x) const
+  {
+    return boost::hash<int>()(static_cast<int>(x));
+  }
+};
+
+struct transparent_equal_to
+{
+  typedef void is_transparent;
+
+  template <class T, class U> bool operator()(T const& x, U const& y) const
+  {
+    return static_cast<long>(x) == static_cast<long>(y);
+  }
+};
+
+template <class X> void bulk_lookup_transparent_tests(X*)
+{
+  X x;
+  for (int i = 0; i < 100; ++i) {
+    x.insert(i * 2);
+  }
+
+  std::vector<long> keys;
+  for (long i = 0; i < 200; ++i) {
+    keys.push_back(i);
+  }
+
+  std::vector<bool> hits;
+  x.contains_many(keys.begin(), keys.end(), std::back_inserter(hits));
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    BOOST_TEST_EQ(hits[i], keys[i] % 2 == 0);
+  }
+
+  BOOST_TEST_EQ(
+    x.cvisit(keys.begin(), keys.end(), [](int const&) {}), x.size());
+}
+
+using test::default_generator;
+using test::generate_collisions;
+using test::limited_range;
+
+boost::unordered_flat_set<test::object, test::hash, test::equal_to,
+  test::allocator1<test::object> >* test_set;
+boost::unordered_flat_map<test::object, test::object, test::hash,
+  test::equal_to,
+  test::allocator1<std::pair<test::object const, test::object> > >* test_map;
+boost::unordered_node_set<test::object, test::hash, test::equal_to,
+  test::allocator1<test::object> >* test_node_set;
+boost::unordered_node_map<test::object, test::object, test::hash,
+  test::equal_to,
+  test::allocator1<std::pair<test::object const, test::object> > >*
+  test_node_map;
+
+boost::unordered_flat_set<int, transparent_hash, transparent_equal_to>*
+  transparent_set;
+boost::unordered_node_set<int, transparent_hash, transparent_equal_to>*
+  transparent_node_set;
+
+// clang-format off
+UNORDERED_TEST(bulk_lookup_tests,
+  ((test_set)(test_map)(test_node_set)(test_node_map))(
+    (default_generator)(generate_collisions)(limited_range)))
+
+UNORDERED_TEST(bulk_lookup_transparent_tests,
+  ((transparent_set)(transparent_node_set)))
+// clang-format on
+#endif
+
+RUN_TESTS()
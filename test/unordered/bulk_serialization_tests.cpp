@@ -0,0 +1,381 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_UNORDERED_FOA_TESTS)
+#error "bulk_serialization_tests is currently only supported by open-addressed containers"
+#else
+
+// temporary #define till all transitive includes comply with
+// https://github.com/boostorg/core/commit/5f6fe65
+
+#define BOOST_ALLOW_DEPRECATED_HEADERS
+
+#include "../helpers/unordered.hpp"
+
+#include "../helpers/int_keys.hpp"
+#include "../helpers/test.hpp"
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/serialization/is_bitwise_serializable.hpp>
+#include <boost/serialization/nvp.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+#include <boost/unordered/concurrent_flat_map.hpp>
+#include <boost/unordered/concurrent_flat_set.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+struct seeded_hash
+{
+  std::size_t seed = 0;
+
+  seeded_hash() = default;
+  seeded_hash(std::size_t seed_) : seed(seed_) {}
+
+  template <class T> std::size_t operator()(T const& x) const
+  {
+    return boost::hash<T>()(x) ^ seed;
+  }
+};
+
+struct stored_hash
+{
+  using stored_hash_type = std::size_t;
+
+  template <class T> std::size_t operator()(T const& x) const
+  {
+    return boost::hash<T>()(x);
+  }
+};
+
+struct bulk_point
+{
+  int x, y;
+
+  friend bool operator==(bulk_point const& p, bulk_point const& q)
+  {
+    return p.x == q.x && p.y == q.y;
+  }
+
+  friend std::size_t hash_value(bulk_point const& p)
+  {
+    return boost::hash<int>()(p.x) * 31 + boost::hash<int>()(p.y);
+  }
+
+  template <class Archive> void serialize(Archive& ar, unsigned int)
+  {
+    ar& boost::serialization::make_nvp("x", x);
+    ar& boost::serialization::make_nvp("y", y);
+  }
+};
+
+BOOST_IS_BITWISE_SERIALIZABLE(bulk_point)
+
+std::uint64_t random_key(std::uint64_t& state)
+{
+  state = state * 6364136223846793005ull + 1442695040888963407ull;
+  return state;
+}
+
+template <class X> std::string save(X const& x)
+{
+  std::ostringstream oss;
+  {
+    boost::archive::binary_oarchive oa(oss);
+    oa << boost::serialization::make_nvp("container", x);
+  }
+  return oss.str();
+}
+
+template <class X> void load(std::string const& str, X& x)
+{
+  std::istringstream iss(str);
+  boost::archive::binary_iarchive ia(iss);
+  ia >> boost::serialization::make_nvp("container", x);
+}
+
+using test::insert_key;
+
+// position of the bulk_serialization_header saved for x in str
+
+template <class X> std::size_t header_position(std::string const& str)
+{
+  using header = boost::unordered::detail::foa::bulk_serialization_header;
+
+  boost::uint32_t pattern[] = {boost::unordered::detail::foa::arrays_layout,
+    sizeof(std::size_t), BOOST_UNORDERED_GROUP_SIZE + 1,
+    sizeof(typename X::value_type)};
+  auto pos = str.find(
+    std::string(reinterpret_cast<char const*>(pattern), sizeof(pattern)));
+  BOOST_TEST(pos != std::string::npos);
+  return pos == std::string::npos ? pos : pos - offsetof(header, layout);
+}
+
+// overwrites the layout of the group array recorded in the archive so that
+// loading can't restore the array verbatim
+
+template <class X> void tamper_layout(std::string& str)
+{
+  using header = boost::unordered::detail::foa::bulk_serialization_header;
+
+  auto pos = header_position<X>(str);
+  if (pos != std::string::npos) str[pos + offsetof(header, layout)] ^= 0x7f;
+}
+
+template <class X> void round_trip_tests(X const& x)
+{
+  using iterator = typename X::const_iterator;
+
+  std::vector<iterator> v;
+  for (auto it = x.begin();; ++it) {
+    v.push_back(it);
+    if (it == x.end()) break;
+  }
+
+  std::ostringstream oss;
+  {
+    boost::archive::binary_oarchive oa(oss);
+    oa << boost::serialization::make_nvp("container", x);
+    oa << boost::serialization::make_nvp("iterators", v);
+  }
+
+  X y(x); // previous contents are discarded on loading
+  std::vector<iterator> w;
+  std::istringstream iss(oss.str());
+  boost::archive::binary_iarchive ia(iss);
+  ia >> boost::serialization::make_nvp("container", y);
+  ia >> boost::serialization::make_nvp("iterators", w);
+
+  BOOST_TEST(x == y);
+  BOOST_TEST_EQ(y.bucket_count(), x.bucket_count());
+  BOOST_TEST_EQ(y.max_load(), x.max_load());
+  BOOST_TEST_EQ(w.size(), v.size());
+  for (std::size_t i = 0; i < v.size() && i < w.size(); ++i) {
+    if (v[i] == x.end()) {
+      BOOST_TEST(w[i] == y.end());
+    } else {
+      BOOST_TEST(w[i] != y.end());
+      if (w[i] != y.end()) BOOST_TEST(*w[i] == *v[i]);
+    }
+  }
+}
+
+template <class X> void flat_tests()
+{
+  {
+    X x;
+    round_trip_tests(x);
+    x.reserve(1000);
+    round_trip_tests(x);
+  }
+
+  X x;
+  for (int i = 0; i < 100000; ++i) insert_key(x, i);
+  round_trip_tests(x);
+
+  // overflow bits of erased elements are kept
+
+  for (int i = 0; i < 100000; i += 3) x.erase(i);
+  round_trip_tests(x);
+  {
+    X y;
+    load(save(x), y);
+    for (int i = 0; i < 100000; i += 3) BOOST_TEST(!y.contains(i));
+    for (int i = 100000; i < 200000; ++i) insert_key(y, i);
+    for (int i = 100000; i < 200000; ++i) insert_key(x, i);
+    BOOST_TEST(x == y);
+  }
+
+  // table being incrementally rehashed: saved element-wise
+
+  X z;
+  z.incremental_rehash(true);
+  for (int i = 0; i < 100000; ++i) insert_key(z, i);
+  round_trip_tests(z);
+
+  // layout mismatch: elements reinserted
+
+  {
+    auto str = save(x);
+    tamper_layout<X>(str);
+    X y;
+    load(str, y);
+    BOOST_TEST(x == y);
+  }
+}
+
+static void random_key_tests()
+{
+  boost::unordered_flat_map<std::uint64_t, std::uint64_t> x;
+  std::uint64_t state = 0;
+  for (int i = 0; i < 100000; ++i) {
+    auto k = random_key(state);
+    x.emplace(k, k / 2);
+  }
+  round_trip_tests(x);
+}
+
+static void stored_hash_tests()
+{
+  boost::unordered_flat_map<int, int, stored_hash> x;
+  for (int i = 0; i < 50000; ++i) x.emplace(i, i);
+  round_trip_tests(x);
+
+  boost::unordered_flat_map<int, int, stored_hash> y;
+  load(save(x), y);
+  y.rehash(4 * y.bucket_count()); // uses loaded hashes
+  BOOST_TEST(x == y);
+}
+
+static void user_type_tests()
+{
+  boost::unordered_flat_set<bulk_point> x;
+  for (int i = 0; i < 1000; ++i) x.insert(bulk_point{i, -i});
+  round_trip_tests(x);
+}
+
+static void hash_mismatch_tests()
+{
+  using map_type = boost::unordered_flat_map<int, int, seeded_hash>;
+
+  map_type x(0, seeded_hash(12345));
+  for (int i = 0; i < 10000; ++i) x.emplace(i, i);
+
+  std::vector<map_type::iterator> v;
+  for (auto it = x.begin(); it != x.end(); ++it) v.push_back(it);
+
+  std::ostringstream oss;
+  {
+    boost::archive::binary_oarchive oa(oss);
+    oa << boost::serialization::make_nvp("container", x);
+    oa << boost::serialization::make_nvp("iterators", v);
+  }
+
+  map_type y(0, seeded_hash(54321));
+  std::vector<map_type::iterator> w;
+  std::istringstream iss(oss.str());
+  boost::archive::binary_iarchive ia(iss);
+  ia >> boost::serialization::make_nvp("container", y);
+  ia >> boost::serialization::make_nvp("iterators", w);
+
+  BOOST_TEST_EQ(y.hash_function().seed, 54321u);
+  BOOST_TEST(x == y);
+  for (int i = 0; i < 10000; ++i) BOOST_TEST_EQ(y.at(i), i);
+  BOOST_TEST_EQ(w.size(), v.size());
+  for (std::size_t i = 0; i < v.size() && i < w.size(); ++i) {
+    BOOST_TEST(*w[i] == *v[i]);
+  }
+}
+
+static void elementwise_tests()
+{
+  // not bitwise serializable
+
+  boost::unordered_flat_map<int, std::string> x;
+  for (int i = 0; i < 1000; ++i) x.emplace(i, std::to_string(i));
+  round_trip_tests(x);
+
+  // not a binary archive
+
+  boost::unordered_flat_map<int, int> y;
+  for (int i = 0; i < 1000; ++i) y.emplace(i, i);
+  std::ostringstream oss;
+  {
+    boost::archive::text_oarchive oa(oss);
+    oa << boost::serialization::make_nvp("container", y);
+  }
+  boost::unordered_flat_map<int, int> z;
+  std::istringstream iss(oss.str());
+  boost::archive::text_iarchive ia(iss);
+  ia >> boost::serialization::make_nvp("container", z);
+  BOOST_TEST(y == z);
+}
+
+static void corrupt_archive_tests()
+{
+  using set_type = boost::unordered_flat_set<int>;
+  using header = boost::unordered::detail::foa::bulk_serialization_header;
+
+  set_type x;
+  for (int i = 0; i < 1000; ++i) x.insert(i);
+
+  // element count not matching the group array
+
+  auto str = save(x);
+  auto pos = header_position<set_type>(str);
+  if (pos != std::string::npos) {
+    str[pos + offsetof(header, size)] ^= 1;
+    set_type y;
+    BOOST_TEST_THROWS(
+      load(str, y), boost::unordered::detail::bad_archive_exception);
+  }
+
+  // element counts not fitting in the group array, with a different layout
+  // so that elements would be reinserted: rejected before allocating
+
+  for (int i = 0; i < 2; ++i) {
+    str = save(x);
+    pos = header_position<set_type>(str);
+    if (pos == std::string::npos) break;
+    tamper_layout<set_type>(str);
+
+    header hd;
+    std::memcpy(&hd, &str[pos], sizeof(hd));
+    hd.size =
+      i == 0 ? std::uint64_t(1) << 60 : hd.num_groups * hd.group_size + 1;
+    std::memcpy(&str[pos], &hd, sizeof(hd));
+    set_type y;
+    BOOST_TEST_THROWS(
+      load(str, y), boost::unordered::detail::bad_archive_exception);
+    BOOST_TEST(y.empty());
+  }
+}
+
+template <class X> void concurrent_tests()
+{
+  X x;
+  for (int i = 0; i < 100000; ++i) insert_key(x, i);
+  for (int i = 0; i < 100000; i += 3) x.erase(i);
+
+  X y;
+  load(save(x), y);
+  BOOST_TEST(x == y);
+  for (int i = 0; i < 100000; ++i) BOOST_TEST_EQ(y.contains(i), i % 3 != 0);
+
+  auto str = save(x);
+  tamper_layout<X>(str);
+  X z;
+  load(str, z);
+  BOOST_TEST(x == z);
+}
+
+UNORDERED_AUTO_TEST (bulk_serialization) {
+  flat_tests<boost::unordered_flat_map<int, int> >();
+  flat_tests<boost::unordered_flat_set<int> >();
+  random_key_tests();
+  stored_hash_tests();
+  user_type_tests();
+}
+
+UNORDERED_AUTO_TEST (bulk_serialization_fallback) {
+  hash_mismatch_tests();
+  elementwise_tests();
+  corrupt_archive_tests();
+}
+
+UNORDERED_AUTO_TEST (bulk_serialization_concurrent) {
+  concurrent_tests<boost::concurrent_flat_map<int, int> >();
+  concurrent_tests<boost::concurrent_flat_set<int> >();
+}
+
+#endif
+
+RUN_TESTS()
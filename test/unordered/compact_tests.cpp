@@ -0,0 +1,225 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_UNORDERED_FOA_TESTS)
+#error "compact_tests is currently only supported by open-addressed containers"
+#else
+
+#include "../helpers/unordered.hpp"
+
+#include "../helpers/bad_hash.hpp"
+#include "../helpers/counting_allocator.hpp"
+#include "../helpers/int_keys.hpp"
+#include "../helpers/test.hpp"
+
+#include <boost/unordered/concurrent_flat_map.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <map>
+#include <set>
+#include <vector>
+
+using test::counting_allocator;
+
+// hash concentrating positions on a few groups, so that most elements are
+// displaced from their initial group
+
+using bad_hash = test::bad_hash<16>;
+
+using test::get_key;
+using test::insert_key;
+
+template <class X> bool check(X const& x, std::set<int> const& ref)
+{
+  if (x.size() != ref.size()) return false;
+  for (int k : ref) {
+    if (!x.contains(k)) return false;
+  }
+  return true;
+}
+
+template <class X>
+void erase_until_max_load_drops(X& x, std::set<int>& ref, int& next_key)
+{
+  // replace random elements until an erasure lowers max_load
+
+  boost::detail::splitmix64 rng;
+  std::size_t const initial_max_load = x.max_load();
+  for (int i = 0; i < 100000; ++i) {
+    auto it = ref.lower_bound(static_cast<int>(rng() % next_key));
+    if (it == ref.end()) it = ref.begin();
+    int k = *it;
+    x.erase(k);
+    ref.erase(it);
+    if (x.max_load() != initial_max_load) break;
+    insert_key(x, next_key);
+    ref.insert(next_key++);
+  }
+  BOOST_TEST_LT(x.max_load(), initial_max_load);
+}
+
+template <class X> void compact_tests()
+{
+  X x;
+  x.compact();
+  BOOST_TEST(x.empty());
+
+  std::set<int> ref;
+  int next_key = 0;
+  for (; next_key < 10000 || x.size() < x.max_load(); ++next_key) {
+    insert_key(x, next_key);
+    ref.insert(next_key);
+  }
+
+  std::size_t const initial_max_load = x.max_load();
+  std::size_t const bucket_count = x.bucket_count();
+  erase_until_max_load_drops(x, ref, next_key);
+  x.compact();
+  BOOST_TEST_EQ(x.max_load(), initial_max_load);
+  BOOST_TEST_EQ(x.bucket_count(), bucket_count);
+  BOOST_TEST(check(x, ref));
+  for (int i = 0; i < next_key; ++i) {
+    BOOST_TEST_EQ(x.contains(i), ref.count(i) != 0);
+  }
+  x.compact();
+  BOOST_TEST(check(x, ref));
+}
+
+template <class X> void churn_tests(std::size_t allocations_per_insertion)
+{
+  // steady insert/erase at constant size does not reallocate
+
+  boost::detail::splitmix64 rng;
+  std::vector<int> keys;
+  std::set<int> ref;
+  int const n = 10000;
+
+  X x;
+  x.reserve(n + n / 4);
+  for (int i = 0; i < n; ++i) {
+    insert_key(x, i);
+    keys.push_back(i);
+    ref.insert(i);
+  }
+
+  std::size_t const bucket_count = x.bucket_count();
+  std::size_t const num_allocations = test::counted_allocations;
+  int next_key = n;
+  for (int i = 0; i < 20 * n; ++i) {
+    std::size_t j = static_cast<std::size_t>(rng() % keys.size());
+    BOOST_TEST_EQ(x.erase(keys[j]), 1u);
+    ref.erase(keys[j]);
+    keys[j] = next_key++;
+    insert_key(x, keys[j]);
+    ref.insert(keys[j]);
+  }
+  BOOST_TEST_EQ(x.bucket_count(), bucket_count);
+  BOOST_TEST_EQ(test::counted_allocations - num_allocations,
+    allocations_per_insertion * static_cast<std::size_t>(20 * n));
+  BOOST_TEST(check(x, ref));
+}
+
+template <class X> void stability_tests()
+{
+  // compact may move nodes around, but not the elements themselves
+
+  X x;
+  for (int i = 0; i < 1000; ++i) {
+    insert_key(x, i);
+  }
+  for (int i = 0; i < 1000; i += 3) {
+    x.erase(i);
+  }
+
+  std::map<int, typename X::value_type const*> addresses;
+  for (auto const& v : x) {
+    addresses[get_key(x, v)] = &v;
+  }
+  x.compact();
+  std::size_t i = 0;
+  for (auto const& v : x) {
+    BOOST_TEST_EQ(&v, addresses[get_key(x, v)]);
+    ++i;
+  }
+  BOOST_TEST_EQ(i, addresses.size());
+}
+
+template <class X> void incremental_rehash_tests()
+{
+  std::set<int> ref;
+
+  X x;
+  x.incremental_rehash(true);
+  for (int i = 0; i < 5000; ++i) {
+    insert_key(x, i);
+    ref.insert(i);
+    if (i % 3 == 0) {
+      x.erase(i / 2);
+      ref.erase(i / 2);
+    }
+    if (i % 500 == 0) {
+      x.compact();
+      BOOST_TEST(check(x, ref));
+    }
+  }
+  BOOST_TEST(check(x, ref));
+}
+
+template <class X> void concurrent_compact_tests()
+{
+  X x;
+  std::set<int> ref;
+  int next_key = 0;
+  for (; next_key < 10000 || x.size() < x.max_load(); ++next_key) {
+    x.emplace(next_key, next_key);
+    ref.insert(next_key);
+  }
+
+  std::size_t const initial_max_load = x.max_load();
+  erase_until_max_load_drops(x, ref, next_key);
+  x.compact();
+  BOOST_TEST_EQ(x.max_load(), initial_max_load);
+  for (int i = 0; i < next_key; ++i) {
+    BOOST_TEST_EQ(x.contains(i), ref.count(i) != 0);
+  }
+}
+
+template <class T> using alloc = counting_allocator<T>;
+
+UNORDERED_AUTO_TEST (compact) {
+  compact_tests<boost::unordered_flat_map<int, int> >();
+  compact_tests<boost::unordered_flat_set<int> >();
+  compact_tests<boost::unordered_node_map<int, int> >();
+  compact_tests<boost::unordered_node_set<int> >();
+  compact_tests<boost::unordered_flat_map<int, int, bad_hash> >();
+  compact_tests<boost::unordered_node_set<int, bad_hash> >();
+}
+
+UNORDERED_AUTO_TEST (compact_churn) {
+  churn_tests<boost::unordered_flat_map<int, int, boost::hash<int>,
+    std::equal_to<int>, alloc<std::pair<int const, int> > > >(0);
+  churn_tests<boost::unordered_flat_set<int, boost::hash<int>,
+    std::equal_to<int>, alloc<int> > >(0);
+  churn_tests<boost::unordered_node_map<int, int, boost::hash<int>,
+    std::equal_to<int>, alloc<std::pair<int const, int> > > >(1);
+  churn_tests<boost::unordered_node_set<int, boost::hash<int>,
+    std::equal_to<int>, alloc<int> > >(1);
+}
+
+UNORDERED_AUTO_TEST (compact_stability) {
+  stability_tests<boost::unordered_node_map<int, int> >();
+  stability_tests<boost::unordered_node_set<int, bad_hash> >();
+}
+
+UNORDERED_AUTO_TEST (compact_incremental_rehash) {
+  incremental_rehash_tests<boost::unordered_flat_map<int, int> >();
+  incremental_rehash_tests<boost::unordered_node_set<int, bad_hash> >();
+}
+
+UNORDERED_AUTO_TEST (compact_concurrent) {
+  concurrent_compact_tests<boost::concurrent_flat_map<int, int> >();
+  concurrent_compact_tests<boost::concurrent_flat_map<int, int, bad_hash> >();
+}
+#endif
+
+RUN_TESTS()
@@ -0,0 +1,152 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_UNORDERED_FOA_TESTS)
+#error "fine_grained_sizes_tests is currently only supported by open-addressed containers"
+#else
+
+#define BOOST_UNORDERED_FINE_GRAINED_SIZES
+
+#include "../helpers/unordered.hpp"
+
+#include "../helpers/bad_hash.hpp"
+#include "../helpers/test.hpp"
+
+#include <boost/unordered/detail/foa/core.hpp>
+#include <vector>
+
+static void size_policy_tests()
+{
+  using boost::unordered::detail::foa::fastrange_size_policy;
+  using boost::unordered::detail::foa::pow2_size_policy;
+
+  BOOST_TEST_EQ(fastrange_size_policy::min_size(), 2u);
+  BOOST_TEST_EQ(fastrange_size_policy::size(fastrange_size_policy::size_index(0)),
+    fastrange_size_policy::min_size());
+
+  std::size_t prev = 0;
+  for (std::size_t n = 0; n < 100000; ++n) {
+    std::size_t size =
+      fastrange_size_policy::size(fastrange_size_policy::size_index(n));
+    BOOST_TEST_GE(size, n);
+    BOOST_TEST_GE(size, prev);
+    if (size != prev && prev != 0) {
+      // growth ladder steps are either 1.5x or 1.33x
+      BOOST_TEST(size * 2 == prev * 3 || size * 3 == prev * 4);
+    }
+    prev = size;
+  }
+
+  // positions are in range and match pow2_size_policy for power-of-two sizes
+  for (std::size_t n : {2u, 3u, 4u, 6u, 8u, 12u, 1024u, 1536u}) {
+    std::size_t index = fastrange_size_policy::size_index(n);
+    std::size_t pow2_index = pow2_size_policy::size_index(n);
+    bool is_pow2 = (n & (n - 1)) == 0;
+
+    std::size_t hash = 0;
+    for (int i = 0; i < 1000; ++i) {
+      hash = static_cast<std::size_t>(
+        hash * 6364136223846793005ull + 1442695040888963407ull);
+      std::size_t pos = fastrange_size_policy::position(hash, index);
+      BOOST_TEST_LT(pos, n);
+      if (is_pow2) {
+        BOOST_TEST_EQ(pos, pow2_size_policy::position(hash, pow2_index));
+      }
+    }
+  }
+}
+
+static void prober_tests()
+{
+  using boost::unordered::detail::foa::covering_quadratic_prober;
+
+  for (std::size_t size = 2; size < 200; ++size) {
+    for (std::size_t pos0 = 0; pos0 < size; ++pos0) {
+      std::vector<bool> visited(size, false);
+      std::size_t num_visited = 0;
+      covering_quadratic_prober pb(pos0);
+      do {
+        BOOST_TEST_LT(pb.get(), size);
+        if (pb.get() < size && !visited[pb.get()]) {
+          visited[pb.get()] = true;
+          ++num_visited;
+        }
+      } while (pb.next(size - 1));
+      BOOST_TEST_EQ(num_visited, size);
+    }
+  }
+}
+
+// hash concentrating positions on a small number of groups, stresses probing
+
+using bad_hash = test::bad_hash<7>;
+
+template <class X> void fine_grained_sizes_tests()
+{
+  int const n = 10000;
+
+  X x;
+  std::size_t prev_bucket_count = x.bucket_count();
+  for (int i = 0; i < n; ++i) {
+    x.emplace(i, i);
+    if (x.bucket_count() != prev_bucket_count) {
+      BOOST_TEST_LE(x.bucket_count(), prev_bucket_count * 3 / 2 + 32);
+      prev_bucket_count = x.bucket_count();
+    }
+  }
+  BOOST_TEST_EQ(x.size(), static_cast<std::size_t>(n));
+  for (int i = 0; i < n; ++i) {
+    BOOST_TEST(x.contains(i));
+  }
+  BOOST_TEST(!x.contains(n));
+
+  for (int i = 0; i < n; i += 3) {
+    x.erase(i);
+  }
+  for (std::size_t m : {0u, 5000u, 7000u, 12345u, 30000u}) {
+    x.rehash(m);
+    BOOST_TEST_GE(x.bucket_count(), m);
+    for (int i = 0; i < n; ++i) {
+      BOOST_TEST_EQ(x.contains(i), i % 3 != 0);
+    }
+  }
+}
+
+template <class X> void bad_hash_tests()
+{
+  int const n = 2000;
+
+  X x;
+  for (int i = 0; i < n; ++i) {
+    x.emplace(i, i);
+  }
+  BOOST_TEST_EQ(x.size(), static_cast<std::size_t>(n));
+  for (int i = 0; i < n; ++i) {
+    BOOST_TEST(x.contains(i));
+  }
+  for (int i = n; i < 2 * n; ++i) {
+    BOOST_TEST(!x.contains(i));
+  }
+}
+
+UNORDERED_AUTO_TEST (size_policy) {
+  size_policy_tests();
+}
+
+UNORDERED_AUTO_TEST (prober) {
+  prober_tests();
+}
+
+UNORDERED_AUTO_TEST (fine_grained_sizes) {
+  fine_grained_sizes_tests<boost::unordered_flat_map<int, int> >();
+  fine_grained_sizes_tests<boost::unordered_node_map<int, int> >();
+}
+
+UNORDERED_AUTO_TEST (fine_grained_sizes_bad_hash) {
+  bad_hash_tests<boost::unordered_flat_map<int, int, bad_hash> >();
+  bad_hash_tests<boost::unordered_node_map<int, int, bad_hash> >();
+}
+#endif
+
+RUN_TESTS()
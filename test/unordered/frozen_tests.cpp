@@ -0,0 +1,316 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_UNORDERED_FOA_TESTS)
+#error "frozen_tests is currently only supported by open-addressed containers"
+#else
+
+#include "../helpers/unordered.hpp"
+
+#include "../helpers/test.hpp"
+
+#include <boost/unordered/frozen_flat_map.hpp>
+#include <boost/unordered/frozen_flat_set.hpp>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+struct transparent_hash
+{
+  using is_transparent = void;
+
+  std::size_t operator()(int x) const { return boost::hash<int>()(x); }
+  std::size_t operator()(long x) const
+  {
+    return boost::hash<int>()(static_cast<int>(x));
+  }
+};
+
+struct transparent_equal
+{
+  using is_transparent = void;
+
+  template <class T, class U> bool operator()(T x, U y) const
+  {
+    return static_cast<long>(x) == static_cast<long>(y);
+  }
+};
+
+// few distinct hash values, so that groups overflow heavily
+
+struct clustering_hash
+{
+  std::size_t operator()(int x) const
+  {
+    return boost::hash<int>()(x % 64);
+  }
+};
+
+// copy construction throws after a given number of copies
+
+struct throwing_key
+{
+  static int live;
+  static int copies_left;
+
+  int x;
+
+  throwing_key(int x_) : x(x_) { ++live; }
+  throwing_key(throwing_key const& k) : x(k.x)
+  {
+    if (copies_left-- == 0) throw std::runtime_error("throwing_key");
+    ++live;
+  }
+  ~throwing_key() { --live; }
+
+  friend bool operator==(throwing_key const& k, throwing_key const& l)
+  {
+    return k.x == l.x;
+  }
+
+  friend std::size_t hash_value(throwing_key const& k)
+  {
+    return boost::hash<int>()(k.x);
+  }
+};
+
+int throwing_key::live = 0;
+int throwing_key::copies_left = -1;
+
+template <class F, class X> void check_frozen_map(F const& f, X const& x)
+{
+  BOOST_TEST_EQ(f.size(), x.size());
+  BOOST_TEST_EQ(f.empty(), x.empty());
+  BOOST_TEST_LE(f.load_factor(), boost::unordered::detail::foa::mlf);
+
+  std::size_t n = 0;
+  for (auto it = f.cbegin(); it != f.cend(); ++it) {
+    BOOST_TEST(x.find(it->first) != x.end());
+    BOOST_TEST(x.at(it->first) == it->second);
+    ++n;
+  }
+  BOOST_TEST_EQ(n, x.size());
+  for (auto const& e : x) {
+    BOOST_TEST(f.contains(e.first));
+    BOOST_TEST_EQ(f.count(e.first), 1u);
+    BOOST_TEST(f.at(e.first) == e.second);
+    auto it = f.find(e.first);
+    BOOST_TEST(it != f.end());
+    if (it != f.end()) BOOST_TEST(*it == e);
+    auto r = f.equal_range(e.first);
+    BOOST_TEST(r.first == it);
+    BOOST_TEST_EQ(std::distance(r.first, r.second), 1);
+  }
+}
+
+static void map_tests()
+{
+  using map_type = boost::unordered_flat_map<int, long>;
+  using frozen_type = boost::frozen_flat_map<int, long>;
+
+  {
+    frozen_type f;
+    BOOST_TEST(f.empty());
+    BOOST_TEST(f.begin() == f.end());
+    BOOST_TEST(f.find(0) == f.end());
+    BOOST_TEST_EQ(f.bucket_count(), 0u);
+    BOOST_TEST_EQ(f.load_factor(), 0.0f);
+    BOOST_TEST_THROWS(f.at(0), std::out_of_range);
+  }
+  {
+    map_type x;
+    x.reserve(1000);
+    frozen_type f(x);
+    BOOST_TEST(f.empty());
+    BOOST_TEST(f.begin() == f.end());
+    BOOST_TEST_EQ(f.bucket_count(), 0u);
+  }
+
+  map_type x;
+  for (int i = 0; i < 100000; ++i) x.emplace(i, -i);
+  frozen_type f(x);
+  check_frozen_map(f, x);
+  for (int i = 100000; i < 200000; ++i) {
+    BOOST_TEST(f.find(i) == f.end());
+    BOOST_TEST(!f.contains(i));
+    BOOST_TEST_EQ(f.count(i), 0u);
+  }
+  BOOST_TEST_THROWS(f.at(-1), std::out_of_range);
+
+  // no more memory than a container reserved for the same size
+
+  {
+    map_type y;
+    y.reserve(x.size());
+    BOOST_TEST_LE(f.bucket_count(), y.bucket_count() + 1);
+  }
+
+  // moving from the source container
+
+  {
+    map_type y(x);
+    frozen_type g(std::move(y));
+    BOOST_TEST(y.empty());
+    check_frozen_map(g, x);
+    BOOST_TEST(f == g);
+  }
+
+  // erased elements are not carried over
+
+  for (int i = 0; i < 100000; i += 3) x.erase(i);
+  {
+    frozen_type g(x);
+    check_frozen_map(g, x);
+    for (int i = 0; i < 100000; i += 3) BOOST_TEST(!g.contains(i));
+    BOOST_TEST(f != g);
+  }
+
+  // random keys, so that all slots of groups get occupied
+
+  {
+    boost::unordered_flat_map<std::uint64_t, std::uint64_t> z;
+    std::uint64_t k = 0;
+    for (int i = 0; i < 100000; ++i) {
+      k = k * 6364136223846793005ull + 1442695040888963407ull;
+      z.emplace(k, k / 2);
+    }
+    boost::frozen_flat_map<std::uint64_t, std::uint64_t> g(z);
+    check_frozen_map(g, z);
+    k = 1;
+    for (int i = 0; i < 100000; ++i) {
+      k = k * 6364136223846793005ull + 1442695040888963407ull;
+      BOOST_TEST_EQ(g.contains(k), z.contains(k));
+    }
+  }
+
+  // heavily overflowed groups
+
+  {
+    boost::unordered_flat_map<int, long, clustering_hash> z;
+    for (int i = 0; i < 5000; ++i) z.emplace(i, i);
+    boost::frozen_flat_map<int, long, clustering_hash> g(z);
+    check_frozen_map(g, z);
+    for (int i = 5000; i < 10000; ++i) BOOST_TEST(!g.contains(i));
+  }
+}
+
+static void construction_tests()
+{
+  using map_type = boost::unordered_flat_map<int, std::string>;
+  using frozen_type = boost::frozen_flat_map<int, std::string>;
+
+  std::vector<std::pair<int, std::string> > v;
+  for (int i = 0; i < 10000; ++i) {
+    v.emplace_back(i % 5000, std::string(32, char('a' + i % 26)));
+  }
+  map_type x(v.begin(), v.end());
+
+  // duplicate keys in the range are discarded
+
+  frozen_type f(v.begin(), v.end());
+  check_frozen_map(f, x);
+
+  frozen_type g{{1, "one"}, {2, "two"}, {1, "uno"}};
+  BOOST_TEST_EQ(g.size(), 2u);
+  BOOST_TEST_EQ(g.at(1), "one");
+  BOOST_TEST_EQ(g.at(2), "two");
+
+  // copy, move, assignment, swap
+
+  frozen_type h(f);
+  check_frozen_map(h, x);
+  BOOST_TEST(h == f);
+
+  frozen_type i(std::move(h));
+  check_frozen_map(i, x);
+  BOOST_TEST(h.empty());
+  BOOST_TEST(h.begin() == h.end());
+
+  h = g;
+  BOOST_TEST(h == g);
+  h = std::move(i);
+  check_frozen_map(h, x);
+  BOOST_TEST(i.empty());
+
+  swap(h, g);
+  BOOST_TEST_EQ(h.size(), 2u);
+  check_frozen_map(g, x);
+  h.swap(g);
+  check_frozen_map(h, x);
+}
+
+static void set_tests()
+{
+  using set_type =
+    boost::unordered_flat_set<int, transparent_hash, transparent_equal>;
+  using frozen_type =
+    boost::frozen_flat_set<int, transparent_hash, transparent_equal>;
+
+  set_type x;
+  for (int i = 0; i < 50000; ++i) x.insert(2 * i);
+  frozen_type f(x);
+  BOOST_TEST_EQ(f.size(), x.size());
+
+  std::size_t n = 0;
+  for (auto const& e : f) {
+    BOOST_TEST(x.contains(e));
+    ++n;
+  }
+  BOOST_TEST_EQ(n, x.size());
+  for (long i = 0; i < 100000; ++i) {
+    BOOST_TEST_EQ(f.count(i), i % 2 ? 0u : 1u);
+    BOOST_TEST_EQ(f.contains(static_cast<int>(i)), i % 2 == 0);
+  }
+  BOOST_TEST(*f.find(10L) == 10);
+
+  frozen_type g{3, 1, 2, 3};
+  BOOST_TEST_EQ(g.size(), 3u);
+  BOOST_TEST(g == frozen_type(set_type{1, 2, 3}));
+  BOOST_TEST(g != f);
+}
+
+static void exception_tests()
+{
+  using set_type = boost::unordered_flat_set<throwing_key>;
+  using frozen_type = boost::frozen_flat_set<throwing_key>;
+
+  {
+    set_type x;
+    for (int i = 0; i < 1000; ++i) x.insert(throwing_key(i));
+    BOOST_TEST_EQ(throwing_key::live, 1000);
+
+    throwing_key::copies_left = 500;
+    BOOST_TEST_THROWS((frozen_type(x)), std::runtime_error);
+    BOOST_TEST_EQ(throwing_key::live, 1000);
+
+    throwing_key::copies_left = -1;
+    frozen_type f(x);
+    BOOST_TEST_EQ(throwing_key::live, 2000);
+
+    throwing_key::copies_left = 10;
+    BOOST_TEST_THROWS((frozen_type(f)), std::runtime_error);
+    BOOST_TEST_EQ(throwing_key::live, 2000);
+    throwing_key::copies_left = -1;
+  }
+  BOOST_TEST_EQ(throwing_key::live, 0);
+}
+
+UNORDERED_AUTO_TEST (frozen_map) {
+  map_tests();
+  construction_tests();
+}
+
+UNORDERED_AUTO_TEST (frozen_set) {
+  set_tests();
+}
+
+UNORDERED_AUTO_TEST (frozen_exceptions) {
+  exception_tests();
+}
+
+#endif
+
+RUN_TESTS()
@@ -0,0 +1,129 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_UNORDERED_FOA_TESTS)
+#error "huge_page_tests is currently only supported by open-addressed containers"
+#else
+
+#include "../helpers/unordered.hpp"
+
+#include "../helpers/test.hpp"
+
+#include <boost/unordered/concurrent_flat_map.hpp>
+#include <boost/unordered/concurrent_flat_set.hpp>
+#include <boost/unordered/concurrent_node_map.hpp>
+#include <boost/unordered/concurrent_node_set.hpp>
+#include <boost/unordered/huge_page_allocator.hpp>
+#include <cstdint>
+#include <utility>
+
+template <class T> using huge_alloc = boost::unordered::huge_page_allocator<T>;
+
+static void allocator_tests()
+{
+  using allocator_type = huge_alloc<std::uint64_t>;
+  std::size_t const huge_page_size = allocator_type::huge_page_size;
+
+  allocator_type al;
+  huge_alloc<char> al2(al);
+  BOOST_TEST(al == allocator_type(al2));
+  BOOST_TEST(!(al != allocator_type(al2)));
+
+  for (std::size_t n : {std::size_t(1), std::size_t(1000),
+         huge_page_size / sizeof(std::uint64_t),
+         3 * huge_page_size / sizeof(std::uint64_t) + 5}) {
+    auto p = al.allocate(n);
+    BOOST_TEST(p != nullptr);
+#if defined(BOOST_UNORDERED_HAS_HUGE_PAGES)
+    if (n * sizeof(std::uint64_t) >= huge_page_size) {
+      BOOST_TEST_EQ(reinterpret_cast<std::uintptr_t>(p) % huge_page_size, 0u);
+    }
+#endif
+    for (std::size_t i = 0; i < n; ++i) p[i] = i;
+    for (std::size_t i = 0; i < n; ++i) BOOST_TEST_EQ(p[i], i);
+    al.deallocate(p, n);
+  }
+}
+
+template <class X> void insert_element(X& x, int i, std::true_type /* map */)
+{
+  x.emplace(i, i);
+}
+
+template <class X> void insert_element(X& x, int i, std::false_type /* set */)
+{
+  x.insert(i);
+}
+
+template <class X> void insert_element(X& x, int i)
+{
+  insert_element(x, i,
+    std::integral_constant<bool,
+      !std::is_same<typename X::key_type, typename X::value_type>::value>{});
+}
+
+template <class X> void huge_page_container_tests()
+{
+  int const n = 300000;
+
+  X x;
+  x.prefault(); // no-op on empty container
+  BOOST_TEST(x.empty());
+
+  x.reserve(n);
+  x.prefault();
+  BOOST_TEST(x.empty());
+
+  for (int i = 0; i < n; ++i) insert_element(x, i);
+  x.prefault();
+  BOOST_TEST_EQ(x.size(), static_cast<std::size_t>(n));
+  for (int i = 0; i < 2 * n; ++i) {
+    BOOST_TEST_EQ(x.count(i), i < n ? 1u : 0u);
+  }
+
+  X y(x);
+  BOOST_TEST_EQ(y.size(), x.size());
+  for (int i = 0; i < n; i += 2) x.erase(i);
+  x.rehash(0);
+  x.prefault();
+  BOOST_TEST_EQ(x.size(), static_cast<std::size_t>(n / 2));
+  for (int i = 0; i < n; ++i) {
+    BOOST_TEST_EQ(x.count(i), i % 2 ? 1u : 0u);
+  }
+}
+
+UNORDERED_AUTO_TEST (huge_page_allocator_test) {
+  allocator_tests();
+}
+
+UNORDERED_AUTO_TEST (huge_page_containers) {
+  huge_page_container_tests<boost::unordered_flat_map<int, int,
+    boost::hash<int>, std::equal_to<int>,
+    huge_alloc<std::pair<int const, int> > > >();
+  huge_page_container_tests<boost::unordered_flat_set<int, boost::hash<int>,
+    std::equal_to<int>, huge_alloc<int> > >();
+  huge_page_container_tests<boost::unordered_node_map<int, int,
+    boost::hash<int>, std::equal_to<int>,
+    huge_alloc<std::pair<int const, int> > > >();
+  huge_page_container_tests<boost::unordered_node_set<int, boost::hash<int>,
+    std::equal_to<int>, huge_alloc<int> > >();
+  huge_page_container_tests<boost::concurrent_flat_map<int, int,
+    boost::hash<int>, std::equal_to<int>,
+    huge_alloc<std::pair<int const, int> > > >();
+  huge_page_container_tests<boost::concurrent_flat_set<int, boost::hash<int>,
+    std::equal_to<int>, huge_alloc<int> > >();
+  huge_page_container_tests<boost::concurrent_node_map<int, int,
+    boost::hash<int>, std::equal_to<int>,
+    huge_alloc<std::pair<int const, int> > > >();
+  huge_page_container_tests<boost::concurrent_node_set<int, boost::hash<int>,
+    std::equal_to<int>, huge_alloc<int> > >();
+}
+
+UNORDERED_AUTO_TEST (prefault_default_allocator) {
+  huge_page_container_tests<boost::unordered_flat_map<int, int> >();
+  huge_page_container_tests<boost::concurrent_node_set<int> >();
+}
+#endif
+
+RUN_TESTS()
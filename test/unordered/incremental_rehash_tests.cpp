@@ -0,0 +1,359 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_UNORDERED_FOA_TESTS)
+#error "incremental_rehash_tests is currently only supported by open-addressed containers"
+#else
+
+#include "../helpers/unordered.hpp"
+
+#include "../helpers/bad_hash.hpp"
+#include "../helpers/int_keys.hpp"
+#include "../helpers/test.hpp"
+
+#include <boost/core/detail/splitmix64.hpp>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+struct counting_hash
+{
+  static std::size_t calls;
+  static std::size_t throw_at; // 0: never
+
+  std::size_t operator()(int x) const
+  {
+    if (++calls == throw_at) throw std::runtime_error("");
+    return boost::hash<int>()(x);
+  }
+};
+
+std::size_t counting_hash::calls = 0;
+std::size_t counting_hash::throw_at = 0;
+
+// hash concentrating positions on a few groups, stresses overflow bits of
+// groups already migrated
+
+using bad_hash = test::bad_hash<64>;
+
+using test::get_key;
+using test::insert_key;
+
+template <class X> bool check(X const& x, std::map<int, int> const& ref)
+{
+  if (x.size() != ref.size()) return false;
+  for (auto const& v : ref) {
+    if (!x.contains(v.first)) return false;
+  }
+
+  std::size_t n = 0;
+  for (auto const& v : x) {
+    if (!ref.count(get_key(x, v))) return false;
+    ++n;
+  }
+  return n == ref.size();
+}
+
+template <class X> void latency_tests()
+{
+  using hasher = typename X::hasher;
+
+  int const n = 100000;
+
+  X x;
+  x.incremental_rehash(true);
+  BOOST_TEST(x.incremental_rehash());
+
+  std::size_t max_calls = 0;
+  std::size_t num_growths = 0;
+  std::size_t bucket_count = x.bucket_count();
+  for (int i = 0; i < n; ++i) {
+    hasher::calls = 0;
+    insert_key(x, i);
+    if (hasher::calls > max_calls) max_calls = hasher::calls;
+    if (x.bucket_count() != bucket_count) {
+      ++num_growths;
+      bucket_count = x.bucket_count();
+    }
+  }
+  BOOST_TEST_GT(num_growths, 10u);
+  BOOST_TEST_LT(max_calls, 200u); // as opposed to ~n/2 on last growth
+  BOOST_TEST_EQ(x.size(), static_cast<std::size_t>(n));
+
+  for (int i = 0; i < n; ++i) {
+    BOOST_TEST(x.contains(i));
+  }
+
+  x.incremental_rehash(false);
+  BOOST_TEST(!x.incremental_rehash());
+  hasher::calls = 0;
+  for (int i = n; i < 4 * n; ++i) {
+    insert_key(x, i);
+  }
+  BOOST_TEST_GE(hasher::calls, static_cast<std::size_t>(4 * n));
+}
+
+template <class X> void operation_tests()
+{
+  boost::detail::splitmix64 rng;
+  std::map<int, int> ref;
+
+  X x;
+  x.incremental_rehash(true);
+
+  for (int i = 0; i < 20000; ++i) {
+    int k = static_cast<int>(rng() % 5000);
+    switch (rng() % 8) {
+    case 0:
+    case 1:
+    case 2:
+      insert_key(x, k);
+      ref.emplace(k, k);
+      break;
+    case 3:
+      BOOST_TEST_EQ(x.erase(k), ref.erase(k));
+      break;
+    case 4: {
+      auto it = x.find(k);
+      BOOST_TEST_EQ(it != x.end(), ref.count(k) != 0);
+      if (it != x.end()) {
+        x.erase(it);
+        ref.erase(k);
+      }
+    } break;
+    case 5: {
+      std::vector<int> keys = {k, k + 1, k + 2, k + 3};
+      std::vector<bool> hits;
+      x.contains_many(keys.begin(), keys.end(), std::back_inserter(hits));
+      for (std::size_t j = 0; j < keys.size(); ++j) {
+        BOOST_TEST_EQ(hits[j], ref.count(keys[j]) != 0);
+      }
+    } break;
+    default:
+      for (int j = 0; j < 50; ++j) {
+        int k2 = k + 5000 * (j + 1);
+        insert_key(x, k2);
+        ref.emplace(k2, k2);
+      }
+      break;
+    }
+
+    if (i % 1000 == 0) {
+      switch ((i / 1000) % 6) {
+      case 0: {
+        X y(x);
+        BOOST_TEST(y.incremental_rehash());
+        BOOST_TEST(check(y, ref));
+        BOOST_TEST(y == x);
+      } break;
+      case 1: {
+        X y(std::move(x));
+        BOOST_TEST(check(y, ref));
+        x = std::move(y);
+      } break;
+      case 2: {
+        X y;
+        y = x;
+        BOOST_TEST(check(y, ref));
+        x.swap(y);
+        BOOST_TEST(check(x, ref));
+      } break;
+      case 3: {
+        X y;
+        y.incremental_rehash(true);
+        for (auto const& v : ref) {
+          insert_key(y, v.first);
+        }
+        X z;
+        z.merge(x);
+        BOOST_TEST(x.empty());
+        BOOST_TEST(check(z, ref));
+        x.merge(z);
+        BOOST_TEST(check(x, ref));
+        BOOST_TEST(x == y);
+      } break;
+      case 4:
+        x.rehash(0);
+        BOOST_TEST(check(x, ref));
+        break;
+      default: {
+        for (auto it = x.begin(); it != x.end();) {
+          if (get_key(x, *it) % 7 == 0) {
+            ref.erase(get_key(x, *it));
+            it = x.erase(it);
+          } else {
+            ++it;
+          }
+        }
+        BOOST_TEST(check(x, ref));
+      } break;
+      }
+    }
+  }
+  BOOST_TEST(check(x, ref));
+
+  x.clear();
+  BOOST_TEST(x.empty());
+  BOOST_TEST(x.begin() == x.end());
+  for (int i = 0; i < 1000; ++i) {
+    insert_key(x, i);
+  }
+  BOOST_TEST_EQ(x.size(), 1000u);
+}
+
+template <class X> void pending_migration_tests()
+{
+  // leave migrations pending on destruction, clearing and erase_if
+
+  for (int n : {10, 100, 1000, 10000}) {
+    X x;
+    x.incremental_rehash(true);
+    for (int i = 0; i < n; ++i) {
+      insert_key(x, i);
+    }
+    X w;
+    w.incremental_rehash(true);
+    for (int i = 0; i < n; ++i) {
+      insert_key(w, i);
+    }
+    X y(std::move(x));
+    X z(y);
+    z.clear();
+    BOOST_TEST(z.empty());
+    BOOST_TEST_EQ(
+      boost::unordered::erase_if(y, [](typename X::value_type const&) {
+        return true;
+      }),
+      static_cast<std::size_t>(n));
+  }
+}
+
+template <class X> void const_operation_tests()
+{
+  // const operations traverse old and new arrays without transferring
+  // elements, so references obtained before remain valid
+
+  for (int n : {100, 1000, 10000}) {
+    X x;
+    x.incremental_rehash(true);
+    int m = 0;
+    for (; m < n; ++m) {
+      insert_key(x, m);
+    }
+    for (auto capacity = x.bucket_count(); x.bucket_count() == capacity;
+         ++m) {
+      insert_key(x, m);
+    }
+
+    X const& cx = x;
+    std::vector<typename X::value_type const*> addresses;
+    for (int i = 0; i < m; ++i) {
+      addresses.push_back(&*cx.find(i));
+    }
+    auto check_addresses = [&] {
+      for (int i = 0; i < m; ++i) {
+        BOOST_TEST_EQ(&*cx.find(i), addresses[static_cast<std::size_t>(i)]);
+      }
+    };
+
+    std::vector<int> hits(static_cast<std::size_t>(m), 0);
+    for (auto it = cx.begin(); it != cx.end(); ++it) {
+      ++hits[static_cast<std::size_t>(get_key(x, *it))];
+    }
+    for (int h : hits) {
+      BOOST_TEST_EQ(h, 1);
+    }
+    BOOST_TEST_EQ(
+      static_cast<std::size_t>(std::distance(cx.begin(), cx.end())), cx.size());
+    check_addresses();
+
+    X y(cx);
+    BOOST_TEST_EQ(y.size(), cx.size());
+    BOOST_TEST(y == cx);
+    BOOST_TEST(cx == y);
+    BOOST_TEST(cx == cx);
+    check_addresses();
+
+    X z;
+    z = cx;
+    BOOST_TEST(z == cx);
+    check_addresses();
+
+    y.erase(0);
+    BOOST_TEST(y != cx);
+    BOOST_TEST(cx != y);
+    check_addresses();
+  }
+}
+
+template <class X> void erase_exception_tests()
+{
+  // an exception thrown by the migration step of erase(key) leaves the
+  // element in place
+
+  X x;
+  x.incremental_rehash(true);
+  int m = 0;
+  for (; m < 1000; ++m) {
+    insert_key(x, m);
+  }
+  for (auto capacity = x.bucket_count(); x.bucket_count() == capacity; ++m) {
+    insert_key(x, m);
+  }
+
+  counting_hash::calls = 0;
+  counting_hash::throw_at = 2;
+  BOOST_TEST_THROWS(x.erase(0), std::runtime_error);
+  counting_hash::throw_at = 0;
+  BOOST_TEST(x.contains(0));
+  BOOST_TEST_EQ(x.size(), static_cast<std::size_t>(m));
+  for (int i = 0; i < m; ++i) {
+    BOOST_TEST(x.contains(i));
+  }
+  BOOST_TEST_EQ(
+    static_cast<std::size_t>(std::distance(x.begin(), x.end())), x.size());
+
+  BOOST_TEST_EQ(x.erase(0), 1u);
+  BOOST_TEST(!x.contains(0));
+}
+
+UNORDERED_AUTO_TEST (incremental_rehash_latency) {
+  latency_tests<boost::unordered_flat_map<int, int, counting_hash> >();
+  latency_tests<boost::unordered_flat_set<int, counting_hash> >();
+  latency_tests<boost::unordered_node_map<int, int, counting_hash> >();
+  latency_tests<boost::unordered_node_set<int, counting_hash> >();
+}
+
+UNORDERED_AUTO_TEST (incremental_rehash_operations) {
+  operation_tests<boost::unordered_flat_map<int, int> >();
+  operation_tests<boost::unordered_flat_set<int> >();
+  operation_tests<boost::unordered_node_map<int, int> >();
+  operation_tests<boost::unordered_node_set<int> >();
+  operation_tests<boost::unordered_flat_map<int, int, bad_hash> >();
+  operation_tests<boost::unordered_node_set<int, bad_hash> >();
+}
+
+UNORDERED_AUTO_TEST (incremental_rehash_pending_migration) {
+  pending_migration_tests<boost::unordered_flat_map<int, int> >();
+  pending_migration_tests<boost::unordered_node_set<int> >();
+}
+
+UNORDERED_AUTO_TEST (incremental_rehash_erase_exceptions) {
+  erase_exception_tests<boost::unordered_flat_map<int, int, counting_hash> >();
+  erase_exception_tests<boost::unordered_flat_set<int, counting_hash> >();
+  erase_exception_tests<boost::unordered_node_map<int, int, counting_hash> >();
+  erase_exception_tests<boost::unordered_node_set<int, counting_hash> >();
+}
+
+UNORDERED_AUTO_TEST (incremental_rehash_const_operations) {
+  const_operation_tests<boost::unordered_flat_map<int, int> >();
+  const_operation_tests<boost::unordered_flat_set<int> >();
+  const_operation_tests<boost::unordered_node_map<int, int> >();
+  const_operation_tests<boost::unordered_node_set<int> >();
+  const_operation_tests<boost::unordered_flat_map<int, int, bad_hash> >();
+}
+#endif
+
+RUN_TESTS()
@@ -9,6 +9,7 @@
 #include "../helpers/test.hpp"
 #include <boost/limits.hpp>
 #include "../helpers/random_values.hpp"
+#include <iterator>
 
 #if defined(BOOST_MSVC)
 #pragma warning(push)
@@ -26,12 +27,13 @@ namespace load_factor_tests {
     BOOST_TEST(x.max_load_factor() == boost::unordered::detail::foa::mlf);
     BOOST_TEST(x.load_factor() == 0);
 
-    // A valid implementation could fail these tests, but I think they're
-    // reasonable.
+    // Values are clamped to [min_mlf, max_mlf]
     x.max_load_factor(2.0);
-    BOOST_TEST(x.max_load_factor() == boost::unordered::detail::foa::mlf);
+    BOOST_TEST(x.max_load_factor() == boost::unordered::detail::foa::max_mlf);
     x.max_load_factor(0.5);
-    BOOST_TEST(x.max_load_factor() == boost::unordered::detail::foa::mlf);
+    BOOST_TEST(x.max_load_factor() == 0.5);
+    x.max_load_factor(0.0);
+    BOOST_TEST(x.max_load_factor() == boost::unordered::detail::foa::min_mlf);
 #else
     BOOST_TEST(x.max_load_factor() == 1.0);
     BOOST_TEST(x.load_factor() == 0);
@@ -79,6 +81,135 @@ namespace load_factor_tests {
       insert_test(ptr, std::numeric_limits<float>::infinity(), generator);
   }
 
+#ifdef BOOST_UNORDERED_FOA_TESTS
+  inline int make_value(int i, int*) { return i; }
+
+  inline std::pair<int const, int> make_value(
+    int i, std::pair<int const, int>*)
+  {
+    return {i, i};
+  }
+
+  template <class X> void max_load_factor_tests(X*)
+  {
+    typename X::value_type* pv = nullptr;
+
+    float const mlfs[] = {0.25f, 0.5f, boost::unordered::detail::foa::mlf,
+      boost::unordered::detail::foa::max_mlf};
+
+    for (float mlf : mlfs) {
+      X x;
+      x.max_load_factor(mlf);
+      BOOST_TEST_EQ(x.max_load_factor(), mlf);
+
+      for (int i = 0; i < 10000; ++i) {
+        x.insert(make_value(i, pv));
+        BOOST_TEST_LE(x.size(), x.max_load());
+      }
+      BOOST_TEST_LE(x.load_factor(), mlf);
+      BOOST_TEST_GE(x.load_factor(), mlf / 2.5f);
+
+      // reserve honors max load factor
+      X y;
+      y.max_load_factor(mlf);
+      y.reserve(1000);
+      BOOST_TEST_GE(y.max_load(), 1000u);
+      auto bc = y.bucket_count();
+      for (int i = 0; i < 1000; ++i) {
+        y.insert(make_value(i, pv));
+      }
+      BOOST_TEST_EQ(y.bucket_count(), bc);
+
+      // lowering max load factor below the current load rehashes the
+      // container
+      y.max_load_factor(mlf / 2);
+      BOOST_TEST_GE(y.max_load(), y.size());
+      BOOST_TEST_GT(y.bucket_count(), bc);
+      BOOST_TEST_LE(y.load_factor(), mlf / 2);
+      y.insert(make_value(1000, pv));
+
+      // setting the max load factor keeps the reduction of max load due to
+      // erasures (anti-drift)
+      for (int i = 0; i < 1000; i += 2) {
+        y.erase(i);
+      }
+      auto bc2 = y.bucket_count();
+      auto drift =
+        static_cast<std::size_t>(mlf / 2 * static_cast<float>(bc2)) -
+        y.max_load();
+      auto ml = y.max_load();
+      y.max_load_factor(y.max_load_factor());
+      BOOST_TEST_EQ(y.max_load(), ml);
+      y.max_load_factor(mlf);
+      BOOST_TEST_EQ(y.max_load(),
+        static_cast<std::size_t>(mlf * static_cast<float>(bc2)) - drift);
+      y.max_load_factor(mlf / 2);
+      BOOST_TEST_EQ(y.max_load(), ml);
+
+      // copy and move carry the max load factor
+      X z(y);
+      BOOST_TEST_EQ(z.max_load_factor(), mlf / 2);
+      X w(std::move(z));
+      BOOST_TEST_EQ(w.max_load_factor(), mlf / 2);
+      z = w;
+      BOOST_TEST_EQ(z.max_load_factor(), mlf / 2);
+    }
+  }
+
+  template <class X> void lower_max_load_factor_tests(X*)
+  {
+    // lowering the max load factor below the current load rehashes right
+    // away, also with the max load reduced by erasures or an incremental
+    // rehash pending
+
+    typename X::value_type* pv = nullptr;
+
+    float const mlfs[] = {0.25f, 0.1f, boost::unordered::detail::foa::min_mlf};
+
+    for (int variant = 0; variant < 3; ++variant) {
+      for (float mlf : mlfs) {
+        X x;
+        if (variant == 2) x.incremental_rehash(true);
+        int n = 0;
+        while (n < 2000 || x.size() < x.max_load()) {
+          x.insert(make_value(n++, pv));
+        }
+        if (variant == 1) {
+          for (int i = 0; i < n; i += 3) x.erase(i);
+        }
+        else if (variant == 2) {
+          x.insert(make_value(n++, pv)); // growth, migration pending
+        }
+        auto size = x.size();
+        BOOST_TEST_GT(x.load_factor(), mlf);
+
+        x.max_load_factor(mlf);
+        BOOST_TEST_EQ(x.max_load_factor(), mlf);
+        BOOST_TEST_EQ(x.size(), size);
+        BOOST_TEST_LE(x.size(), x.max_load());
+        BOOST_TEST_LE(x.load_factor(), mlf);
+        BOOST_TEST_EQ(static_cast<std::size_t>(
+                        std::distance(x.begin(), x.end())),
+          size);
+        for (int i = 0; i < n; ++i) {
+          BOOST_TEST_EQ(x.count(i), (variant == 1 && i % 3 == 0) ? 0u : 1u);
+        }
+
+        // further erasures and insertions keep the invariants
+
+        for (int i = 0; i < n; i += 2) x.erase(i);
+        BOOST_TEST_LE(x.size(), x.max_load());
+        for (int i = 0; i < n; ++i) {
+          x.insert(make_value(i, pv));
+          BOOST_TEST_LE(x.size(), x.max_load());
+        }
+        BOOST_TEST_EQ(x.size(), static_cast<std::size_t>(n));
+        BOOST_TEST_LE(x.load_factor(), mlf);
+      }
+    }
+  }
+#endif
+
   using test::default_generator;
   using test::generate_collisions;
   using test::limited_range;
@@ -96,6 +227,12 @@ namespace load_factor_tests {
   UNORDERED_TEST(load_factor_insert_tests,
     ((int_set_ptr)(int_map_ptr)(int_node_set_ptr)(int_node_map_ptr))(
       (default_generator)(generate_collisions)(limited_range)))
+
+  UNORDERED_TEST(max_load_factor_tests,
+    ((int_set_ptr)(int_map_ptr)(int_node_set_ptr)(int_node_map_ptr)))
+
+  UNORDERED_TEST(lower_max_load_factor_tests,
+    ((int_set_ptr)(int_map_ptr)(int_node_set_ptr)(int_node_map_ptr)))
 // clang-format on
 #else
   boost::unordered_set<int>* int_set_ptr;
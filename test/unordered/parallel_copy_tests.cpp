@@ -0,0 +1,199 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_UNORDERED_FOA_TESTS)
+#error "parallel_copy_tests is currently only supported by open-addressed containers"
+#else
+
+#include "../helpers/unordered.hpp"
+
+#include "../helpers/bad_hash.hpp"
+#include "../helpers/int_keys.hpp"
+#include "../helpers/test.hpp"
+
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+
+#include <atomic>
+#include <climits>
+#include <execution>
+#include <stdexcept>
+
+// hash concentrating positions on a few groups, so that elements copied
+// from different threads compete for the same groups
+
+using bad_hash = test::bad_hash<16>;
+
+static std::atomic<int> copies_left{INT_MAX};
+
+struct throwing_copy
+{
+  int n;
+
+  throwing_copy(int n_) : n(n_) {}
+
+  throwing_copy(throwing_copy const& x) : n(x.n)
+  {
+    if (--copies_left < 0) throw std::runtime_error("");
+  }
+
+  throwing_copy& operator=(throwing_copy const&) = default;
+
+  friend bool operator==(throwing_copy const& x, throwing_copy const& y)
+  {
+    return x.n == y.n;
+  }
+};
+
+using test::insert_key;
+
+template <class X> X make_container(int first, int last)
+{
+  X x;
+  for (int i = first; i < last; ++i) insert_key(x, i);
+  return x;
+}
+
+template <class X> bool check(X const& x, X const& y)
+{
+  if (!(x == y)) return false;
+  std::size_t n = 0;
+  for (auto it = x.begin(); it != x.end(); ++it) ++n;
+  return n == x.size() && x.max_load() >= x.size();
+}
+
+template <class X, class ExecutionPolicy>
+void parallel_copy_tests(ExecutionPolicy&& policy, int n)
+{
+  {
+    X x;
+    X y(policy, x);
+    BOOST_TEST(y.empty());
+    y.assign(policy, x);
+    BOOST_TEST(y.empty());
+  }
+  {
+    auto x = make_container<X>(0, n);
+    X y(policy, x);
+    BOOST_TEST(check(y, x));
+    BOOST_TEST_EQ(y.bucket_count(), x.bucket_count());
+
+    // insertion after copy with same layout, max load copied over
+
+    for (int i = 0; i < n; i += 2) x.erase(i);
+    X z(x);
+    X w(policy, x);
+    BOOST_TEST(check(w, x));
+    BOOST_TEST_EQ(w.bucket_count(), z.bucket_count());
+    BOOST_TEST_EQ(w.max_load(), z.max_load());
+    for (int i = 0; i < 2 * n; ++i) insert_key(w, i);
+    BOOST_TEST(check(w, make_container<X>(0, 2 * n)));
+
+    // assignment into non-empty container, self-assignment
+
+    y.assign(policy, w);
+    BOOST_TEST(check(y, w));
+    y.assign(policy, y);
+    BOOST_TEST(check(y, w));
+  }
+  {
+    // different layouts
+
+    X x;
+    x.reserve(static_cast<std::size_t>(4 * n));
+    for (int i = 0; i < n; ++i) insert_key(x, i);
+    X y(policy, x);
+    BOOST_TEST(check(y, x));
+    BOOST_TEST_LT(y.bucket_count(), x.bucket_count());
+
+    X z;
+    z.reserve(static_cast<std::size_t>(16 * n));
+    z.assign(policy, x);
+    BOOST_TEST(check(z, x));
+    BOOST_TEST_GT(z.bucket_count(), x.bucket_count());
+  }
+}
+
+template <class X> void parallel_copy_tests(int n)
+{
+  parallel_copy_tests<X>(std::execution::seq, n);
+  parallel_copy_tests<X>(std::execution::par, n);
+}
+
+template <class X> void parallel_copy_incremental_tests()
+{
+  // pending incremental migration is completed before copying
+
+  X x;
+  x.incremental_rehash(true);
+  for (int i = 0; i < 100000; ++i) insert_key(x, i);
+  X y(std::execution::par, x);
+  BOOST_TEST(check(y, x));
+
+  X z;
+  z.incremental_rehash(true);
+  for (int i = 0; i < 50000; ++i) insert_key(z, -i);
+  z.assign(std::execution::par, x);
+  BOOST_TEST(check(z, x));
+}
+
+template <class X> void parallel_copy_exception_tests()
+{
+  int const n = 10000;
+  auto x = make_container<X>(0, n);
+
+  X x2;
+  x2.reserve(4 * n);
+  for (int i = 0; i < n; ++i) insert_key(x2, i);
+
+  for (X const* px : {&x, &x2}) {
+    for (int copies : {0, 1, n / 3, n - 1}) {
+      copies_left = copies;
+      try {
+        X y(std::execution::par, *px);
+        BOOST_ERROR("exception expected");
+      } catch (std::runtime_error const&) {
+      }
+      copies_left = INT_MAX;
+
+      X z = make_container<X>(n, 2 * n);
+      copies_left = copies;
+      BOOST_TEST_THROWS(
+        z.assign(std::execution::par, *px), std::runtime_error);
+      copies_left = INT_MAX;
+
+      // container left empty and usable
+
+      BOOST_TEST(z.empty());
+      BOOST_TEST(z.begin() == z.end());
+      z.assign(std::execution::par, *px);
+      BOOST_TEST(check(z, *px));
+    }
+  }
+}
+
+UNORDERED_AUTO_TEST (parallel_copy) {
+  parallel_copy_tests<boost::unordered_flat_map<int, int> >(100000);
+  parallel_copy_tests<boost::unordered_flat_set<int> >(100000);
+  parallel_copy_tests<boost::unordered_node_map<int, int> >(100000);
+  parallel_copy_tests<boost::unordered_node_set<int> >(100000);
+  parallel_copy_tests<boost::unordered_flat_map<int, int, bad_hash> >(2000);
+  parallel_copy_tests<boost::unordered_node_set<int, bad_hash> >(2000);
+}
+
+UNORDERED_AUTO_TEST (parallel_copy_incremental) {
+  parallel_copy_incremental_tests<boost::unordered_flat_map<int, int> >();
+  parallel_copy_incremental_tests<boost::unordered_node_set<int> >();
+}
+
+UNORDERED_AUTO_TEST (parallel_copy_exceptions) {
+  parallel_copy_exception_tests<
+    boost::unordered_flat_map<int, throwing_copy> >();
+  parallel_copy_exception_tests<
+    boost::unordered_node_map<int, throwing_copy> >();
+}
+
+#endif
+#endif
+
+RUN_TESTS()
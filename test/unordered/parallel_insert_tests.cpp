@@ -0,0 +1,211 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_UNORDERED_FOA_TESTS)
+#error "parallel_insert_tests is currently only supported by open-addressed containers"
+#else
+
+#include "../helpers/unordered.hpp"
+
+#include "../helpers/bad_hash.hpp"
+#include "../helpers/test.hpp"
+
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+
+#include <atomic>
+#include <climits>
+#include <execution>
+#include <list>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// hash concentrating positions on a few groups, so that elements inserted
+// from different threads compete for the same groups
+
+using bad_hash = test::bad_hash<16>;
+
+static std::atomic<int> hash_calls_left{INT_MAX};
+
+struct throwing_hash
+{
+  std::size_t operator()(int x) const
+  {
+    if (--hash_calls_left < 0) throw std::runtime_error("");
+    return boost::hash<int>()(x);
+  }
+};
+
+template <class X>
+using is_map = std::integral_constant<bool,
+  !std::is_same<typename X::key_type, typename X::value_type>::value>;
+
+template <class X> int make_value(int k, std::false_type /* set */)
+{
+  return k;
+}
+
+template <class X>
+std::pair<int, int> make_value(int k, std::true_type /* map */)
+{
+  return {k, k};
+}
+
+template <class X> std::vector<typename X::init_type> make_values(
+  int first, int last, int mod = INT_MAX)
+{
+  std::vector<typename X::init_type> v;
+  for (int i = first; i < last; ++i) {
+    v.push_back(make_value<X>(i % mod, is_map<X>{}));
+  }
+  return v;
+}
+
+template <class X> bool check(X const& x, int first, int last)
+{
+  if (x.size() != static_cast<std::size_t>(last - first)) return false;
+  for (int k = first; k < last; ++k) {
+    if (x.count(k) != 1) return false;
+  }
+  std::size_t n = 0;
+  for (auto it = x.begin(); it != x.end(); ++it) ++n;
+  return n == x.size();
+}
+
+template <class X, class ExecutionPolicy>
+void parallel_insert_tests(ExecutionPolicy&& policy, int n)
+{
+  {
+    auto v = make_values<X>(0, 0);
+    X x(policy, v.begin(), v.end());
+    BOOST_TEST(x.empty());
+    x.insert(policy, v.begin(), v.end());
+    BOOST_TEST(x.empty());
+  }
+  {
+    auto v = make_values<X>(0, n);
+    X x(policy, v.begin(), v.end());
+    BOOST_TEST(check(x, 0, n));
+    BOOST_TEST_LE(x.size(), x.max_load());
+
+    // overlapping range into a non-empty container
+
+    auto w = make_values<X>(n / 2, 2 * n);
+    x.insert(policy, w.begin(), w.end());
+    BOOST_TEST(check(x, 0, 2 * n));
+
+    // range of value_type
+
+    std::vector<typename X::value_type> y(x.begin(), x.end());
+    X x2(policy, y.begin(), y.end(), 0, typename X::hasher(),
+      typename X::key_equal(), typename X::allocator_type());
+    BOOST_TEST(x2 == x);
+  }
+  {
+    // duplicates within the range
+
+    auto v = make_values<X>(0, n, 1000);
+    X x(policy, v.begin(), v.end(), 10);
+    BOOST_TEST(check(x, 0, (std::min)(n, 1000)));
+  }
+  {
+    // non-random-access iterators
+
+    auto v = make_values<X>(0, n);
+    std::list<typename X::init_type> l(v.begin(), v.end());
+    X x;
+    x.insert(policy, l.begin(), l.end());
+    BOOST_TEST(check(x, 0, n));
+  }
+  {
+    // container at full load with max load lowered by erasures
+
+    X x;
+    x.reserve(static_cast<std::size_t>(n));
+    int m = static_cast<int>(x.max_load());
+    auto v = make_values<X>(0, m);
+    x.insert(v.begin(), v.end());
+    for (int i = 0; i < m; i += 2) x.erase(i);
+    x.insert(policy, v.begin(), v.end());
+    BOOST_TEST(check(x, 0, m));
+  }
+}
+
+template <class X> void parallel_insert_tests(int n)
+{
+  parallel_insert_tests<X>(std::execution::seq, n);
+  parallel_insert_tests<X>(std::execution::par, n);
+}
+
+template <class X> void parallel_insert_incremental_tests()
+{
+  // pending incremental migration is completed before inserting
+
+  X x;
+  x.incremental_rehash(true);
+  for (int i = 0; i < 100000; ++i) x.insert(make_value<X>(i, is_map<X>{}));
+  auto v = make_values<X>(50000, 200000);
+  x.insert(std::execution::par, v.begin(), v.end());
+  BOOST_TEST(check(x, 0, 200000));
+}
+
+template <class X> void parallel_insert_exception_tests()
+{
+  int const n = 10000;
+  auto v = make_values<X>(0, n);
+
+  for (int calls : {0, 1, n / 3, n - 1}) {
+    X x;
+    x.reserve(n);
+    hash_calls_left = calls;
+    BOOST_TEST_THROWS(
+      x.insert(std::execution::par, v.begin(), v.end()), std::runtime_error);
+    hash_calls_left = INT_MAX;
+
+    // elements inserted so far are kept
+
+    BOOST_TEST_LE(x.size(), static_cast<std::size_t>(calls));
+    std::size_t m = 0;
+    for (int i = 0; i < n; ++i) m += x.count(i);
+    BOOST_TEST_EQ(m, x.size());
+
+    x.insert(std::execution::par, v.begin(), v.end());
+    BOOST_TEST(check(x, 0, n));
+  }
+}
+
+UNORDERED_AUTO_TEST (parallel_insert) {
+  parallel_insert_tests<boost::unordered_flat_map<int, int> >(100000);
+  parallel_insert_tests<boost::unordered_flat_set<int> >(100000);
+  parallel_insert_tests<boost::unordered_node_map<int, int> >(100000);
+  parallel_insert_tests<boost::unordered_node_set<int> >(100000);
+  parallel_insert_tests<boost::unordered_flat_map<int, int, bad_hash> >(2000);
+  parallel_insert_tests<boost::unordered_node_set<int, bad_hash> >(2000);
+}
+
+UNORDERED_AUTO_TEST (parallel_insert_sequential_fallback) {
+  // ranges of types other than value_type and init_type
+
+  std::vector<long> v;
+  for (long i = 0; i < 10000; ++i) v.push_back(i % 5000);
+  boost::unordered_flat_set<int> x(std::execution::par, v.begin(), v.end());
+  BOOST_TEST(check(x, 0, 5000));
+}
+
+UNORDERED_AUTO_TEST (parallel_insert_incremental) {
+  parallel_insert_incremental_tests<boost::unordered_flat_map<int, int> >();
+  parallel_insert_incremental_tests<boost::unordered_node_set<int> >();
+}
+
+UNORDERED_AUTO_TEST (parallel_insert_exceptions) {
+  parallel_insert_exception_tests<
+    boost::unordered_flat_map<int, int, throwing_hash> >();
+  parallel_insert_exception_tests<
+    boost::unordered_node_set<int, throwing_hash> >();
+}
+
+#endif
+#endif
+
+RUN_TESTS()
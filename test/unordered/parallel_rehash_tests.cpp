@@ -0,0 +1,171 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_UNORDERED_FOA_TESTS)
+#error "parallel_rehash_tests is currently only supported by open-addressed containers"
+#else
+
+#include "../helpers/unordered.hpp"
+
+#include "../helpers/bad_hash.hpp"
+#include "../helpers/int_keys.hpp"
+#include "../helpers/test.hpp"
+
+#if defined(BOOST_UNORDERED_PARALLEL_ALGORITHMS)
+
+#include <atomic>
+#include <climits>
+#include <execution>
+#include <stdexcept>
+
+// hash concentrating positions on a few groups, so that elements from many
+// old groups compete for the same new groups
+
+using bad_hash = test::bad_hash<16>;
+
+static std::atomic<int> hash_calls_left{INT_MAX};
+
+struct throwing_hash
+{
+  std::size_t operator()(int x) const
+  {
+    if (--hash_calls_left < 0) throw std::runtime_error("");
+    return boost::hash<int>()(x);
+  }
+};
+
+// move constructor may throw: parallel rehash falls back to copying
+
+struct throwing_move
+{
+  int n;
+
+  throwing_move(int n_) : n(n_) {}
+  throwing_move(throwing_move const&) = default;
+  throwing_move(throwing_move&& x) noexcept(false) : n(x.n) {}
+
+  throwing_move& operator=(throwing_move const&) = default;
+};
+
+using test::insert_key;
+
+template <class X> bool check(X const& x, int first, int last)
+{
+  if (x.size() != static_cast<std::size_t>(last - first)) return false;
+  for (int k = first; k < last; ++k) {
+    if (!x.contains(k)) return false;
+  }
+  std::size_t n = 0;
+  for (auto it = x.begin(); it != x.end(); ++it) ++n;
+  return n == x.size();
+}
+
+template <class X, class ExecutionPolicy>
+void parallel_rehash_tests(ExecutionPolicy&& policy, int n)
+{
+  X x;
+  x.rehash(policy, 0);
+  BOOST_TEST(x.empty());
+  BOOST_TEST_EQ(x.bucket_count(), 0u);
+
+  x.reserve(policy, 100);
+  BOOST_TEST_GE(x.max_load(), 100u);
+  BOOST_TEST(x.empty());
+
+  for (int i = 0; i < n; ++i) insert_key(x, i);
+  BOOST_TEST(check(x, 0, n));
+
+  auto bc = x.bucket_count();
+  x.rehash(policy, 4 * bc);
+  BOOST_TEST_GE(x.bucket_count(), 4 * bc);
+  BOOST_TEST(check(x, 0, n));
+
+  x.reserve(policy, 2 * static_cast<std::size_t>(n));
+  BOOST_TEST_GE(x.max_load(), 2 * static_cast<std::size_t>(n));
+  for (int i = n; i < 2 * n; ++i) insert_key(x, i);
+  BOOST_TEST(check(x, 0, 2 * n));
+
+  for (int i = 0; i < n; ++i) x.erase(i);
+  x.rehash(policy, 0);
+  BOOST_TEST_LE(x.bucket_count(), bc);
+  BOOST_TEST(check(x, n, 2 * n));
+
+  x.clear();
+  x.rehash(policy, 0);
+  BOOST_TEST_EQ(x.bucket_count(), 0u);
+}
+
+template <class X> void parallel_rehash_tests(int n)
+{
+  parallel_rehash_tests<X>(std::execution::seq, n);
+  parallel_rehash_tests<X>(std::execution::par, n);
+}
+
+template <class X> void parallel_rehash_incremental_tests()
+{
+  // pending incremental migration is completed before rehashing
+
+  X x;
+  x.incremental_rehash(true);
+  for (int i = 0; i < 100000; ++i) insert_key(x, i);
+  x.rehash(std::execution::par, 4 * x.bucket_count());
+  BOOST_TEST(check(x, 0, 100000));
+}
+
+template <class X> void parallel_rehash_exception_tests()
+{
+  int const n = 10000;
+
+  for (int calls : {0, 1, n / 3, n - 1}) {
+    X x;
+    for (int i = 0; i < n; ++i) insert_key(x, i);
+
+    auto bc = x.bucket_count();
+    hash_calls_left = calls;
+    BOOST_TEST_THROWS(
+      x.rehash(std::execution::par, 4 * bc), std::runtime_error);
+    hash_calls_left = INT_MAX;
+
+    // elements are either kept or lost, container remains usable
+
+    BOOST_TEST_EQ(x.bucket_count(), bc);
+    BOOST_TEST_LE(x.size(), static_cast<std::size_t>(n));
+    BOOST_TEST_GE(x.max_load(), x.size());
+    std::size_t m = 0;
+    for (int i = 0; i < n; ++i) m += x.count(i);
+    BOOST_TEST_EQ(m, x.size());
+
+    for (int i = 0; i < n; ++i) insert_key(x, i);
+    x.rehash(std::execution::par, 4 * bc);
+    BOOST_TEST(check(x, 0, n));
+  }
+}
+
+UNORDERED_AUTO_TEST (parallel_rehash) {
+  parallel_rehash_tests<boost::unordered_flat_map<int, int> >(100000);
+  parallel_rehash_tests<boost::unordered_flat_set<int> >(100000);
+  parallel_rehash_tests<boost::unordered_node_map<int, int> >(100000);
+  parallel_rehash_tests<boost::unordered_node_set<int> >(100000);
+  parallel_rehash_tests<boost::unordered_flat_map<int, int, bad_hash> >(2000);
+  parallel_rehash_tests<boost::unordered_node_set<int, bad_hash> >(2000);
+  parallel_rehash_tests<boost::unordered_flat_map<int, throwing_move> >(
+    10000);
+}
+
+UNORDERED_AUTO_TEST (parallel_rehash_incremental) {
+  parallel_rehash_incremental_tests<boost::unordered_flat_map<int, int> >();
+  parallel_rehash_incremental_tests<boost::unordered_node_set<int> >();
+}
+
+UNORDERED_AUTO_TEST (parallel_rehash_exceptions) {
+  parallel_rehash_exception_tests<
+    boost::unordered_flat_map<int, int, throwing_hash> >();
+  parallel_rehash_exception_tests<
+    boost::unordered_node_set<int, throwing_hash> >();
+}
+
+#endif
+#endif
+
+RUN_TESTS()
@@ -0,0 +1,216 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_UNORDERED_FOA_TESTS)
+#error "prehashed_tests is currently only supported by open-addressed containers"
+#else
+
+#include <cstdlib>
+
+#define BOOST_ENABLE_ASSERT_HANDLER
+
+static int mismatches_detected = 0;
+
+namespace boost {
+  void assertion_failed_msg(
+    char const*, char const*, char const*, char const*, long)
+  {
+    ++mismatches_detected;
+  }
+
+  // LCOV_EXCL_START
+  void assertion_failed(char const*, char const*, char const*, long)
+  {
+    std::abort();
+  }
+  // LCOV_EXCL_STOP
+} // namespace boost
+
+#include "../helpers/unordered.hpp"
+
+#include "../helpers/bad_hash.hpp"
+#include "../helpers/test.hpp"
+
+#include <boost/unordered/concurrent_flat_map.hpp>
+#include <boost/unordered/concurrent_flat_set.hpp>
+#include <boost/unordered/concurrent_node_map.hpp>
+#include <boost/unordered/concurrent_node_set.hpp>
+
+struct transparent_hash
+{
+  using is_transparent = void;
+
+  template <class T> std::size_t operator()(T const& x) const
+  {
+    return boost::hash<int>()(static_cast<int>(x));
+  }
+};
+
+struct transparent_equal_to
+{
+  using is_transparent = void;
+
+  template <class T, class U> bool operator()(T const& x, U const& y) const
+  {
+    return static_cast<int>(x) == static_cast<int>(y);
+  }
+};
+
+// hash concentrating positions on a few groups, stresses probing
+
+using bad_hash = test::bad_hash<64>;
+
+template <class X> bool insert_prehashed(X& x, int k, std::true_type /* map */)
+{
+  return x.try_emplace(x.prehash(k), k, k).second;
+}
+
+template <class X>
+bool insert_prehashed(X& x, int k, std::false_type /* set */)
+{
+  return x.insert(x.prehash(k), k).second;
+}
+
+template <class X> bool insert_prehashed(X& x, int k)
+{
+  return insert_prehashed(x, k,
+    std::integral_constant<bool,
+      !std::is_same<typename X::key_type, typename X::value_type>::value>{});
+}
+
+template <class X> void prehashed_tests(bool incremental)
+{
+  int const n = 2000;
+
+  X x;
+  x.incremental_rehash(incremental);
+
+  for (int i = 0; i < n; ++i) {
+    BOOST_TEST(insert_prehashed(x, i));
+    BOOST_TEST(!insert_prehashed(x, i));
+  }
+  BOOST_TEST_EQ(x.size(), static_cast<std::size_t>(n));
+
+  X const& cx = x;
+  for (int i = 0; i < 2 * n; ++i) {
+    auto ph = x.prehash(i);
+    BOOST_TEST_EQ(ph.hash, x.hash_function()(i));
+    BOOST_TEST(x.find(ph, i) == x.find(i));
+    BOOST_TEST(cx.find(ph, i) == cx.find(i));
+    BOOST_TEST_EQ(x.contains(ph, i), i < n);
+  }
+  BOOST_TEST_EQ(mismatches_detected, 0);
+
+  // a prehashed value from another container with an equivalent hash
+  // function can be used
+
+  X y;
+  for (int i = 0; i < n; i += 2) {
+    BOOST_TEST(x.find(y.prehash(i), i) != x.end());
+  }
+  BOOST_TEST_EQ(mismatches_detected, 0);
+
+  x.find(boost::unordered::prehashed(x.prehash(0).hash + 1), 0);
+  BOOST_TEST_EQ(mismatches_detected, 1);
+  mismatches_detected = 0;
+}
+
+template <class X> void transparent_prehashed_tests()
+{
+  int const n = 100;
+
+  X x;
+  for (int i = 0; i < n; ++i) {
+    insert_prehashed(x, i);
+  }
+  for (long i = 0; i < 2 * n; ++i) {
+    auto ph = x.prehash(i);
+    BOOST_TEST_EQ(x.contains(ph, i), i < n);
+    BOOST_TEST(x.find(ph, i) == x.find(i));
+  }
+  BOOST_TEST_EQ(mismatches_detected, 0);
+}
+
+template <class X>
+bool concurrent_insert_prehashed(X& x, int k, std::true_type /* map */)
+{
+  return x.try_emplace(x.prehash(k), k, k);
+}
+
+template <class X>
+bool concurrent_insert_prehashed(X& x, int k, std::false_type /* set */)
+{
+  return x.insert(x.prehash(k), k);
+}
+
+template <class X> bool concurrent_insert_prehashed(X& x, int k)
+{
+  return concurrent_insert_prehashed(x, k,
+    std::integral_constant<bool,
+      !std::is_same<typename X::key_type, typename X::value_type>::value>{});
+}
+
+template <class X> void concurrent_prehashed_tests()
+{
+  int const n = 2000;
+
+  X x;
+  for (int i = 0; i < n; ++i) {
+    BOOST_TEST(concurrent_insert_prehashed(x, i));
+    BOOST_TEST(!concurrent_insert_prehashed(x, i));
+  }
+  BOOST_TEST_EQ(x.size(), static_cast<std::size_t>(n));
+
+  X const& cx = x;
+  for (int i = 0; i < 2 * n; ++i) {
+    auto ph = x.prehash(i);
+    std::size_t visited = 0;
+    auto f = [&](typename X::value_type const&) { ++visited; };
+    BOOST_TEST_EQ(ph.hash, x.hash_function()(i));
+    BOOST_TEST_EQ(x.visit(ph, i, f), i < n ? 1u : 0u);
+    BOOST_TEST_EQ(cx.visit(ph, i, f), i < n ? 1u : 0u);
+    BOOST_TEST_EQ(x.cvisit(ph, i, f), i < n ? 1u : 0u);
+    BOOST_TEST_EQ(visited, i < n ? 3u : 0u);
+    BOOST_TEST_EQ(x.contains(ph, i), i < n);
+  }
+  BOOST_TEST_EQ(mismatches_detected, 0);
+
+  x.contains(boost::unordered::prehashed(x.prehash(0).hash + 1), 0);
+  BOOST_TEST_EQ(mismatches_detected, 1);
+  mismatches_detected = 0;
+}
+
+UNORDERED_AUTO_TEST (prehashed) {
+  for (bool incremental : {false, true}) {
+    prehashed_tests<boost::unordered_flat_map<int, int> >(incremental);
+    prehashed_tests<boost::unordered_flat_set<int> >(incremental);
+    prehashed_tests<boost::unordered_node_map<int, int> >(incremental);
+    prehashed_tests<boost::unordered_node_set<int> >(incremental);
+    prehashed_tests<boost::unordered_flat_map<int, int, bad_hash> >(
+      incremental);
+    prehashed_tests<boost::unordered_node_set<int, bad_hash> >(incremental);
+  }
+}
+
+UNORDERED_AUTO_TEST (transparent_prehashed) {
+  transparent_prehashed_tests<boost::unordered_flat_map<int, int,
+    transparent_hash, transparent_equal_to> >();
+  transparent_prehashed_tests<
+    boost::unordered_flat_set<int, transparent_hash, transparent_equal_to> >();
+  transparent_prehashed_tests<boost::unordered_node_map<int, int,
+    transparent_hash, transparent_equal_to> >();
+  transparent_prehashed_tests<
+    boost::unordered_node_set<int, transparent_hash, transparent_equal_to> >();
+}
+
+UNORDERED_AUTO_TEST (concurrent_prehashed) {
+  concurrent_prehashed_tests<boost::concurrent_flat_map<int, int> >();
+  concurrent_prehashed_tests<boost::concurrent_flat_set<int> >();
+  concurrent_prehashed_tests<boost::concurrent_node_map<int, int> >();
+  concurrent_prehashed_tests<boost::concurrent_node_set<int> >();
+  concurrent_prehashed_tests<boost::concurrent_flat_map<int, int, bad_hash> >();
+}
+#endif
+
+RUN_TESTS()
@@ -180,8 +180,9 @@ namespace rehash_tests {
       BOOST_TEST_EQ(test::detail::tracker.count_allocations, 0u);
 
 #ifdef BOOST_UNORDERED_FOA_TESTS
-      float const mlf = boost::unordered::detail::foa::mlf;
+      // the max load factor is clamped to the supported range
       x.max_load_factor(max_load_factors[i]);
+      float const mlf = x.max_load_factor();
 #else
       float const mlf = max_load_factors[i];
       x.max_load_factor(mlf);
@@ -415,7 +416,9 @@ namespace rehash_tests {
 
     typedef typename X::size_type size_type;
 
-    size_type bucket_count = 100;
+    // large enough for the table to be out of the small-capacity regime
+    // (where 100% load is allowed) for all supported group sizes
+    size_type bucket_count = 1000;
     X x(bucket_count);
 
     size_type num_elems = x.bucket_count() - 1;
@@ -13,6 +13,8 @@
 #include "../helpers/random_values.hpp"
 
 #include <algorithm>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
 #include <boost/archive/xml_oarchive.hpp>
@@ -122,6 +124,9 @@ namespace {
   std::pair<
     boost::archive::xml_oarchive, boost::archive::xml_iarchive>*
     xml_archive;
+  std::pair<
+    boost::archive::binary_oarchive, boost::archive::binary_iarchive>*
+    binary_archive;
 
 #ifdef BOOST_UNORDERED_FOA_TESTS
   boost::unordered_flat_map<
@@ -135,7 +140,7 @@ namespace {
 
   UNORDERED_TEST(serialization_tests,
     ((test_flat_map)(test_node_map)(test_flat_set)(test_node_set))
-    ((text_archive)(xml_archive))
+    ((text_archive)(xml_archive)(binary_archive))
     ((default_generator)))
 #else
   boost::unordered_map<
@@ -149,7 +154,7 @@ namespace {
 
   UNORDERED_TEST(serialization_tests,
     ((test_map)(test_multimap)(test_set)(test_multiset))
-    ((text_archive)(xml_archive))
+    ((text_archive)(xml_archive)(binary_archive))
     ((default_generator)))
 
   template<typename T>
@@ -0,0 +1,321 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_UNORDERED_FOA_TESTS)
+#error "small_flat_tests is currently only supported by open-addressed containers"
+#else
+
+#include <boost/unordered/small_flat_map.hpp>
+#include <boost/unordered/small_flat_set.hpp>
+
+#include "../helpers/counting_allocator.hpp"
+#include "../helpers/int_keys.hpp"
+#include "../helpers/test.hpp"
+
+#include <boost/core/detail/splitmix64.hpp>
+#include <map>
+#include <string>
+#include <vector>
+
+using test::counting_allocator;
+
+struct counting_hash
+{
+  static std::size_t calls;
+  static bool throw_on_call;
+
+  std::size_t operator()(int x) const
+  {
+    ++calls;
+    if (throw_on_call) throw std::runtime_error("");
+    return boost::hash<int>()(x);
+  }
+};
+
+std::size_t counting_hash::calls = 0;
+bool counting_hash::throw_on_call = false;
+
+using test::get_key;
+using test::insert_key;
+
+template <class X> bool check(X const& x, std::map<int, int> const& ref)
+{
+  if (x.size() != ref.size()) return false;
+  for (auto const& v : ref) {
+    if (!x.contains(v.first)) return false;
+  }
+
+  std::size_t n = 0;
+  for (auto const& v : x) {
+    if (!ref.count(get_key(x, v))) return false;
+    ++n;
+  }
+  return n == ref.size();
+}
+
+template <class X> void small_mode_tests()
+{
+  int const n = 8;
+
+  test::counted_allocations = 0;
+  counting_hash::calls = 0;
+  {
+    X x;
+    BOOST_TEST_EQ(x.bucket_count(), static_cast<std::size_t>(n));
+    for (int i = 0; i < n; ++i) {
+      insert_key(x, i);
+      insert_key(x, i);
+    }
+    BOOST_TEST_EQ(x.size(), static_cast<std::size_t>(n));
+    for (int i = 0; i < 2 * n; ++i) {
+      BOOST_TEST_EQ(x.contains(i), i < n);
+    }
+    BOOST_TEST_EQ(x.erase(0), 1u);
+    BOOST_TEST_EQ(x.erase(0), 0u);
+    insert_key(x, 0);
+
+    X y(x);
+    BOOST_TEST(y == x);
+    X z(std::move(y));
+    BOOST_TEST(z == x);
+    y = z;
+    x.swap(y);
+    BOOST_TEST(x == z);
+    x.clear();
+    BOOST_TEST(x.empty());
+    BOOST_TEST(x.begin() == x.end());
+  }
+  BOOST_TEST_EQ(test::counted_allocations, 0u);
+  BOOST_TEST_EQ(counting_hash::calls, 0u);
+
+  // switch to large mode on (N+1)-th insertion
+
+  {
+    X x;
+    std::map<int, int> ref;
+    for (int i = 0; i < 10 * n; ++i) {
+      insert_key(x, i);
+      ref.emplace(i, i);
+      BOOST_TEST(check(x, ref));
+      BOOST_TEST_EQ(test::counted_allocations != 0, i >= n);
+      BOOST_TEST_GE(x.bucket_count(), x.size());
+    }
+  }
+}
+
+template <class X> void erase_tests()
+{
+  // erasure in small mode does not invalidate other iterators
+
+  X x;
+  for (int i = 0; i < 8; ++i) {
+    insert_key(x, i);
+  }
+  std::vector<typename X::const_iterator> its;
+  for (auto it = x.cbegin(); it != x.cend(); ++it) {
+    its.push_back(it);
+  }
+  for (std::size_t i = 0; i < its.size(); i += 2) {
+    x.erase(its[i]);
+  }
+  for (std::size_t i = 1; i < its.size(); i += 2) {
+    BOOST_TEST(x.find(get_key(x, *its[i])) == its[i]);
+  }
+  BOOST_TEST_EQ(x.size(), 4u);
+
+  // erasure while iterating, in both modes
+
+  for (int n : {8, 100}) {
+    X y;
+    std::map<int, int> ref;
+    for (int i = 0; i < n; ++i) {
+      insert_key(y, i);
+      ref.emplace(i, i);
+    }
+    for (auto it = y.begin(); it != y.end();) {
+      if (get_key(y, *it) % 3 == 0) {
+        ref.erase(get_key(y, *it));
+        it = y.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    BOOST_TEST(check(y, ref));
+    std::size_t s = ref.size();
+    for (auto it = ref.begin(); it != ref.end();) {
+      if (it->first % 2 == 0) {
+        it = ref.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    BOOST_TEST_EQ(
+      boost::unordered::erase_if(y, [&](typename X::value_type const& v) {
+        return get_key(y, v) % 2 == 0;
+      }),
+      s - ref.size());
+    BOOST_TEST(check(y, ref));
+  }
+}
+
+template <class X> void mixed_mode_tests()
+{
+  boost::detail::splitmix64 rng;
+
+  for (int n : {4, 8, 9, 50}) {
+    std::map<int, int> ref;
+    X x;
+    for (int i = 0; i < n; ++i) {
+      int k = static_cast<int>(rng() % 1000);
+      insert_key(x, k);
+      ref.emplace(k, k);
+    }
+
+    for (int m : {0, 3, 8, 9, 60}) {
+      std::map<int, int> ref2;
+      X y;
+      for (int i = 0; i < m; ++i) {
+        int k = static_cast<int>(rng() % 1000);
+        insert_key(y, k);
+        ref2.emplace(k, k);
+      }
+
+      X z(x);
+      BOOST_TEST(check(z, ref));
+      z = y;
+      BOOST_TEST(check(z, ref2));
+      z = x;
+      BOOST_TEST(check(z, ref));
+      X w(std::move(z));
+      BOOST_TEST(check(w, ref));
+      w = std::move(y);
+      BOOST_TEST(check(w, ref2));
+      y = std::move(w);
+      BOOST_TEST(check(y, ref2));
+
+      z = x;
+      swap(z, y);
+      BOOST_TEST(check(z, ref2));
+      BOOST_TEST(check(y, ref));
+      swap(z, y);
+      BOOST_TEST(check(z, ref));
+      BOOST_TEST(check(y, ref2));
+      BOOST_TEST(z == x);
+      BOOST_TEST_EQ(y == x, ref == ref2);
+    }
+
+    // shrink back to small mode
+
+    x.rehash(0);
+    BOOST_TEST(check(x, ref));
+    x.clear();
+    x.rehash(0);
+    BOOST_TEST_EQ(x.bucket_count(), 8u);
+    test::counted_allocations = 0;
+    for (int i = 0; i < 8; ++i) {
+      insert_key(x, i);
+    }
+    BOOST_TEST_EQ(test::counted_allocations, 0u);
+
+    x.reserve(9);
+    BOOST_TEST_GE(x.bucket_count(), 9u);
+    for (int i = 0; i < 8; ++i) {
+      BOOST_TEST(x.contains(i));
+    }
+  }
+}
+
+template <class X> void map_tests()
+{
+  X x;
+  x[1] = 10;
+  BOOST_TEST(x.try_emplace(2, 20).second);
+  BOOST_TEST(!x.try_emplace(2, 21).second);
+  BOOST_TEST(!x.insert_or_assign(1, 11).second);
+  BOOST_TEST_EQ(x.at(1), 11);
+  BOOST_TEST_EQ(x.at(2), 20);
+  BOOST_TEST_THROWS(x.at(3), std::out_of_range);
+  for (int i = 3; i < 20; ++i) {
+    x[i] = i * 10;
+  }
+  BOOST_TEST_EQ(x.at(1), 11);
+  for (int i = 2; i < 20; ++i) {
+    BOOST_TEST_EQ(x[i], i * 10);
+  }
+  BOOST_TEST_EQ(x.size(), 19u);
+}
+
+template <class X> void string_tests()
+{
+  X x;
+  std::vector<std::string> keys;
+  for (int i = 0; i < 20; ++i) {
+    keys.push_back(std::string(32, static_cast<char>('a' + i)));
+  }
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    x.emplace(keys[i], keys[i]);
+    X y(x);
+    y.erase(keys[0]);
+    BOOST_TEST_EQ(y.size(), i);
+  }
+  for (auto const& k : keys) {
+    BOOST_TEST_EQ(x.at(k), k);
+  }
+}
+
+template <class X> void exception_tests()
+{
+  // strong guarantee when the hash function throws on the switch to
+  // large mode
+
+  X x;
+  std::map<int, int> ref;
+  for (int i = 0; i < 8; ++i) {
+    insert_key(x, i);
+    ref.emplace(i, i);
+  }
+  counting_hash::throw_on_call = true;
+  BOOST_TEST_THROWS(insert_key(x, 8), std::runtime_error);
+  BOOST_TEST_THROWS(x.reserve(100), std::runtime_error);
+  counting_hash::throw_on_call = false;
+  BOOST_TEST(check(x, ref));
+  BOOST_TEST_EQ(x.bucket_count(), 8u);
+
+  insert_key(x, 8);
+  ref.emplace(8, 8);
+  BOOST_TEST(check(x, ref));
+}
+
+UNORDERED_AUTO_TEST (small_mode) {
+  small_mode_tests<boost::small_flat_map<int, int, 8, counting_hash,
+    std::equal_to<int>, counting_allocator<std::pair<int const, int> > > >();
+  small_mode_tests<boost::small_flat_set<int, 8, counting_hash,
+    std::equal_to<int>, counting_allocator<int> > >();
+}
+
+UNORDERED_AUTO_TEST (small_erase) {
+  erase_tests<boost::small_flat_map<int, int, 8> >();
+  erase_tests<boost::small_flat_set<int, 8> >();
+}
+
+UNORDERED_AUTO_TEST (small_mixed_mode) {
+  mixed_mode_tests<boost::small_flat_map<int, int, 8, boost::hash<int>,
+    std::equal_to<int>, counting_allocator<std::pair<int const, int> > > >();
+  mixed_mode_tests<boost::small_flat_set<int, 8, boost::hash<int>,
+    std::equal_to<int>, counting_allocator<int> > >();
+}
+
+UNORDERED_AUTO_TEST (small_map) {
+  map_tests<boost::small_flat_map<int, int, 4> >();
+  map_tests<boost::small_flat_map<int, int, 64> >();
+  string_tests<boost::small_flat_map<std::string, std::string, 6> >();
+}
+
+UNORDERED_AUTO_TEST (small_exceptions) {
+  exception_tests<boost::small_flat_map<int, int, 8, counting_hash> >();
+  exception_tests<boost::small_flat_set<int, 8, counting_hash> >();
+}
+#endif
+
+RUN_TESTS()
@@ -0,0 +1,331 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_UNORDERED_FOA_TESTS)
+#error "snapshot_tests is currently only supported by open-addressed containers"
+#else
+
+#include "../helpers/unordered.hpp"
+
+#include "../helpers/test.hpp"
+
+#include <boost/unordered/unordered_flat_map_view.hpp>
+#include <boost/unordered/unordered_flat_set_view.hpp>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// image copied to a buffer with the alignment a memory mapping would have
+
+class image
+{
+public:
+  template <class X> explicit image(X const& x)
+  {
+    std::ostringstream os;
+    boost::unordered::write_snapshot(os, x);
+    BOOST_TEST(os.good());
+    load(os.str());
+  }
+
+  void load(std::string const& str)
+  {
+    buf_.assign(str.size() + 64, 0);
+    auto p = buf_.data();
+    p += (64 - reinterpret_cast<std::uintptr_t>(p) % 64) % 64;
+    std::memcpy(p, str.data(), str.size());
+    data_ = p;
+    size_ = str.size();
+  }
+
+  unsigned char* data() { return data_; }
+  std::size_t size() const { return size_; }
+
+private:
+  std::vector<unsigned char> buf_;
+  unsigned char* data_ = nullptr;
+  std::size_t size_ = 0;
+};
+
+struct seeded_hash
+{
+  std::size_t seed = 0;
+
+  seeded_hash() = default;
+  seeded_hash(std::size_t seed_) : seed(seed_) {}
+
+  std::size_t operator()(int x) const
+  {
+    return boost::hash<int>()(x) ^ seed;
+  }
+};
+
+struct transparent_hash
+{
+  using is_transparent = void;
+
+  std::size_t operator()(int x) const { return boost::hash<int>()(x); }
+  std::size_t operator()(long x) const
+  {
+    return boost::hash<int>()(static_cast<int>(x));
+  }
+};
+
+struct transparent_equal
+{
+  using is_transparent = void;
+
+  template <class T, class U> bool operator()(T x, U y) const
+  {
+    return static_cast<long>(x) == static_cast<long>(y);
+  }
+};
+
+template <class View, class X> void check_view(View const& v, X const& x)
+{
+  BOOST_TEST_EQ(v.size(), x.size());
+  BOOST_TEST_EQ(v.empty(), x.empty());
+  BOOST_TEST_EQ(v.bucket_count(), x.bucket_count());
+
+  std::size_t n = 0;
+  for (auto const& e : v) {
+    auto it = x.find(typename X::key_type(e));
+    BOOST_TEST(it != x.end());
+    if (it != x.end()) BOOST_TEST(*it == e);
+    ++n;
+  }
+  BOOST_TEST_EQ(n, x.size());
+}
+
+template <class View, class X> void check_map_view(View const& v, X const& x)
+{
+  BOOST_TEST_EQ(v.size(), x.size());
+  BOOST_TEST_EQ(v.bucket_count(), x.bucket_count());
+
+  std::size_t n = 0;
+  for (auto it = v.cbegin(); it != v.cend(); ++it) {
+    BOOST_TEST(x.find(it->first) != x.end());
+    BOOST_TEST_EQ(x.at(it->first), it->second);
+    ++n;
+  }
+  BOOST_TEST_EQ(n, x.size());
+  for (auto const& e : x) {
+    BOOST_TEST(v.contains(e.first));
+    BOOST_TEST_EQ(v.count(e.first), 1u);
+    BOOST_TEST_EQ(v.at(e.first), e.second);
+    BOOST_TEST(v.find(e.first) != v.end());
+    BOOST_TEST_EQ(v.find(e.first)->second, e.second);
+  }
+}
+
+static void map_tests()
+{
+  using map_type = boost::unordered_flat_map<int, long>;
+  using view_type = boost::unordered_flat_map_view<int, long>;
+
+  {
+    map_type x;
+    image img(x);
+    view_type v(img.data(), img.size());
+    BOOST_TEST(v.empty());
+    BOOST_TEST(v.begin() == v.end());
+    BOOST_TEST(v.find(0) == v.end());
+    BOOST_TEST_EQ(v.bucket_count(), 0u);
+    BOOST_TEST_THROWS(v.at(0), std::out_of_range);
+  }
+  {
+    map_type x;
+    x.reserve(1000);
+    image img(x);
+    view_type v(img.data(), img.size());
+    check_map_view(v, x);
+    BOOST_TEST(v.find(0) == v.end());
+  }
+
+  map_type x;
+  for (int i = 0; i < 100000; ++i) x.emplace(i, -i);
+  {
+    image img(x);
+    view_type v(img.data(), img.size());
+    check_map_view(v, x);
+    for (int i = 100000; i < 200000; ++i) {
+      BOOST_TEST(v.find(i) == v.end());
+      BOOST_TEST(!v.contains(i));
+    }
+    BOOST_TEST_THROWS(v.at(-1), std::out_of_range);
+  }
+
+  // overflow bits of erased elements are kept
+
+  for (int i = 0; i < 100000; i += 3) x.erase(i);
+  {
+    image img(x);
+    view_type v(img.data(), img.size());
+    check_map_view(v, x);
+    for (int i = 0; i < 100000; i += 3) BOOST_TEST(!v.contains(i));
+  }
+
+  // random keys, so that all slots of groups get occupied
+
+  {
+    boost::unordered_flat_map<std::uint64_t, std::uint64_t> z;
+    std::uint64_t k = 0;
+    for (int i = 0; i < 100000; ++i) {
+      k = k * 6364136223846793005ull + 1442695040888963407ull;
+      z.emplace(k, k / 2);
+    }
+    image img(z);
+    boost::unordered_flat_map_view<std::uint64_t, std::uint64_t> v(
+      img.data(), img.size());
+    check_map_view(v, z);
+  }
+
+  // table being incrementally rehashed: written from a copy
+
+  map_type y;
+  y.incremental_rehash(true);
+  for (int i = 0; i < 100000; ++i) y.emplace(i, i);
+  {
+    image img(y);
+    view_type v(img.data(), img.size());
+    check_map_view(v, y);
+  }
+}
+
+static void set_tests()
+{
+  using set_type = boost::unordered_flat_set<int, transparent_hash,
+    transparent_equal>;
+  using view_type = boost::unordered_flat_set_view<int, transparent_hash,
+    transparent_equal>;
+
+  set_type x;
+  for (int i = 0; i < 50000; ++i) x.insert(2 * i);
+  image img(x);
+  view_type v(img.data(), img.size());
+  check_view(v, x);
+  for (long i = 0; i < 100000; ++i) {
+    BOOST_TEST_EQ(v.count(i), i % 2 ? 0u : 1u);
+    BOOST_TEST_EQ(v.contains(static_cast<int>(i)), i % 2 == 0);
+  }
+  BOOST_TEST(*v.find(10L) == 10);
+}
+
+static void validation_tests()
+{
+  using map_type = boost::unordered_flat_map<int, int, seeded_hash>;
+  using view_type = boost::unordered_flat_map_view<int, int, seeded_hash>;
+
+  map_type x(0, seeded_hash(12345));
+  for (int i = 0; i < 1000; ++i) x.emplace(i, i);
+
+  std::ostringstream os;
+  boost::unordered::write_snapshot(os, x);
+  auto str = os.str();
+
+  image img(x);
+  view_type v(img.data(), img.size(), seeded_hash(12345));
+  check_map_view(v, x);
+
+  // different hash function
+
+  BOOST_TEST_THROWS(
+    view_type(img.data(), img.size(), seeded_hash(54321)),
+    std::invalid_argument);
+
+  // truncated image
+
+  BOOST_TEST_THROWS(view_type(img.data(), img.size() - 1, seeded_hash(12345)),
+    std::invalid_argument);
+  BOOST_TEST_THROWS(
+    view_type(img.data(), 16, seeded_hash(12345)), std::invalid_argument);
+
+  // misaligned image
+
+  {
+    std::vector<unsigned char> buf(str.size() + 64);
+    auto p = buf.data();
+    p += (64 - reinterpret_cast<std::uintptr_t>(p) % 64) % 64 + 8;
+    std::memcpy(p, str.data(), str.size() - 8);
+    BOOST_TEST_THROWS(
+      view_type(p, str.size() - 8, seeded_hash(12345)), std::invalid_argument);
+  }
+
+  // corrupt header
+
+  {
+    image img2(x);
+    img2.data()[0] ^= 1;
+    BOOST_TEST_THROWS(view_type(img2.data(), img2.size(), seeded_hash(12345)),
+      std::invalid_argument);
+  }
+
+  // inconsistent header fields
+
+  {
+    using header_type = boost::unordered::detail::foa::snapshot_header;
+    void (*corruptions[])(header_type&) = {
+      [](header_type& hd) { hd.groups_size_index = 0; },
+      [](header_type& hd) { hd.groups_size_index += 1; },
+      [](header_type& hd) { hd.groups_size_mask = ~std::uint64_t(0); },
+      [](header_type& hd) { hd.groups_size_mask = std::uint64_t(1) << 62; },
+      [](header_type& hd) {
+        hd.groups_size_mask = (hd.groups_size_mask + 1) * 2 - 1;
+      },
+      [](header_type& hd) { hd.elements_offset = ~std::uint64_t(0); },
+      [](header_type& hd) { hd.elements_offset += 64; },
+      [](header_type& hd) { hd.image_size -= 1; },
+      [](header_type& hd) { hd.size = ~std::uint64_t(0); },
+      [](header_type& hd) { hd.groups_offset = 0; },
+    };
+    for (auto corrupt : corruptions) {
+      image img2(x);
+      header_type hd;
+      std::memcpy(&hd, img2.data(), sizeof(hd));
+      corrupt(hd);
+      std::memcpy(img2.data(), &hd, sizeof(hd));
+      BOOST_TEST_THROWS(
+        view_type(img2.data(), img2.size(), seeded_hash(12345)),
+        std::invalid_argument);
+    }
+
+    // no sentinel at the end of the groups array
+
+    image img2(x);
+    header_type hd;
+    std::memcpy(&hd, img2.data(), sizeof(hd));
+    std::memset(img2.data() + static_cast<std::size_t>(
+                                hd.groups_offset +
+                                hd.groups_size_mask * hd.group_size),
+      0, hd.group_size);
+    BOOST_TEST_THROWS(view_type(img2.data(), img2.size(), seeded_hash(12345)),
+      std::invalid_argument);
+  }
+
+  // incompatible element type
+
+  BOOST_TEST_THROWS(
+    (boost::unordered_flat_map_view<int, long, seeded_hash>(
+      img.data(), img.size(), seeded_hash(12345))),
+    std::invalid_argument);
+}
+
+UNORDERED_AUTO_TEST (snapshot_map) {
+  map_tests();
+}
+
+UNORDERED_AUTO_TEST (snapshot_set) {
+  set_tests();
+}
+
+UNORDERED_AUTO_TEST (snapshot_validation) {
+  validation_tests();
+}
+
+#endif
+
+RUN_TESTS()
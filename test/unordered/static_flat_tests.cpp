@@ -0,0 +1,246 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_UNORDERED_FOA_TESTS)
+#error "static_flat_tests is currently only supported by open-addressed containers"
+#else
+
+#include <boost/unordered/static_flat_map.hpp>
+#include <boost/unordered/static_flat_set.hpp>
+
+#include "../helpers/test.hpp"
+
+#include <boost/mp11/integer_sequence.hpp>
+#include <cstddef>
+#include <stdexcept>
+
+#if !defined(BOOST_NO_CXX17_HDR_STRING_VIEW)
+#include <string_view>
+#endif
+
+struct transparent_hash
+{
+  using is_transparent = void;
+
+  constexpr std::size_t operator()(int x) const
+  {
+    return static_cast<std::size_t>(x);
+  }
+  constexpr std::size_t operator()(long x) const
+  {
+    return static_cast<std::size_t>(static_cast<int>(x));
+  }
+};
+
+struct transparent_equal
+{
+  using is_transparent = void;
+
+  template <class T, class U> constexpr bool operator()(T x, U y) const
+  {
+    return static_cast<long>(x) == static_cast<long>(y);
+  }
+};
+
+// distinct keys with equal hash values
+
+struct clustering_hash
+{
+  constexpr std::size_t operator()(int x) const
+  {
+    return static_cast<std::size_t>(x % 4);
+  }
+};
+
+enum class color
+{
+  red,
+  green,
+  blue
+};
+
+template <std::size_t N> using int_map = boost::static_flat_map<int, int, N>;
+
+template <std::size_t... I>
+BOOST_CXX14_CONSTEXPR int_map<sizeof...(I)> make_int_map(
+  boost::mp11::index_sequence<I...>)
+{
+  return {{static_cast<int>(I * 7919), static_cast<int>(I)}...};
+}
+
+template <std::size_t N>
+BOOST_CXX14_CONSTEXPR bool check_int_map(int_map<N> const& m)
+{
+  for (std::size_t i = 0; i < N; ++i) {
+    auto it = m.find(static_cast<int>(i * 7919));
+    if (it == m.end() || it->second != static_cast<int>(i)) return false;
+    if (m.contains(static_cast<int>(i * 7919 + 1))) return false;
+  }
+  return true;
+}
+
+static void map_tests()
+{
+  static BOOST_CXX14_CONSTEXPR boost::static_flat_map<int, int, 5> m = {
+    {1, 10}, {2, 20}, {3, 30}, {-4, -40}, {1000000, 5}};
+
+#if !defined(BOOST_NO_CXX14_CONSTEXPR)
+  static_assert(m.size() == 5, "");
+  static_assert(!m.empty(), "");
+  static_assert(m.at(3) == 30, "");
+  static_assert(m.find(-4)->second == -40, "");
+  static_assert(m.find(5) == m.end(), "");
+  static_assert(m.contains(1000000), "");
+  static_assert(m.count(7) == 0, "");
+  static_assert(m.load_factor() <= 0.5f, "");
+#endif
+
+  BOOST_TEST_EQ(m.size(), 5u);
+  BOOST_TEST_EQ(m.at(1), 10);
+  BOOST_TEST_EQ(m.at(1000000), 5);
+  BOOST_TEST_THROWS(m.at(0), std::out_of_range);
+  for (int i = -10; i < 10; ++i) {
+    BOOST_TEST_EQ(m.contains(i), (i >= 1 && i <= 3) || i == -4);
+  }
+
+  // iteration follows initialization order
+
+  int keys[] = {1, 2, 3, -4, 1000000};
+  std::size_t n = 0;
+  for (auto const& x : m) {
+    BOOST_TEST_EQ(x.first, keys[n]);
+    ++n;
+  }
+  BOOST_TEST_EQ(n, 5u);
+
+  auto r = m.equal_range(2);
+  BOOST_TEST(r.first == m.find(2));
+  BOOST_TEST_EQ(r.second - r.first, 1);
+  r = m.equal_range(4);
+  BOOST_TEST(r.first == m.end());
+  BOOST_TEST(r.second == m.end());
+
+  // a single element
+
+  static BOOST_CXX14_CONSTEXPR boost::static_flat_map<color, char, 1> m1 = {
+    {color::green, 'g'}};
+  BOOST_TEST_EQ(m1.at(color::green), 'g');
+  BOOST_TEST(!m1.contains(color::red));
+  BOOST_TEST(!m1.contains(color::blue));
+
+  // equality
+
+  boost::static_flat_map<int, int, 5> m2 = {
+    {1000000, 5}, {-4, -40}, {3, 30}, {2, 20}, {1, 10}};
+  boost::static_flat_map<int, int, 5> m3 = {
+    {1000000, 5}, {-4, -40}, {3, 30}, {2, 20}, {1, 11}};
+  BOOST_TEST(m == m2);
+  BOOST_TEST(m != m3);
+
+  auto m4 = m2;
+  BOOST_TEST(m4 == m);
+}
+
+static void large_map_tests()
+{
+#if !defined(BOOST_NO_CXX14_CONSTEXPR)
+  constexpr auto m = make_int_map(boost::mp11::make_index_sequence<200>());
+  static_assert(check_int_map(m), "");
+#endif
+
+  auto m2 = make_int_map(boost::mp11::make_index_sequence<3000>());
+  BOOST_TEST(check_int_map(m2));
+  BOOST_TEST_LE(m2.load_factor(), 0.5f);
+  BOOST_TEST_GT(m2.load_factor(), 0.25f);
+}
+
+#if !defined(BOOST_NO_CXX17_HDR_STRING_VIEW)
+static constexpr int add(int x, int y) { return x + y; }
+static constexpr int sub(int x, int y) { return x - y; }
+static constexpr int mul(int x, int y) { return x * y; }
+
+static void string_view_tests()
+{
+  using namespace std::literals;
+
+  static constexpr boost::static_flat_map<std::string_view, int (*)(int, int),
+    3>
+    ops = {{"add"sv, &add}, {"sub"sv, &sub}, {"mul"sv, &mul}};
+
+  static_assert(ops.at("mul")(6, 7) == 42);
+  static_assert(!ops.contains("div"));
+  static_assert(!ops.contains(""));
+
+  BOOST_TEST_EQ(ops.at("add")(2, 3), 5);
+  BOOST_TEST_EQ(ops.at("sub")(2, 3), -1);
+  BOOST_TEST(ops.find("addd") == ops.end());
+
+  static constexpr boost::static_flat_set<std::string_view, 4> keywords = {
+    "if"sv, "else"sv, "while"sv, "for"sv};
+
+  static_assert(keywords.contains("while"));
+  static_assert(!keywords.contains("do"));
+  BOOST_TEST(keywords.contains("for"));
+  BOOST_TEST(!keywords.contains("fo"));
+}
+#endif
+
+static void set_tests()
+{
+  using set_type =
+    boost::static_flat_set<int, 6, transparent_hash, transparent_equal>;
+
+  static BOOST_CXX14_CONSTEXPR set_type s = {0, 64, 128, 192, 256, 320};
+
+#if !defined(BOOST_NO_CXX14_CONSTEXPR)
+  static_assert(s.contains(128L), "");
+  static_assert(s.count(129L) == 0, "");
+#endif
+
+  for (long i = 0; i < 1000; ++i) {
+    BOOST_TEST_EQ(s.count(i), i % 64 == 0 && i <= 320 ? 1u : 0u);
+    BOOST_TEST_EQ(s.contains(static_cast<int>(i)), i % 64 == 0 && i <= 320);
+  }
+  BOOST_TEST(*s.find(64L) == 64);
+  BOOST_TEST(s == set_type({320, 256, 192, 128, 64, 0}));
+  BOOST_TEST(s != set_type({320, 256, 192, 128, 64, 1}));
+}
+
+static void error_tests()
+{
+  using map_type = boost::static_flat_map<int, int, 3>;
+
+  BOOST_TEST_THROWS(
+    (map_type{{1, 1}, {2, 2}, {1, 3}}), std::invalid_argument);
+  BOOST_TEST_THROWS((map_type{{1, 1}, {2, 2}}), std::invalid_argument);
+  BOOST_TEST_THROWS(
+    (map_type{{1, 1}, {2, 2}, {3, 3}, {4, 4}}), std::invalid_argument);
+  BOOST_TEST_THROWS(
+    (boost::static_flat_set<int, 3, clustering_hash>{0, 1, 4}),
+    std::invalid_argument);
+
+  boost::static_flat_set<int, 3, clustering_hash> s = {0, 1, 2};
+  BOOST_TEST(s.contains(1));
+  BOOST_TEST(!s.contains(4));
+}
+
+UNORDERED_AUTO_TEST (static_flat_map) {
+  map_tests();
+  large_map_tests();
+#if !defined(BOOST_NO_CXX17_HDR_STRING_VIEW)
+  string_view_tests();
+#endif
+}
+
+UNORDERED_AUTO_TEST (static_flat_set) {
+  set_tests();
+}
+
+UNORDERED_AUTO_TEST (static_flat_errors) {
+  error_tests();
+}
+
+#endif
+
+RUN_TESTS()
@@ -160,8 +160,10 @@ void check_container_stats(const Stats& s, check_stats_contition cond)
     cond == stats_empty? stats_empty : stats_mostly_full);
 }
 
-template <class Stats>
-void check_container_stats(const Stats& s1, const Stats& s2)
+// Concurrent containers' stats extend those of non-concurrent containers
+
+template <class Stats1, class Stats2>
+void check_container_stats(const Stats1& s1, const Stats2& s2)
 {
   check_insertion_stats(s1.insertion, s2.insertion);
   check_lookup_stats(s1.successful_lookup, s2.successful_lookup);
@@ -213,11 +215,22 @@ template <class Container> void test_stats()
   // May not hold in concurrent containers because of insertion retries
   BOOST_TEST_GT(
     s.insertion.count, s.unsuccessful_lookup.count); 
+#else
+  // Growth under exclusive lock, all but the first from empty with
+  // arrays allocated beforehand
+  BOOST_TEST_GT(s.growth.count, 1u);
+  check_stat(s.growth.exclusive_lock_time, stats_full);
+  BOOST_TEST(esentially_same(
+    s.growth.preallocated.average,
+    1.0 - 1.0 / static_cast<double>(s.growth.count)));
 #endif
 
   // resets_stats() actually clears stats
   c.reset_stats();
   check_container_stats(cc.get_stats(), stats_empty);
+#if defined(BOOST_UNORDERED_CFOA_TESTS)
+  BOOST_TEST_EQ(cc.get_stats().growth.count, 0u);
+#endif
 
   // Stats after lookup
 
@@ -285,6 +298,10 @@ template <class Container> void test_stats()
   Container c2 = std::move(c);
   check_container_stats(c.get_stats(), stats_empty);
   check_container_stats(c2.get_stats(), s);
+#if defined(BOOST_UNORDERED_CFOA_TESTS)
+  BOOST_TEST_EQ(c.get_stats().growth.count, 0u);
+  BOOST_TEST_EQ(c2.get_stats().growth.count, s.growth.count);
+#endif
 
   // Move constructor with equal allocator
   // Stats transferred to target and reset in source
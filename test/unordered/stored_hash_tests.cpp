@@ -0,0 +1,177 @@
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_UNORDERED_FOA_TESTS)
+#error "stored_hash_tests is currently only supported by open-addressed containers"
+#else
+
+#include "../helpers/unordered.hpp"
+
+#include "../helpers/test.hpp"
+
+#include <boost/unordered/hash_traits.hpp>
+#include <boost/cstdint.hpp>
+#include <string>
+#include <type_traits>
+
+struct no_stored_hash
+{
+};
+
+template <class StoredHash> struct with_stored_hash
+{
+  using stored_hash_type = StoredHash;
+};
+
+template <class StoredHashTraits>
+struct counting_hash : StoredHashTraits
+{
+  static std::size_t calls;
+
+  std::size_t operator()(std::string const& x) const
+  {
+    ++calls;
+    return boost::hash<std::string>()(x);
+  }
+};
+
+template <class StoredHashTraits>
+std::size_t counting_hash<StoredHashTraits>::calls = 0;
+
+using hash_no_storage = counting_hash<no_stored_hash>;
+using hash_full_storage = counting_hash<with_stored_hash<std::size_t> >;
+using hash_32_storage = counting_hash<with_stored_hash<boost::uint32_t> >;
+
+static void stored_hash_type_tests()
+{
+  using boost::unordered::stored_hash_type;
+
+  BOOST_TEST_TRAIT_SAME(stored_hash_type<hash_no_storage>::type, void);
+  BOOST_TEST_TRAIT_SAME(
+    stored_hash_type<hash_full_storage>::type, std::size_t);
+  BOOST_TEST_TRAIT_SAME(
+    stored_hash_type<hash_32_storage>::type, boost::uint32_t);
+}
+
+static std::string make_key(int i)
+{
+  return "a long enough string key to prevent SBO #" + std::to_string(i);
+}
+
+struct fill_map
+{
+  template <class X> void operator()(X& x, int first, int last) const
+  {
+    for (int i = first; i < last; ++i) {
+      x.emplace(make_key(i), i);
+    }
+  }
+};
+
+struct fill_set
+{
+  template <class X> void operator()(X& x, int first, int last) const
+  {
+    for (int i = first; i < last; ++i) {
+      x.insert(make_key(i));
+    }
+  }
+};
+
+template <class X> bool check(X const& x, int first, int last)
+{
+  if (x.size() != static_cast<std::size_t>(last - first)) return false;
+  for (int i = first; i < last; ++i) {
+    if (!x.contains(make_key(i))) return false;
+  }
+  return true;
+}
+
+template <class X, class Fill>
+void stored_hash_tests(Fill fill_, bool stores_hash)
+{
+  using hasher = typename X::hasher;
+
+  int const n = 2000;
+
+  // insertion with growth
+  hasher::calls = 0;
+  X x;
+  fill_(x, 0, n);
+  BOOST_TEST(stores_hash ? hasher::calls == static_cast<std::size_t>(n)
+                         : hasher::calls > static_cast<std::size_t>(n));
+
+  // explicit rehash
+  hasher::calls = 0;
+  x.rehash(4 * x.bucket_count());
+  BOOST_TEST_EQ(hasher::calls, stores_hash ? 0u : static_cast<std::size_t>(n));
+
+  // copy construction and assignment with same/different bucket count
+  hasher::calls = 0;
+  X x2(x);
+  X x3(x2);
+  BOOST_TEST_EQ(x3.bucket_count(), x2.bucket_count());
+  X x4;
+  x4.reserve(10 * n);
+  x4 = x;
+  if (stores_hash) BOOST_TEST_EQ(hasher::calls, 0u);
+
+  // merge
+  X y;
+  fill_(y, n / 2, 2 * n);
+  hasher::calls = 0;
+  x2.merge(y);
+  if (stores_hash) BOOST_TEST_EQ(hasher::calls, 0u);
+  BOOST_TEST_EQ(y.size(), static_cast<std::size_t>(n / 2));
+
+  BOOST_TEST(check(x, 0, n));
+  BOOST_TEST(check(x3, 0, n));
+  BOOST_TEST(check(x4, 0, n));
+  BOOST_TEST(check(x2, 0, 2 * n));
+  BOOST_TEST(check(y, n / 2, n));
+
+  // erasure + reinsertion keeps stored hashes consistent
+  for (int i = 0; i < n; i += 2) {
+    x.erase(make_key(i));
+  }
+  fill_(x, n, 2 * n);
+  x.rehash(0);
+  BOOST_TEST_EQ(x.size(), static_cast<std::size_t>(n + n / 2));
+  for (int i = 1; i < n; i += 2) {
+    BOOST_TEST(x.contains(make_key(i)));
+  }
+  BOOST_TEST(check(X(x), n, 2 * n) == false);
+  BOOST_TEST(X(x) == x);
+}
+
+template <class Hash> void stored_hash_tests(bool stores_hash)
+{
+  stored_hash_tests<boost::unordered_flat_map<std::string, int, Hash> >(
+    fill_map(), stores_hash);
+  stored_hash_tests<boost::unordered_node_map<std::string, int, Hash> >(
+    fill_map(), stores_hash);
+  stored_hash_tests<boost::unordered_flat_set<std::string, Hash> >(
+    fill_set(), stores_hash);
+  stored_hash_tests<boost::unordered_node_set<std::string, Hash> >(
+    fill_set(), stores_hash);
+}
+
+UNORDERED_AUTO_TEST (stored_hash_type_trait) {
+  stored_hash_type_tests();
+}
+
+UNORDERED_AUTO_TEST (no_stored_hash_test) {
+  stored_hash_tests<hash_no_storage>(false);
+}
+
+UNORDERED_AUTO_TEST (full_stored_hash_test) {
+  stored_hash_tests<hash_full_storage>(true);
+}
+
+UNORDERED_AUTO_TEST (stored_hash_32_test) {
+  stored_hash_tests<hash_32_storage>(true);
+}
+#endif
+
+RUN_TESTS()